@@ -0,0 +1,196 @@
+#include "../test.h" // IWYU pragma: keep
+#include <furi.h>
+#include <storage/storage.h>
+#include <loader/firmware_api/firmware_api.h>
+#include <flipper_application/elf/elf_link_cache.h>
+
+#define LINK_CACHE_TEST_DIR      EXT_PATH(".tmp/unit_tests/elf_link_cache")
+#define LINK_CACHE_TEST_FAP      LINK_CACHE_TEST_DIR "/test.fap"
+#define LINK_CACHE_TEST_MISSING  LINK_CACHE_TEST_DIR "/missing.fap"
+#define LINK_CACHE_TEST_API_MAJOR 1
+#define LINK_CACHE_TEST_API_MINOR 2
+
+static const ElfLinkCacheRecord link_cache_test_records[] = {
+    {.type = 2, .section = 1, .symbol_section = 0, .value = 0x08001235},
+    {.type = 2, .section = 1, .symbol_section = 0, .value = 0x08001235},
+    {.type = 10, .section = 1, .symbol_section = 3, .value = 0x40},
+    {.type = 2, .section = 4, .symbol_section = 0, .value = 0x08005679},
+};
+
+static const uint32_t link_cache_test_offsets[] = {0x10, 0x24, 0x30, 0xABCDEF};
+
+static const uint8_t link_cache_test_header[] = {0x7F, 'E', 'L', 'F', 1, 1, 1};
+
+static Storage* storage;
+
+static bool link_cache_test_fap_write(const char* content) {
+    File* file = storage_file_alloc(storage);
+    const size_t size = strlen(content);
+    bool result = storage_file_open(file, LINK_CACHE_TEST_FAP, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+                  storage_file_write(file, content, size) == size;
+    storage_file_close(file);
+    storage_file_free(file);
+    return result;
+}
+
+static void link_cache_test_setup(void) {
+    storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_mkdir(storage, EXT_PATH(".tmp/unit_tests"));
+    storage_simply_mkdir(storage, LINK_CACHE_TEST_DIR);
+}
+
+static void link_cache_test_teardown(void) {
+    ElfLinkCache* cache = elf_link_cache_alloc(storage);
+    elf_link_cache_begin(
+        cache, LINK_CACHE_TEST_FAP, LINK_CACHE_TEST_API_MAJOR, LINK_CACHE_TEST_API_MINOR);
+    elf_link_cache_remove(cache);
+    elf_link_cache_free(cache);
+
+    // Loader state is restored even if a test changed the firmware fingerprint
+    elf_link_cache_set_api(firmware_api_interface, firmware_api_get_fingerprint());
+
+    storage_simply_remove_recursive(storage, LINK_CACHE_TEST_DIR);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static ElfLinkCache* link_cache_test_begin(const char* path) {
+    ElfLinkCache* cache = elf_link_cache_alloc(storage);
+    elf_link_cache_begin(cache, path, LINK_CACHE_TEST_API_MAJOR, LINK_CACHE_TEST_API_MINOR);
+    elf_link_cache_feed(cache, link_cache_test_header, sizeof(link_cache_test_header));
+    return cache;
+}
+
+static bool link_cache_test_store(void) {
+    ElfLinkCache* cache = link_cache_test_begin(LINK_CACHE_TEST_FAP);
+    bool result = elf_link_cache_write_begin(cache);
+    for(size_t i = 0; i < COUNT_OF(link_cache_test_records); i++) {
+        elf_link_cache_write(cache, &link_cache_test_records[i], link_cache_test_offsets[i]);
+    }
+    elf_link_cache_write_end(cache, true);
+    elf_link_cache_free(cache);
+    return result;
+}
+
+static bool link_cache_test_is_hit(void) {
+    ElfLinkCache* cache = link_cache_test_begin(LINK_CACHE_TEST_FAP);
+    bool hit = elf_link_cache_read_begin(cache);
+    if(hit) elf_link_cache_read_end(cache);
+    elf_link_cache_free(cache);
+    return hit;
+}
+
+MU_TEST(elf_link_cache_hit_test) {
+    mu_assert(link_cache_test_fap_write("first build"), "Failed to write FAP");
+    mu_assert(!link_cache_test_is_hit(), "Hit before the first load");
+    mu_assert(link_cache_test_store(), "Failed to store cache");
+
+    ElfLinkCache* cache = link_cache_test_begin(LINK_CACHE_TEST_FAP);
+    bool hit = elf_link_cache_read_begin(cache);
+    size_t count = 0;
+    bool records_match = true;
+    ElfLinkCacheRecord record;
+    uint32_t offset;
+    while(hit && elf_link_cache_read(cache, &record, &offset)) {
+        if(count < COUNT_OF(link_cache_test_records)) {
+            const ElfLinkCacheRecord* expected = &link_cache_test_records[count];
+            records_match &= record.type == expected->type &&
+                             record.section == expected->section &&
+                             record.symbol_section == expected->symbol_section &&
+                             record.value == expected->value &&
+                             offset == link_cache_test_offsets[count];
+        }
+        count++;
+    }
+    bool complete = hit && elf_link_cache_read_end(cache);
+    elf_link_cache_free(cache);
+
+    mu_assert(hit, "Cache miss after store");
+    mu_assert(complete, "Cache read error");
+    mu_assert_int_eq(COUNT_OF(link_cache_test_records), count);
+    mu_assert(records_match, "Records mismatch");
+}
+
+MU_TEST(elf_link_cache_miss_test) {
+    mu_assert(link_cache_test_fap_write("first build"), "Failed to write FAP");
+    mu_assert(link_cache_test_store(), "Failed to store cache");
+    mu_assert(link_cache_test_is_hit(), "Cache miss after store");
+
+    // Same size and headers, only the content differs
+    mu_assert(link_cache_test_fap_write("other build"), "Failed to write FAP");
+    mu_assert(!link_cache_test_is_hit(), "Hit after FAP change");
+
+    // Interrupted load leaves no cache behind
+    ElfLinkCache* cache = link_cache_test_begin(LINK_CACHE_TEST_FAP);
+    mu_assert(elf_link_cache_write_begin(cache), "Failed to start writing");
+    elf_link_cache_write(cache, &link_cache_test_records[0], link_cache_test_offsets[0]);
+    elf_link_cache_write_end(cache, false);
+    bool exists = storage_file_exists(storage, elf_link_cache_get_path(cache));
+    elf_link_cache_free(cache);
+    mu_assert(!exists, "Dropped cache exists");
+    mu_assert(!link_cache_test_is_hit(), "Hit after dropped write");
+}
+
+MU_TEST(elf_link_cache_firmware_update_test) {
+    // First write after boot prunes, it must see the real fingerprint to keep other entries
+    mu_assert(link_cache_test_fap_write("first build"), "Failed to write FAP");
+    mu_assert(link_cache_test_store(), "Failed to store cache");
+    mu_assert(link_cache_test_is_hit(), "Cache miss after store");
+
+    // Entry stored by another firmware build is a miss and gets pruned
+    elf_link_cache_set_api(firmware_api_interface, firmware_api_get_fingerprint() + 1);
+    mu_assert(!link_cache_test_is_hit(), "Hit after firmware update");
+    mu_assert(link_cache_test_store(), "Failed to store cache");
+    elf_link_cache_set_api(firmware_api_interface, firmware_api_get_fingerprint());
+
+    ElfLinkCache* cache = link_cache_test_begin(LINK_CACHE_TEST_FAP);
+    elf_link_cache_prune(storage);
+    bool exists = storage_file_exists(storage, elf_link_cache_get_path(cache));
+    elf_link_cache_free(cache);
+    mu_assert(!exists, "Stale firmware entry not pruned");
+}
+
+MU_TEST(elf_link_cache_prune_test) {
+    mu_assert(link_cache_test_fap_write("first build"), "Failed to write FAP");
+    mu_assert(link_cache_test_store(), "Failed to store cache");
+
+    ElfLinkCache* cache = link_cache_test_begin(LINK_CACHE_TEST_FAP);
+    elf_link_cache_prune(storage);
+    bool kept = storage_file_exists(storage, elf_link_cache_get_path(cache));
+    mu_assert(storage_simply_remove(storage, LINK_CACHE_TEST_FAP), "Failed to remove FAP");
+    elf_link_cache_prune(storage);
+    bool pruned = !storage_file_exists(storage, elf_link_cache_get_path(cache));
+    elf_link_cache_free(cache);
+
+    mu_assert(kept, "Live entry pruned");
+    mu_assert(pruned, "Entry of a removed FAP not pruned");
+}
+
+MU_TEST(elf_link_cache_no_digest_test) {
+    // Digest of a missing FAP can't be taken, the cache is off for that load
+    ElfLinkCache* cache = link_cache_test_begin(LINK_CACHE_TEST_MISSING);
+    bool read = elf_link_cache_read_begin(cache);
+    bool write = elf_link_cache_write_begin(cache);
+    bool exists = storage_file_exists(storage, elf_link_cache_get_path(cache));
+    elf_link_cache_free(cache);
+
+    mu_assert(!read, "Read without digest");
+    mu_assert(!write, "Write without digest");
+    mu_assert(!exists, "Cache created without digest");
+}
+
+MU_TEST_SUITE(elf_link_cache) {
+    MU_SUITE_CONFIGURE(link_cache_test_setup, link_cache_test_teardown);
+    MU_RUN_TEST(elf_link_cache_hit_test);
+    MU_RUN_TEST(elf_link_cache_miss_test);
+    MU_RUN_TEST(elf_link_cache_firmware_update_test);
+    MU_RUN_TEST(elf_link_cache_prune_test);
+    MU_RUN_TEST(elf_link_cache_no_digest_test);
+}
+
+int run_minunit_test_elf_link_cache(void) {
+    MU_RUN_SUITE(elf_link_cache);
+
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_elf_link_cache)
@@ -0,0 +1,211 @@
+#include "../test.h" // IWYU pragma: keep
+#include <furi.h>
+#include <storage/storage.h>
+#include <gui/modules/file_browser_worker.h>
+
+#define TAG "FileBrowserTest"
+
+#define BROWSER_BENCH_PARENT_DIR      EXT_PATH(".tmp/unit_tests")
+#define BROWSER_BENCH_DIR             BROWSER_BENCH_PARENT_DIR "/browser"
+#define BROWSER_BENCH_FILE_COUNT      5000
+#define BROWSER_INVALIDATE_FILE_COUNT 100
+#define BROWSER_BENCH_PAGE            50
+#define BROWSER_BENCH_TIMEOUT_MS      60000
+#define BROWSER_BENCH_ITEM_PREFIX     "capture_"
+#define BROWSER_BENCH_ITEM(index)     BROWSER_BENCH_ITEM_PREFIX index ".sub"
+
+typedef struct {
+    FuriSemaphore* semaphore;
+    FuriString* first_item;
+    uint32_t item_cnt;
+    uint32_t page_offset;
+    uint32_t page_items;
+    uint32_t page_errors;
+} BrowserBench;
+
+static Storage* storage;
+static BrowserBench bench;
+static BrowserWorker* worker;
+
+static void browser_bench_setup(void) {
+    storage = furi_record_open(RECORD_STORAGE);
+    bench = (BrowserBench){
+        .semaphore = furi_semaphore_alloc(1, 0),
+        .first_item = furi_string_alloc(),
+    };
+    worker = NULL;
+}
+
+// Runs after failed asserts too, so the bench folder never stays on the card
+static void browser_bench_teardown(void) {
+    if(worker) file_browser_worker_free(worker);
+    furi_string_free(bench.first_item);
+    furi_semaphore_free(bench.semaphore);
+
+    storage_simply_remove_recursive(storage, BROWSER_BENCH_DIR);
+    furi_record_close(RECORD_STORAGE);
+}
+
+static void
+    browser_bench_folder_cb(void* context, uint32_t item_cnt, int32_t file_idx, bool is_root) {
+    UNUSED(file_idx);
+    UNUSED(is_root);
+    BrowserBench* bench = context;
+    bench->item_cnt = item_cnt;
+    furi_semaphore_release(bench->semaphore);
+}
+
+static void browser_bench_list_load_cb(void* context, uint32_t list_load_offset) {
+    BrowserBench* bench = context;
+    bench->page_offset = list_load_offset;
+    bench->page_items = 0;
+    bench->page_errors = 0;
+    furi_string_reset(bench->first_item);
+}
+
+static void
+    browser_bench_item_cb(void* context, FuriString* item_path, bool is_folder, bool is_last) {
+    BrowserBench* bench = context;
+    if(is_last) {
+        furi_semaphore_release(bench->semaphore);
+        return;
+    }
+
+    size_t name_start = furi_string_search_rchar(item_path, '/') + 1;
+    if(is_folder || furi_string_search_str(item_path, BROWSER_BENCH_ITEM_PREFIX, name_start) !=
+                        name_start) {
+        bench->page_errors++;
+    }
+    if(bench->page_items == 0) {
+        furi_string_set_n(
+            bench->first_item,
+            item_path,
+            name_start,
+            furi_string_size(item_path) - name_start);
+    }
+    bench->page_items++;
+}
+
+static bool browser_bench_file_create(FuriString* path, size_t index) {
+    File* file = storage_file_alloc(storage);
+    furi_string_printf(path, "%s/" BROWSER_BENCH_ITEM("%04zu"), BROWSER_BENCH_DIR, index);
+    bool created =
+        storage_file_open(file, furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_NEW);
+    storage_file_close(file);
+    storage_file_free(file);
+    return created;
+}
+
+static bool browser_bench_folder_create(size_t count) {
+    FuriString* path = furi_string_alloc();
+    size_t index = 0;
+
+    storage_simply_remove_recursive(storage, BROWSER_BENCH_DIR);
+    if(storage_simply_mkdir(storage, BROWSER_BENCH_PARENT_DIR) &&
+       storage_simply_mkdir(storage, BROWSER_BENCH_DIR)) {
+        for(; index < count; index++) {
+            if(!browser_bench_file_create(path, index)) break;
+        }
+    }
+
+    furi_string_free(path);
+
+    return index == count;
+}
+
+static bool browser_bench_folder_enter(size_t count) {
+    // Worker starts in the parent folder, it may be entered before the callbacks are set
+    FuriString* path = furi_string_alloc_set(BROWSER_BENCH_PARENT_DIR);
+    worker = file_browser_worker_alloc(path, NULL, ".sub", true, true);
+    file_browser_worker_set_callback_context(worker, &bench);
+    file_browser_worker_set_folder_callback(worker, browser_bench_folder_cb);
+    file_browser_worker_set_list_callback(worker, browser_bench_list_load_cb);
+    file_browser_worker_set_item_callback(worker, browser_bench_item_cb);
+
+    furi_string_set(path, BROWSER_BENCH_DIR);
+    file_browser_worker_set_config(worker, path, ".sub", true, true);
+    furi_string_free(path);
+
+    do {
+        if(furi_semaphore_acquire(bench.semaphore, BROWSER_BENCH_TIMEOUT_MS) != FuriStatusOk) {
+            return false;
+        }
+    } while(bench.item_cnt != count);
+
+    return true;
+}
+
+static bool browser_bench_page_load(uint32_t offset, uint32_t count) {
+    file_browser_worker_load(worker, offset, count);
+    return furi_semaphore_acquire(bench.semaphore, BROWSER_BENCH_TIMEOUT_MS) == FuriStatusOk;
+}
+
+MU_TEST(file_browser_worker_paging_benchmark_test) {
+    mu_assert(browser_bench_folder_create(BROWSER_BENCH_FILE_COUNT), "Folder create error");
+
+    uint32_t start = furi_get_tick();
+    mu_assert(browser_bench_folder_enter(BROWSER_BENCH_FILE_COUNT), "Folder enter timeout");
+    uint32_t enter_time = furi_get_tick() - start;
+
+    // Window moves by half a page, the same way the file browser scrolls
+    uint32_t pages = 0;
+    uint32_t total_errors = 0;
+    start = furi_get_tick();
+    for(uint32_t offset = 0; offset < bench.item_cnt; offset += BROWSER_BENCH_PAGE / 2) {
+        mu_assert(browser_bench_page_load(offset, BROWSER_BENCH_PAGE), "Page load timeout");
+        mu_assert_int_eq(offset, bench.page_offset);
+        mu_assert_int_eq(MIN(BROWSER_BENCH_PAGE, bench.item_cnt - offset), bench.page_items);
+        total_errors += bench.page_errors;
+        pages++;
+    }
+    uint32_t scroll_time = furi_get_tick() - start;
+    mu_assert_int_eq(0, total_errors);
+
+    FURI_LOG_I(
+        TAG,
+        "%lu items: enter %lu ms, %lu pages in %lu ms, %lu ms per page",
+        bench.item_cnt,
+        enter_time,
+        pages,
+        scroll_time,
+        scroll_time / pages);
+}
+
+MU_TEST(file_browser_worker_snapshot_invalidation_test) {
+    mu_assert(browser_bench_folder_create(BROWSER_INVALIDATE_FILE_COUNT), "Folder create error");
+    mu_assert(browser_bench_folder_enter(BROWSER_INVALIDATE_FILE_COUNT), "Folder enter timeout");
+    mu_assert(browser_bench_page_load(0, BROWSER_BENCH_PAGE), "Page load timeout");
+    mu_assert_string_eq(BROWSER_BENCH_ITEM("0000"), furi_string_get_cstr(bench.first_item));
+
+    // Changes land within the same second as the snapshot, the RTC timestamp misses them
+    FuriString* path = furi_string_alloc();
+    bool created = browser_bench_file_create(path, BROWSER_INVALIDATE_FILE_COUNT);
+    bool loaded = browser_bench_page_load(BROWSER_INVALIDATE_FILE_COUNT, BROWSER_BENCH_PAGE);
+    furi_string_free(path);
+    mu_assert(created, "Failed to create file");
+    mu_assert(loaded, "Page load timeout");
+    mu_assert_int_eq(1, bench.page_items);
+    mu_assert_string_eq(BROWSER_BENCH_ITEM("0100"), furi_string_get_cstr(bench.first_item));
+
+    mu_assert(
+        storage_simply_remove(storage, BROWSER_BENCH_DIR "/" BROWSER_BENCH_ITEM("0000")),
+        "Failed to remove file");
+    mu_assert(browser_bench_page_load(0, BROWSER_BENCH_PAGE), "Page load timeout");
+    mu_assert_int_eq(BROWSER_BENCH_PAGE, bench.page_items);
+    mu_assert_string_eq(BROWSER_BENCH_ITEM("0001"), furi_string_get_cstr(bench.first_item));
+    mu_assert_int_eq(0, bench.page_errors);
+}
+
+MU_TEST_SUITE(file_browser) {
+    MU_SUITE_CONFIGURE(browser_bench_setup, browser_bench_teardown);
+    MU_RUN_TEST(file_browser_worker_paging_benchmark_test);
+    MU_RUN_TEST(file_browser_worker_snapshot_invalidation_test);
+}
+
+int run_minunit_test_file_browser(void) {
+    MU_RUN_SUITE(file_browser);
+
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_file_browser)
@@ -4,9 +4,15 @@
 #include <toolbox/stream/stream.h>
 #include "../test.h" // IWYU pragma: keep
 
+#define TAG "FlipperFormatTest"
+
 #define TEST_DIR_NAME EXT_PATH(".tmp/unit_tests/ff")
 #define TEST_DIR      TEST_DIR_NAME "/"
 
+#define TEST_DUMP_FILE        TEST_DIR "ff_mf_classic_4k.test"
+#define TEST_DUMP_BLOCK_COUNT (256U)
+#define TEST_DUMP_BLOCK_SIZE  (16U)
+
 static const char* test_filetype = "Flipper File test";
 static const uint32_t test_version = 666;
 
@@ -456,6 +462,129 @@ static bool test_read_multikey(const char* file_name) {
     return result;
 }
 
+static bool test_write_dump(const char* file_name) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+    FlipperFormat* file = flipper_format_buffered_file_alloc(storage);
+    FuriString* key = furi_string_alloc();
+    FuriString* value = furi_string_alloc();
+
+    do {
+        if(!flipper_format_buffered_file_open_always(file, file_name)) break;
+        if(!flipper_format_write_header_cstr(file, "Flipper NFC device", 4)) break;
+        if(!flipper_format_write_string_cstr(file, "Device type", "Mifare Classic")) break;
+        if(!flipper_format_write_string_cstr(file, "Mifare Classic type", "4K")) break;
+
+        bool error = false;
+        for(uint32_t block = 0; block < TEST_DUMP_BLOCK_COUNT; block++) {
+            // Same line layout as a real dump, block number is encoded in the data
+            furi_string_printf(key, "Block %lu", block);
+            furi_string_reset(value);
+            for(uint32_t i = 0; i < TEST_DUMP_BLOCK_SIZE; i++) {
+                furi_string_cat_printf(value, i == 0 ? "%02lX" : " %02lX", (block + i) & 0xFF);
+            }
+            if(!flipper_format_write_string(file, furi_string_get_cstr(key), value)) {
+                error = true;
+                break;
+            }
+        }
+        if(error) break;
+
+        result = true;
+    } while(false);
+
+    furi_string_free(value);
+    furi_string_free(key);
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+// Reads every block, in reverse order it forces a rewind and a rescan for each key
+static bool test_read_dump(const char* file_name, bool key_index, bool reverse, uint32_t* time) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+    FlipperFormat* file = flipper_format_buffered_file_alloc(storage);
+    flipper_format_set_key_index(file, key_index);
+    FuriString* key = furi_string_alloc();
+    FuriString* value = furi_string_alloc();
+    uint8_t data[TEST_DUMP_BLOCK_SIZE];
+
+    uint32_t start = furi_get_tick();
+    do {
+        if(!flipper_format_buffered_file_open_existing(file, file_name)) break;
+        if(!flipper_format_read_string(file, "Mifare Classic type", value)) break;
+        if(furi_string_cmp_str(value, "4K") != 0) break;
+
+        bool error = false;
+        for(uint32_t i = 0; i < TEST_DUMP_BLOCK_COUNT; i++) {
+            uint32_t block = reverse ? (TEST_DUMP_BLOCK_COUNT - 1 - i) : i;
+            furi_string_printf(key, "Block %lu", block);
+            if(reverse && !flipper_format_rewind(file)) {
+                error = true;
+                break;
+            }
+            if(!flipper_format_read_hex(file, furi_string_get_cstr(key), data, sizeof(data))) {
+                error = true;
+                break;
+            }
+            uint8_t last = (block + TEST_DUMP_BLOCK_SIZE - 1) & 0xFF;
+            if(data[0] != (block & 0xFF) || data[TEST_DUMP_BLOCK_SIZE - 1] != last) {
+                error = true;
+                break;
+            }
+        }
+        if(error) break;
+
+        // Missing key must leave the stream at the end, same as the linear search
+        if(flipper_format_read_string(file, "Block 0", value)) break;
+        if(!flipper_format_rewind(file)) break;
+        if(flipper_format_read_string(file, "Block 256", value)) break;
+        if(!flipper_format_key_exist(file, "Block 255")) break;
+
+        result = true;
+    } while(false);
+    *time = furi_get_tick() - start;
+
+    furi_string_free(value);
+    furi_string_free(key);
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+static bool test_update_dump_with_index(const char* file_name) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+    FlipperFormat* file = flipper_format_buffered_file_alloc(storage);
+    flipper_format_set_key_index(file, true);
+    FuriString* value = furi_string_alloc();
+
+    do {
+        if(!flipper_format_buffered_file_open_existing(file, file_name)) break;
+        if(!flipper_format_read_string(file, "Block 128", value)) break;
+
+        // Update shifts all following keys, index must be rebuilt
+        if(!flipper_format_update_string_cstr(file, "Block 100", "?? ?? ?? ??")) break;
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_read_string(file, "Block 100", value)) break;
+        if(furi_string_cmp_str(value, "?? ?? ?? ??") != 0) break;
+        if(!flipper_format_read_string(file, "Block 200", value)) break;
+        if(furi_string_cmp_str(value, "C8 C9 CA CB CC CD CE CF D0 D1 D2 D3 D4 D5 D6 D7") != 0)
+            break;
+
+        result = true;
+    } while(false);
+
+    furi_string_free(value);
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
 MU_TEST(flipper_format_write_test) {
     mu_assert(storage_write_string(test_file_linux, test_data_nix), "Write test error [Linux]");
     mu_assert(
@@ -528,6 +657,30 @@ MU_TEST(flipper_format_oddities_test) {
     mu_assert(test_read(test_file_linux), "Read test error [Oddities]");
 }
 
+MU_TEST(flipper_format_key_index_test) {
+    mu_assert(test_write_dump(TEST_DUMP_FILE), "Dump write test error");
+
+    uint32_t linear_time = 0, index_time = 0, linear_reverse_time = 0, index_reverse_time = 0;
+    mu_assert(test_read_dump(TEST_DUMP_FILE, false, false, &linear_time), "Dump read error");
+    mu_assert(test_read_dump(TEST_DUMP_FILE, true, false, &index_time), "Index read error");
+    mu_assert(
+        test_read_dump(TEST_DUMP_FILE, false, true, &linear_reverse_time),
+        "Dump reverse read error");
+    mu_assert(
+        test_read_dump(TEST_DUMP_FILE, true, true, &index_reverse_time),
+        "Index reverse read error");
+
+    FURI_LOG_I(
+        TAG,
+        "4K dump load, ms: linear %lu, index %lu; reverse order: linear %lu, index %lu",
+        linear_time,
+        index_time,
+        linear_reverse_time,
+        index_reverse_time);
+
+    mu_assert(test_update_dump_with_index(TEST_DUMP_FILE), "Index update test error");
+}
+
 MU_TEST_SUITE(flipper_format) {
     tests_setup();
     MU_RUN_TEST(flipper_format_write_test);
@@ -542,6 +695,7 @@ MU_TEST_SUITE(flipper_format) {
     MU_RUN_TEST(flipper_format_update_2_result_test);
     MU_RUN_TEST(flipper_format_multikey_test);
     MU_RUN_TEST(flipper_format_oddities_test);
+    MU_RUN_TEST(flipper_format_key_index_test);
     tests_teardown();
 }
 
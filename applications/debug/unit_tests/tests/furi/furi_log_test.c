@@ -0,0 +1,187 @@
+#include <furi.h>
+#include "../test.h" // IWYU pragma: keep
+
+#define TEST_LOG_RECORDS 100
+#define TEST_LOG_FRAMES  128
+
+typedef struct {
+    uint8_t (*frames)[FURI_LOG_BINARY_FRAME_SIZE];
+    size_t count;
+    bool text_got_frame;
+} TestLogCapture;
+
+static bool test_log_pack(uint8_t* out, size_t* size, const char* format, ...)
+    _ATTRIBUTE((__format__(__printf__, 3, 4)));
+
+static bool test_log_pack(uint8_t* out, size_t* size, const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    bool result = furi_log_pack_args(out, size, format, args);
+    va_end(args);
+    return result;
+}
+
+void test_furi_log_pack_args(void) {
+    uint8_t out[FURI_LOG_BINARY_ARGS_SIZE];
+    size_t size = 0;
+
+    // 32-bit values and strings
+    mu_assert(test_log_pack(out, &size, "%d %lu %s %c %%", -5, 7UL, "abc", 'x'), "Pack error");
+    mu_assert_int_eq(16, size);
+    int32_t value_i32;
+    uint32_t value_u32;
+    memcpy(&value_i32, &out[0], sizeof(value_i32));
+    mu_assert_int_eq(-5, value_i32);
+    memcpy(&value_u32, &out[4], sizeof(value_u32));
+    mu_assert_int_eq(7, value_u32);
+    mu_assert_mem_eq("abc", &out[8], 4);
+    memcpy(&value_u32, &out[12], sizeof(value_u32));
+    mu_assert_int_eq('x', value_u32);
+
+    // 64-bit values, width and precision arguments
+    size = 0;
+    mu_assert(test_log_pack(out, &size, "%-*.*f %llx", 6, 2, 1.5, 0x1122334455667788ULL), "Pack");
+    mu_assert_int_eq(4 + 4 + 8 + 8, size);
+    int width, precision;
+    double value_double;
+    uint64_t value_u64;
+    memcpy(&width, &out[0], sizeof(width));
+    memcpy(&precision, &out[4], sizeof(precision));
+    memcpy(&value_double, &out[8], sizeof(value_double));
+    memcpy(&value_u64, &out[16], sizeof(value_u64));
+    mu_assert_int_eq(6, width);
+    mu_assert_int_eq(2, precision);
+    mu_assert_double_eq(1.5, value_double);
+    mu_assert(value_u64 == 0x1122334455667788ULL, "64-bit value mismatch");
+
+    // Long string is cut to the space left
+    size = 0;
+    const char* long_string = "0123456789012345678901234567890123456789";
+    mu_assert(!test_log_pack(out, &size, "%lu %s", 1UL, long_string), "No truncation");
+    mu_assert_int_eq(FURI_LOG_BINARY_ARGS_SIZE, size);
+    mu_assert_mem_eq(long_string, &out[4], FURI_LOG_BINARY_ARGS_SIZE - 4 - 1);
+    mu_assert_int_eq(0, out[FURI_LOG_BINARY_ARGS_SIZE - 1]);
+
+    // Packing stops at the first value that doesn't fit
+    size = 0;
+    mu_assert(
+        !test_log_pack(out, &size, "%llu %llu %llu %lu %llu", 1ULL, 2ULL, 3ULL, 4UL, 5ULL),
+        "No truncation");
+    mu_assert_int_eq(28, size);
+}
+
+void test_furi_log_binary_frame(void) {
+    FuriLogBinaryRecord record = {
+        .tick = 0x12345678,
+        .tag = (const char*)0x08001234,
+        .format = (const char*)0x08005678,
+        .level = FuriLogLevelWarn,
+        .flags = FURI_LOG_BINARY_FLAG_TRUNCATED,
+        .args_size = 2,
+        .args = {0xAA, 0x55},
+    };
+    uint8_t frame[FURI_LOG_BINARY_FRAME_SIZE];
+
+    // clang-format off
+    const uint8_t expected[] = {
+        0xFF, 0xF1, 18, // magic, payload size
+        0x78, 0x56, 0x34, 0x12, // tick
+        FuriLogLevelWarn, FURI_LOG_BINARY_FLAG_TRUNCATED, 0x02, 0x01, // level, flags, dropped
+        0x34, 0x12, 0x00, 0x08, // tag
+        0x78, 0x56, 0x00, 0x08, // format
+        0xAA, 0x55, // args
+        0x00, // sum
+    };
+    // clang-format on
+    mu_assert_int_eq(sizeof(expected), furi_log_binary_frame(&record, 0x0102, frame));
+
+    uint8_t sum = 0;
+    for(size_t i = 3; i < sizeof(expected) - 1; i++) {
+        sum += expected[i];
+    }
+    mu_assert_mem_eq(expected, frame, sizeof(expected) - 1);
+    mu_assert_int_eq(sum, frame[sizeof(expected) - 1]);
+
+    // Args that don't fit in the frame
+    record.args_size = FURI_LOG_BINARY_ARGS_SIZE;
+    mu_assert_int_eq(FURI_LOG_BINARY_FRAME_SIZE, furi_log_binary_frame(&record, 0, frame));
+}
+
+static void test_log_session_callback(const uint8_t* data, size_t size, void* context) {
+    TestLogCapture* capture = context;
+    if(capture->count < TEST_LOG_FRAMES && size <= FURI_LOG_BINARY_FRAME_SIZE) {
+        memcpy(capture->frames[capture->count++], data, size);
+    }
+}
+
+static void test_log_text_callback(const uint8_t* data, size_t size, void* context) {
+    TestLogCapture* capture = context;
+    if(memchr(data, 0xFF, size)) capture->text_got_frame = true;
+}
+
+void test_furi_log_deferred(void) {
+    // Deferred records need tag and format in the firmware image, level names are there
+    const char* tag;
+    const char* format;
+    mu_assert(furi_log_level_to_string(FuriLogLevelInfo, &tag), "No tag");
+    mu_assert(furi_log_level_to_string(FuriLogLevelDebug, &format), "No format");
+
+    TestLogCapture capture = {.frames = malloc(TEST_LOG_FRAMES * FURI_LOG_BINARY_FRAME_SIZE)};
+    const FuriLogHandler session = {.callback = test_log_session_callback, .context = &capture};
+    const FuriLogHandler text = {.callback = test_log_text_callback, .context = &capture};
+    const FuriLogLevel level = furi_log_get_level();
+    furi_log_set_level(FuriLogLevelInfo);
+
+    furi_log_add_handler(text);
+    bool started = furi_log_deferred_start(session);
+    bool deferred = furi_log_is_deferred();
+    bool restarted = furi_log_deferred_start(session);
+
+    // Drain thread has the lowest priority, ring overflows before it runs
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-security"
+    for(size_t i = 0; i < TEST_LOG_RECORDS; i++) {
+        furi_log_print_format(FuriLogLevelInfo, tag, format);
+    }
+#pragma GCC diagnostic pop
+
+    furi_log_deferred_stop();
+    furi_log_remove_handler(text);
+    furi_log_set_level(level);
+
+    size_t records = 0;
+    size_t dropped = 0;
+    bool frames_valid = true;
+    for(size_t i = 0; i < capture.count; i++) {
+        const uint8_t* frame = capture.frames[i];
+        const uint8_t* payload = &frame[3];
+        uint8_t sum = 0;
+        for(size_t j = 0; j < frame[2]; j++) {
+            sum += payload[j];
+        }
+        frames_valid &= frame[0] == 0xFF && frame[1] == 0xF1 && payload[frame[2]] == sum;
+
+        uint16_t frame_dropped;
+        uint32_t frame_tag, frame_format;
+        memcpy(&frame_dropped, &payload[6], sizeof(frame_dropped));
+        memcpy(&frame_tag, &payload[8], sizeof(frame_tag));
+        memcpy(&frame_format, &payload[12], sizeof(frame_format));
+        dropped += frame_dropped;
+        if(frame_tag == (uint32_t)tag && frame_format == (uint32_t)format) {
+            frames_valid &= payload[4] == FuriLogLevelInfo && frame[2] == 16;
+            records++;
+        }
+    }
+    free(capture.frames);
+
+    mu_assert(started, "Unable to start");
+    mu_assert(deferred, "Not deferred");
+    mu_assert(!restarted, "Second session started");
+    mu_assert(!furi_log_is_deferred(), "Still deferred");
+    mu_assert(frames_valid, "Invalid frame");
+    mu_assert(!capture.text_got_frame, "Text handler got a frame");
+    mu_assert(records > 0, "No records");
+    mu_assert(records < TEST_LOG_RECORDS, "Nothing dropped");
+    // Other threads can take ring slots too
+    mu_assert(records + dropped >= TEST_LOG_RECORDS, "Lost records");
+}
@@ -1,9 +1,16 @@
 #include "../test.h" // IWYU pragma: keep
+#include <furi.h>
+#include <furi_hal.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
 #include <stdint.h>
 
+#define TAG "MemmgrTest"
+
+#define TEST_MEMMGR_TRACE_SLOTS      96
+#define TEST_MEMMGR_TRACE_OPERATIONS 4000
+
 void test_furi_memmgr(void) {
     void* ptr;
 
@@ -37,3 +44,130 @@ void test_furi_memmgr(void) {
     }
     free(ptr);
 }
+
+void test_furi_memmgr_pools(void) {
+    const size_t pool_count = memmgr_heap_get_pool_count();
+    mu_check(pool_count > 0);
+
+    MemmgrHeapPoolStats stats;
+    size_t previous_block_size = 0;
+    for(size_t i = 0; i < pool_count; i++) {
+        memmgr_heap_get_pool_stats(i, &stats);
+        mu_check(stats.block_size > previous_block_size);
+        mu_check(stats.used_block_count <= stats.block_count);
+        mu_check(stats.used_block_count <= stats.peak_used_block_count);
+        previous_block_size = stats.block_size;
+    }
+
+    // allocations up to the smallest pool block size are served by the pool
+    memmgr_heap_get_pool_stats(0, &stats);
+    const size_t small_size = stats.block_size;
+    void* small[20];
+
+    for(size_t i = 0; i < COUNT_OF(small); i++) {
+        small[i] = malloc(small_size);
+    }
+    MemmgrHeapPoolStats stats_after;
+    memmgr_heap_get_pool_stats(0, &stats_after);
+    mu_check(stats_after.alloc_count - stats.alloc_count >= COUNT_OF(small));
+    mu_check(stats_after.used_block_count >= COUNT_OF(small));
+
+    for(size_t i = 0; i < COUNT_OF(small); i++) {
+        for(size_t j = 0; j < small_size; j++) {
+            mu_assert_int_eq(0, ((uint8_t*)small[i])[j]);
+        }
+        memset(small[i], 0xA5, small_size);
+    }
+    for(size_t i = 0; i < COUNT_OF(small); i++) {
+        free(small[i]);
+    }
+
+    // freed pool block comes back zeroed
+    uint8_t* block = malloc(small_size);
+    for(size_t j = 0; j < small_size; j++) {
+        mu_assert_int_eq(0, block[j]);
+    }
+    free(block);
+}
+
+typedef struct {
+    uint8_t* ptr;
+    uint16_t size;
+    uint16_t lifetime;
+} TestMemmgrTraceSlot;
+
+static uint32_t test_furi_memmgr_trace_random(uint32_t* state) {
+    *state = *state * 1664525 + 1013904223;
+    return *state >> 8;
+}
+
+static uint16_t test_furi_memmgr_trace_size(uint32_t* state) {
+    // mostly small short lived objects with some bigger buffers in between
+    const uint32_t kind = test_furi_memmgr_trace_random(state) % 16;
+    if(kind < 12) return 1 + test_furi_memmgr_trace_random(state) % 128;
+    if(kind < 15) return 129 + test_furi_memmgr_trace_random(state) % 384;
+    return 512 + test_furi_memmgr_trace_random(state) % 1536;
+}
+
+static bool test_furi_memmgr_trace_check(const TestMemmgrTraceSlot* slot, uint8_t pattern) {
+    for(size_t i = 0; i < slot->size; i++) {
+        if(slot->ptr[i] != pattern) return false;
+    }
+    return true;
+}
+
+void test_furi_memmgr_trace(void) {
+    TestMemmgrTraceSlot* slots = malloc(sizeof(TestMemmgrTraceSlot) * TEST_MEMMGR_TRACE_SLOTS);
+    uint32_t state = 0x5EED;
+    uint32_t cycles = 0;
+    uint32_t operations = 0;
+    const size_t max_block_before = memmgr_heap_get_max_free_block();
+
+    // replay synthetic allocation trace: every step ages all objects, expired
+    // objects are checked and freed, then a new object is put in a free slot
+    for(size_t step = 0; step < TEST_MEMMGR_TRACE_OPERATIONS; step++) {
+        for(size_t i = 0; i < TEST_MEMMGR_TRACE_SLOTS; i++) {
+            TestMemmgrTraceSlot* slot = &slots[i];
+            if(!slot->ptr || --slot->lifetime) continue;
+
+            mu_check(test_furi_memmgr_trace_check(slot, (uint8_t)i));
+            uint32_t start = DWT->CYCCNT;
+            free(slot->ptr);
+            cycles += DWT->CYCCNT - start;
+            operations++;
+            slot->ptr = NULL;
+        }
+
+        const size_t index = test_furi_memmgr_trace_random(&state) % TEST_MEMMGR_TRACE_SLOTS;
+        TestMemmgrTraceSlot* slot = &slots[index];
+        if(slot->ptr) continue;
+
+        slot->size = test_furi_memmgr_trace_size(&state);
+        slot->lifetime = 1 + test_furi_memmgr_trace_random(&state) % 64;
+        uint32_t start = DWT->CYCCNT;
+        slot->ptr = malloc(slot->size);
+        cycles += DWT->CYCCNT - start;
+        operations++;
+
+        mu_check(test_furi_memmgr_trace_check(slot, 0));
+        memset(slot->ptr, (uint8_t)index, slot->size);
+    }
+
+    const size_t max_block_peak = memmgr_heap_get_max_free_block();
+
+    for(size_t i = 0; i < TEST_MEMMGR_TRACE_SLOTS; i++) {
+        if(!slots[i].ptr) continue;
+        mu_check(test_furi_memmgr_trace_check(&slots[i], (uint8_t)i));
+        free(slots[i].ptr);
+    }
+    free(slots);
+
+    FURI_LOG_I(
+        TAG,
+        "Trace: %lu ops, %lu cycles/op, max free block %zu -> %zu -> %zu",
+        operations,
+        operations ? cycles / operations : 0,
+        max_block_before,
+        max_block_peak,
+        memmgr_heap_get_max_free_block());
+}
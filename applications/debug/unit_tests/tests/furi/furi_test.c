@@ -7,8 +7,13 @@ void test_furi_create_open(void);
 void test_furi_concurrent_access(void);
 void test_furi_pubsub(void);
 void test_furi_memmgr(void);
+void test_furi_memmgr_pools(void);
+void test_furi_memmgr_trace(void);
 void test_furi_event_loop(void);
 void test_errno_saving(void);
+void test_furi_log_pack_args(void);
+void test_furi_log_binary_frame(void);
+void test_furi_log_deferred(void);
 
 static int foo = 0;
 
@@ -39,6 +44,14 @@ MU_TEST(mu_test_furi_memmgr) {
     test_furi_memmgr();
 }
 
+MU_TEST(mu_test_furi_memmgr_pools) {
+    test_furi_memmgr_pools();
+}
+
+MU_TEST(mu_test_furi_memmgr_trace) {
+    test_furi_memmgr_trace();
+}
+
 MU_TEST(mu_test_furi_event_loop) {
     test_furi_event_loop();
 }
@@ -47,6 +60,18 @@ MU_TEST(mu_test_errno_saving) {
     test_errno_saving();
 }
 
+MU_TEST(mu_test_furi_log_pack_args) {
+    test_furi_log_pack_args();
+}
+
+MU_TEST(mu_test_furi_log_binary_frame) {
+    test_furi_log_binary_frame();
+}
+
+MU_TEST(mu_test_furi_log_deferred) {
+    test_furi_log_deferred();
+}
+
 MU_TEST_SUITE(test_suite) {
     MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
     MU_RUN_TEST(test_check);
@@ -55,8 +80,13 @@ MU_TEST_SUITE(test_suite) {
     MU_RUN_TEST(mu_test_furi_create_open);
     MU_RUN_TEST(mu_test_furi_pubsub);
     MU_RUN_TEST(mu_test_furi_memmgr);
+    MU_RUN_TEST(mu_test_furi_memmgr_pools);
+    MU_RUN_TEST(mu_test_furi_memmgr_trace);
     MU_RUN_TEST(mu_test_furi_event_loop);
     MU_RUN_TEST(mu_test_errno_saving);
+    MU_RUN_TEST(mu_test_furi_log_pack_args);
+    MU_RUN_TEST(mu_test_furi_log_binary_frame);
+    MU_RUN_TEST(mu_test_furi_log_deferred);
 }
 
 int run_minunit_test_furi(void) {
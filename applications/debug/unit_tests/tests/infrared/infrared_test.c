@@ -1,4 +1,5 @@
 #include <furi.h>
+#include <furi_hal.h>
 #include <flipper_format.h>
 #include <infrared.h>
 #include <common/infrared_common_i.h>
@@ -8,6 +9,22 @@
 #define IR_TEST_FILE_PREFIX "test_"
 #define IR_TEST_FILE_SUFFIX ".irtest"
 
+#define TAG "InfraredTest"
+
+static const char* const infrared_test_bench_files[] = {
+    EXT_PATH("infrared/assets/tv.ir"),
+    EXT_PATH("infrared/assets/ac.ir"),
+    EXT_PATH("infrared/assets/audio.ir"),
+    EXT_PATH("infrared/assets/projector.ir"),
+};
+
+typedef struct {
+    uint32_t pulses;
+    uint32_t messages;
+    uint32_t checksum;
+    uint32_t cycles;
+} InfraredTestBenchResult;
+
 typedef struct {
     InfraredDecoderHandler* decoder_handler;
     InfraredEncoderHandler* encoder_handler;
@@ -523,6 +540,93 @@ MU_TEST(infrared_test_encoder_decoder_all) {
     infrared_test_run_encoder_decoder(InfraredProtocolPioneer, 1);
 }
 
+static void
+    infrared_test_bench_account(InfraredTestBenchResult* result, const InfraredMessage* m) {
+    result->messages++;
+    result->checksum = result->checksum * 31 + m->protocol;
+    result->checksum = result->checksum * 31 + m->address;
+    result->checksum = result->checksum * 31 + m->command;
+    result->checksum = result->checksum * 31 + m->repeat;
+}
+
+static void infrared_test_bench_replay(
+    bool fused,
+    const uint32_t* timings,
+    uint32_t timings_count,
+    InfraredTestBenchResult* result) {
+    infrared_set_decoder_fused(test->decoder_handler, fused);
+
+    const InfraredMessage* message;
+    bool level = true;
+    uint32_t start = DWT->CYCCNT;
+    for(uint32_t i = 0; i < timings_count; ++i) {
+        message = infrared_decode(test->decoder_handler, level, timings[i]);
+        if(message) infrared_test_bench_account(result, message);
+        level = !level;
+    }
+    message = infrared_check_decoder_ready(test->decoder_handler);
+    result->cycles += DWT->CYCCNT - start;
+
+    if(message) infrared_test_bench_account(result, message);
+    result->pulses += timings_count;
+}
+
+static uint32_t infrared_test_bench_pulses_per_second(const InfraredTestBenchResult* result) {
+    if(!result->cycles) return 0;
+    return (uint64_t)result->pulses * SystemCoreClock / result->cycles;
+}
+
+MU_TEST(infrared_test_decoder_assets_benchmark) {
+    FuriString* buf = furi_string_alloc();
+
+    for(size_t i = 0; i < COUNT_OF(infrared_test_bench_files); ++i) {
+        const char* path = infrared_test_bench_files[i];
+        InfraredTestBenchResult plain = {0};
+        InfraredTestBenchResult fused = {0};
+
+        mu_assert(
+            flipper_format_buffered_file_open_existing(test->ff, path), "Failed to open assets");
+
+        while(flipper_format_read_string(test->ff, "name", buf)) {
+            if(!flipper_format_read_string(test->ff, "type", buf)) break;
+            if(furi_string_cmp_str(buf, "raw")) continue;
+
+            uint32_t timings_count = 0;
+            mu_assert(
+                flipper_format_get_value_count(test->ff, "data", &timings_count),
+                "Failed to read raw signal");
+            if(!timings_count) continue;
+
+            uint32_t* timings = malloc(timings_count * sizeof(uint32_t));
+            mu_assert(
+                flipper_format_read_uint32(test->ff, "data", timings, timings_count),
+                "Failed to read raw signal");
+
+            infrared_test_bench_replay(false, timings, timings_count, &plain);
+            infrared_test_bench_replay(true, timings, timings_count, &fused);
+            free(timings);
+        }
+
+        flipper_format_buffered_file_close(test->ff);
+
+        mu_assert(plain.pulses > 0, "No raw signals in assets");
+        mu_assert(plain.messages == fused.messages, "Fused decoder result mismatch");
+        mu_assert(plain.checksum == fused.checksum, "Fused decoder result mismatch");
+
+        FURI_LOG_I(
+            TAG,
+            "%s: %lu pulses, %lu messages, %lu -> %lu pulses/s",
+            path,
+            plain.pulses,
+            plain.messages,
+            infrared_test_bench_pulses_per_second(&plain),
+            infrared_test_bench_pulses_per_second(&fused));
+    }
+
+    infrared_set_decoder_fused(test->decoder_handler, true);
+    furi_string_free(buf);
+}
+
 MU_TEST_SUITE(infrared_test) {
     MU_SUITE_CONFIGURE(&infrared_test_alloc, &infrared_test_free);
 
@@ -543,6 +647,7 @@ MU_TEST_SUITE(infrared_test) {
     MU_RUN_TEST(infrared_test_decoder_pioneer);
     MU_RUN_TEST(infrared_test_decoder_mixed);
     MU_RUN_TEST(infrared_test_encoder_decoder_all);
+    MU_RUN_TEST(infrared_test_decoder_assets_benchmark);
 }
 
 int run_minunit_test_infrared(void) {
@@ -20,8 +20,10 @@
 #include <nfc/protocols/slix/slix_i.h>
 #include <nfc/protocols/slix/slix_poller.h>
 #include <nfc/protocols/slix/slix_poller_i.h>
+#include <nfc/helpers/crypto1.h>
 
 #include <nfc/nfc_poller.h>
+#include <nfc/nfc_scanner.h>
 
 #include <toolbox/keys_dict.h>
 #include <nfc/nfc.h>
@@ -35,6 +37,8 @@
 
 #define NFC_TEST_FLAG_WORKER_DONE (1)
 
+#define NFC_TEST_SCANNER_TIMEOUT_MS (5000)
+
 typedef enum {
     NfcTestMfClassicSendFrameTestStateAuth,
     NfcTestMfClassicSendFrameTestStateReadBlock,
@@ -63,6 +67,12 @@ typedef struct {
     SlixError error;
 } NfcTestSlixPollerSetPasswordContext;
 
+typedef struct {
+    FuriThreadId thread_id;
+    size_t protocol_num;
+    NfcProtocol protocols[NfcProtocolNum];
+} NfcTestScannerContext;
+
 typedef struct {
     Storage* storage;
 } NfcTest;
@@ -583,6 +593,93 @@ MU_TEST(mf_classic_send_frame_test) {
     nfc_free(poller);
 }
 
+static uint64_t crypto1_test_random_key(void) {
+    uint64_t key = 0;
+    furi_hal_random_fill_buf((uint8_t*)&key, 6);
+    return key;
+}
+
+static uint8_t crypto1_test_byte_bitwise(Crypto1* crypto1, uint8_t in, int is_encrypted) {
+    uint8_t out = 0;
+    for(uint8_t i = 0; i < 8; i++) {
+        out |= crypto1_bit(crypto1, FURI_BIT(in, i), is_encrypted) << i;
+    }
+    return out;
+}
+
+static uint32_t crypto1_test_word_bitwise(Crypto1* crypto1, uint32_t in, int is_encrypted) {
+    uint32_t out = 0;
+    for(uint8_t i = 0; i < 32; i++) {
+        out |= (uint32_t)crypto1_bit(crypto1, FURI_BIT(in, i ^ 24), is_encrypted) << (24 ^ i);
+    }
+    return out;
+}
+
+MU_TEST(crypto1_table_test) {
+    for(size_t i = 0; i < 1000; i++) {
+        Crypto1 crypto_table;
+        Crypto1 crypto_bitwise;
+        crypto1_init(&crypto_table, crypto1_test_random_key());
+        crypto_bitwise = crypto_table;
+
+        for(size_t j = 0; j < 4; j++) {
+            int is_encrypted = j % 2;
+            uint32_t in = furi_hal_random_get();
+            mu_assert(
+                crypto1_word(&crypto_table, in, is_encrypted) ==
+                    crypto1_test_word_bitwise(&crypto_bitwise, in, is_encrypted),
+                "Wrong word keystream");
+            mu_assert(
+                crypto1_byte(&crypto_table, in, is_encrypted) ==
+                    crypto1_test_byte_bitwise(&crypto_bitwise, in, is_encrypted),
+                "Wrong byte keystream");
+            mu_assert(crypto_table.odd == crypto_bitwise.odd, "Wrong odd state");
+            mu_assert(crypto_table.even == crypto_bitwise.even, "Wrong even state");
+        }
+    }
+}
+
+MU_TEST(crypto1_batch_test) {
+    Crypto1Batch* batch = malloc(sizeof(Crypto1Batch));
+    Crypto1* crypto = malloc(sizeof(Crypto1) * CRYPTO1_BATCH_SIZE);
+    uint64_t* keys = malloc(sizeof(uint64_t) * CRYPTO1_BATCH_SIZE);
+    uint32_t* out = malloc(sizeof(uint32_t) * CRYPTO1_BATCH_SIZE);
+
+    for(size_t i = 0; i < 50; i++) {
+        // Check partially filled batches as well
+        size_t key_count = 1 + i % CRYPTO1_BATCH_SIZE;
+        for(size_t lane = 0; lane < key_count; lane++) {
+            keys[lane] = crypto1_test_random_key();
+            crypto1_init(&crypto[lane], keys[lane]);
+        }
+        crypto1_batch_init(batch, keys, key_count);
+
+        for(size_t j = 0; j < 3; j++) {
+            int is_encrypted = j % 2;
+            uint32_t in = furi_hal_random_get();
+            crypto1_batch_word(batch, in, is_encrypted, out);
+            for(size_t lane = 0; lane < key_count; lane++) {
+                mu_assert(
+                    out[lane] == crypto1_word(&crypto[lane], in, is_encrypted),
+                    "Wrong batch keystream");
+            }
+        }
+
+        uint32_t in = furi_hal_random_get();
+        uint32_t out_bits = crypto1_batch_bit(batch, in, 1);
+        for(size_t lane = 0; lane < key_count; lane++) {
+            mu_assert(
+                FURI_BIT(out_bits, lane) == crypto1_bit(&crypto[lane], FURI_BIT(in, lane), 1),
+                "Wrong batch bit");
+        }
+    }
+
+    free(out);
+    free(keys);
+    free(crypto);
+    free(batch);
+}
+
 MU_TEST(mf_classic_dict_test) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
     if(storage_common_stat(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, NULL) == FSE_OK) {
@@ -644,12 +741,36 @@ MU_TEST(mf_classic_dict_test) {
         dict_keys_total == test_key_num - COUNT_OF(delete_keys_idx),
         "keys_dict_keys_total() failed");
 
+    keys_dict_free(dict);
+
+    // Text changed after deletion, so the index must be rebuilt on the next open
+    dict = keys_dict_alloc(
+        NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH, KeysDictModeOpenExisting, sizeof(MfClassicKey));
+    mu_assert(dict != NULL, "keys_dict_alloc() failed");
+
+    dict_keys_total = keys_dict_get_total_keys(dict);
+    mu_assert(
+        dict_keys_total == test_key_num - COUNT_OF(delete_keys_idx),
+        "keys_dict_keys_total() failed");
+
+    for(size_t i = 0; i < test_key_num; i++) {
+        bool deleted = false;
+        for(size_t j = 0; j < COUNT_OF(delete_keys_idx); j++) {
+            if(delete_keys_idx[j] == i) deleted = true;
+        }
+        mu_assert(
+            keys_dict_is_key_present(dict, key_arr_ref[i].data, sizeof(MfClassicKey)) !=
+                deleted,
+            "keys_dict_is_key_present() failed");
+    }
+
     keys_dict_free(dict);
     free(key_arr_ref);
 
     mu_assert(
         storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH),
         "Remove test dict failed");
+    storage_simply_remove(storage, NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH ".idx");
 }
 
 static FelicaError
@@ -823,6 +944,108 @@ MU_TEST(slix_set_password_access_all_passwords_cap) {
         EXT_PATH("unit_tests/nfc/Slix_cap_accept_all_pass.nfc"), 0x12341234, false);
 }
 
+static void nfc_test_scanner_callback(NfcScannerEvent event, void* context) {
+    NfcTestScannerContext* scanner_ctx = context;
+
+    if(event.type == NfcScannerEventTypeDetected) {
+        scanner_ctx->protocol_num = event.data.protocol_num;
+        memcpy(
+            scanner_ctx->protocols,
+            event.data.protocols,
+            event.data.protocol_num * sizeof(NfcProtocol));
+        furi_thread_flags_set(scanner_ctx->thread_id, NFC_TEST_FLAG_WORKER_DONE);
+    }
+}
+
+static void nfc_test_scanner_scan(const SlixData* slix_data, NfcScannerStats* stats) {
+    Nfc* poller = nfc_alloc();
+    Nfc* listener = nfc_alloc();
+
+    NfcListener* slix_listener = nfc_listener_alloc(listener, NfcProtocolSlix, slix_data);
+    nfc_listener_start(slix_listener, NULL, NULL);
+
+    NfcTestScannerContext scanner_ctx = {.thread_id = furi_thread_get_current_id()};
+    NfcScanner* scanner = nfc_scanner_alloc(poller);
+    nfc_scanner_start(scanner, nfc_test_scanner_callback, &scanner_ctx);
+
+    uint32_t flag = furi_thread_flags_wait(
+        NFC_TEST_FLAG_WORKER_DONE, FuriFlagWaitAny, NFC_TEST_SCANNER_TIMEOUT_MS);
+
+    nfc_scanner_stop(scanner);
+    nfc_scanner_free(scanner);
+    // Detection is reported repeatedly until the scanner is stopped
+    furi_thread_flags_clear(NFC_TEST_FLAG_WORKER_DONE);
+
+    nfc_listener_stop(slix_listener);
+    nfc_listener_free(slix_listener);
+    nfc_free(listener);
+    nfc_free(poller);
+
+    mu_assert(flag == NFC_TEST_FLAG_WORKER_DONE, "Scanner timeout");
+
+    bool slix_detected = false;
+    for(size_t i = 0; i < scanner_ctx.protocol_num; i++) {
+        slix_detected |= scanner_ctx.protocols[i] == NfcProtocolSlix;
+    }
+    mu_assert(slix_detected, "Slix not detected");
+
+    nfc_scanner_get_stats(stats);
+}
+
+MU_TEST(nfc_scanner_adaptive_order_test) {
+    NfcDevice* nfc_device = nfc_device_alloc();
+    mu_assert(
+        nfc_device_load(nfc_device, EXT_PATH("unit_tests/nfc/Slix_cap_default.nfc")),
+        "nfc_device_load() failed\r\n");
+    const SlixData* slix_data = nfc_device_get_data(nfc_device, NfcProtocolSlix);
+
+    NfcScannerStats first_stats = {};
+    NfcScannerStats second_stats = {};
+    NfcScannerProtocolStats* protocol_stats =
+        malloc(NfcProtocolNum * sizeof(NfcScannerProtocolStats));
+
+    nfc_scanner_reset_stats();
+    nfc_test_scanner_scan(slix_data, &first_stats);
+    nfc_test_scanner_scan(slix_data, &second_stats);
+    for(size_t i = 0; i < NfcProtocolNum; i++) {
+        nfc_scanner_get_protocol_stats(i, &protocol_stats[i]);
+    }
+    // Scanner order of other tests and applications doesn't depend on this test
+    nfc_scanner_reset_stats();
+    nfc_device_free(nfc_device);
+
+    FURI_LOG_I(
+        TAG,
+        "First scan: %lu misses, %lu ms. Second scan: %lu misses, %lu ms",
+        first_stats.last_scan_misses,
+        first_stats.last_scan_detection_time,
+        second_stats.last_scan_misses,
+        second_stats.last_scan_detection_time);
+
+    bool histograms_match = true;
+    for(size_t i = 0; i < NfcProtocolNum; i++) {
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+        for(size_t j = 0; j < NFC_SCANNER_LATENCY_BUCKETS; j++) {
+            hits += protocol_stats[i].hit_latency[j];
+            misses += protocol_stats[i].miss_latency[j];
+        }
+        histograms_match &= protocol_stats[i].detections == hits &&
+                            protocol_stats[i].attempts == hits + misses;
+    }
+    const uint32_t iso15693_3_detections = protocol_stats[NfcProtocolIso15693_3].detections;
+    const uint32_t slix_detections = protocol_stats[NfcProtocolSlix].detections;
+    free(protocol_stats);
+
+    // ISO15693 goes after ISO14443 protocols by default, and first once detected
+    mu_assert_int_eq(2, second_stats.scans);
+    mu_assert(first_stats.last_scan_misses > 0, "ISO15693 was tried first");
+    mu_assert_int_eq(0, second_stats.last_scan_misses);
+    mu_assert_int_eq(2, iso15693_3_detections);
+    mu_assert_int_eq(2, slix_detections);
+    mu_assert(histograms_match, "Latency histograms don't match attempts");
+}
+
 MU_TEST_SUITE(nfc) {
     nfc_test_alloc();
 
@@ -864,6 +1087,8 @@ MU_TEST_SUITE(nfc) {
     MU_RUN_TEST(mf_classic_value_block);
     MU_RUN_TEST(mf_classic_send_frame_test);
     MU_RUN_TEST(mf_classic_dict_test);
+    MU_RUN_TEST(crypto1_table_test);
+    MU_RUN_TEST(crypto1_batch_test);
     MU_RUN_TEST(felica_read);
     MU_RUN_TEST(felica_read_auth);
 
@@ -872,6 +1097,8 @@ MU_TEST_SUITE(nfc) {
     MU_RUN_TEST(slix_set_password_default_cap_incorrect_pass);
     MU_RUN_TEST(slix_set_password_access_all_passwords_cap);
 
+    MU_RUN_TEST(nfc_scanner_adaptive_order_test);
+
     nfc_test_free();
 }
 
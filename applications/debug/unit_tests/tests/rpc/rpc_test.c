@@ -1093,6 +1093,100 @@ MU_TEST(test_storage_write) {
     test_storage_write_run(TEST_DIR "test2.txt", 512, 3, ++command_id, PB_CommandStatus_OK);
 }
 
+#define TEST_THROUGHPUT_SIZE (64u * 1024)
+
+static uint8_t test_storage_throughput_byte(size_t offset) {
+    return (offset * 7) ^ (offset >> 8);
+}
+
+static uint32_t test_storage_throughput_write(const char* path, uint32_t command_id) {
+    MsgList_t expected_msg_list;
+    MsgList_init(expected_msg_list);
+    test_rpc_add_empty_to_list(expected_msg_list, PB_CommandStatus_OK, command_id);
+
+    const uint32_t start = furi_get_tick();
+    for(size_t offset = 0; offset < TEST_THROUGHPUT_SIZE; offset += MAX_DATA_SIZE) {
+        PB_Main request = {.cb_content.funcs.encode = NULL};
+        test_rpc_fill_basic_message(&request, PB_Main_storage_write_request_tag, command_id);
+        request.has_next = (offset + MAX_DATA_SIZE < TEST_THROUGHPUT_SIZE);
+        request.content.storage_write_request.path = strdup(path);
+        request.content.storage_write_request.has_file = true;
+
+        PB_Storage_File* msg_file = &request.content.storage_write_request.file;
+        msg_file->data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(MAX_DATA_SIZE));
+        msg_file->data->size = MAX_DATA_SIZE;
+        for(size_t i = 0; i < MAX_DATA_SIZE; i++) {
+            msg_file->data->bytes[i] = test_storage_throughput_byte(offset + i);
+        }
+
+        test_rpc_encode_and_feed_one(&request, 0);
+    }
+    test_rpc_decode_and_compare(expected_msg_list, 0);
+    const uint32_t elapsed = furi_get_tick() - start;
+
+    test_rpc_free_msg_list(expected_msg_list);
+    return elapsed;
+}
+
+static uint32_t test_storage_throughput_read(const char* path, uint32_t command_id) {
+    PB_Main request;
+    test_rpc_create_simple_message(&request, PB_Main_storage_read_request_tag, path, command_id);
+
+    pb_istream_t istream = {
+        .callback = test_rpc_pb_stream_read,
+        .state = &rpc_session[0],
+        .errmsg = NULL,
+        .bytes_left = 0x7FFFFFFF,
+    };
+    PB_Main result = {.cb_content.funcs.decode = NULL};
+    size_t offset = 0;
+    bool has_next = true;
+
+    const uint32_t start = furi_get_tick();
+    test_rpc_encode_and_feed_one(&request, 0);
+    while(has_next) {
+        rpc_session[0].timeout = furi_get_tick() + MAX_RECEIVE_OUTPUT_TIMEOUT;
+        if(!pb_decode_ex(&istream, &PB_Main_msg, &result, PB_DECODE_DELIMITED)) {
+            mu_fail("read response not received");
+            break;
+        }
+
+        mu_assert_int_eq(command_id, result.command_id);
+        mu_assert_int_eq(PB_CommandStatus_OK, result.command_status);
+        mu_assert_int_eq(PB_Main_storage_read_response_tag, result.which_content);
+        const pb_bytes_array_t* data = result.content.storage_read_response.file.data;
+        mu_check(data && (offset + data->size <= TEST_THROUGHPUT_SIZE));
+        for(size_t i = 0; i < data->size; i++) {
+            if(data->bytes[i] != test_storage_throughput_byte(offset + i)) {
+                mu_fail("read data mismatch");
+                break;
+            }
+        }
+        offset += data->size;
+        has_next = result.has_next;
+        pb_release(&PB_Main_msg, &result);
+    }
+    const uint32_t elapsed = furi_get_tick() - start;
+
+    mu_assert_int_eq(TEST_THROUGHPUT_SIZE, offset);
+    pb_release(&PB_Main_msg, &request);
+    return elapsed;
+}
+
+MU_TEST(test_storage_throughput) {
+    const char* path = TEST_DIR "throughput.bin";
+
+    const uint32_t write_time = MAX(test_storage_throughput_write(path, ++command_id), 1UL);
+    const uint32_t read_time = MAX(test_storage_throughput_read(path, ++command_id), 1UL);
+
+    FURI_LOG_I(
+        TAG,
+        "%u bytes: write %lu KiB/s, read %lu KiB/s",
+        TEST_THROUGHPUT_SIZE,
+        TEST_THROUGHPUT_SIZE * 1000UL / 1024 / write_time,
+        TEST_THROUGHPUT_SIZE * 1000UL / 1024 / read_time);
+}
+
 MU_TEST(test_storage_interrupt_continuous_same_system) {
     MsgList_t input_msg_list;
     MsgList_init(input_msg_list);
@@ -1502,6 +1596,7 @@ MU_TEST_SUITE(test_rpc_storage) {
     MU_RUN_TEST(test_storage_mkdir);
     MU_RUN_TEST(test_storage_md5sum);
     MU_RUN_TEST(test_storage_rename);
+    MU_RUN_TEST(test_storage_throughput);
 
     DISABLE_TEST(MU_RUN_TEST(test_storage_interrupt_continuous_same_system););
     MU_RUN_TEST(test_storage_interrupt_continuous_another_system);
@@ -259,10 +259,85 @@ MU_TEST(storage_dir_exists_test) {
     furi_record_close(RECORD_STORAGE);
 }
 
+#define STORAGE_BATCH_TEST_FILES 20
+
+MU_TEST(storage_batch_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    FuriString* paths[STORAGE_BATCH_TEST_FILES + 1];
+    const char* path_cstrs[STORAGE_BATCH_TEST_FILES + 1];
+
+    mu_assert_int_eq(FSE_OK, storage_common_mkdir(storage, STORAGE_TEST_DIR));
+    for(size_t i = 0; i < COUNT_OF(paths); i++) {
+        paths[i] = furi_string_alloc_printf("%s/file_%02zu", STORAGE_TEST_DIR, i);
+        path_cstrs[i] = furi_string_get_cstr(paths[i]);
+        // The last one is not created
+        if(i < STORAGE_BATCH_TEST_FILES) {
+            mu_check(storage_file_create(storage, path_cstrs[i], "0123456789"));
+        }
+    }
+
+    // Batches are limited by the entry count and by the name buffer space
+    StorageDirEntry entries[8];
+    char* names = malloc(3 * STORAGE_DIR_BATCH_NAME_SIZE);
+    size_t total = 0, count;
+    mu_check(storage_dir_open(file, STORAGE_TEST_DIR));
+    while((count = storage_dir_read_batch(
+               file, entries, COUNT_OF(entries), names, 3 * STORAGE_DIR_BATCH_NAME_SIZE))) {
+        mu_check(count <= COUNT_OF(entries));
+        for(size_t i = 0; i < count; i++) {
+            mu_check(strncmp(entries[i].name, "file_", 5) == 0);
+            mu_assert_int_eq(10, entries[i].fileinfo.size);
+        }
+        total += count;
+    }
+    mu_assert_int_eq(FSE_NOT_EXIST, storage_file_get_error(file));
+    mu_assert_int_eq(STORAGE_BATCH_TEST_FILES, total);
+    storage_dir_close(file);
+
+    // The first name is truncated to fit
+    mu_check(storage_dir_open(file, STORAGE_TEST_DIR));
+    mu_assert_int_eq(1, storage_dir_read_batch(file, entries, COUNT_OF(entries), names, 4));
+    mu_assert_string_eq("fil", entries[0].name);
+    storage_dir_close(file);
+    free(names);
+
+    FS_Error errors[STORAGE_BATCH_TEST_FILES + 1];
+    FileInfo fileinfos[STORAGE_BATCH_TEST_FILES + 1];
+    mu_assert_int_eq(
+        STORAGE_BATCH_TEST_FILES,
+        storage_common_stat_batch(storage, path_cstrs, fileinfos, errors, COUNT_OF(errors)));
+    mu_assert_int_eq(FSE_OK, errors[0]);
+    mu_assert_int_eq(10, fileinfos[0].size);
+    mu_assert_int_eq(FSE_NOT_EXIST, errors[STORAGE_BATCH_TEST_FILES]);
+
+    // Reading stops at the end of the file
+    char head[3] = {0}, middle[5] = {0}, tail[10] = {0};
+    StorageIoVec vector[] = {
+        {.buff = head, .size = sizeof(head)},
+        {.buff = middle, .size = sizeof(middle) - 1},
+        {.buff = tail, .size = sizeof(tail)},
+    };
+    mu_check(storage_file_open(file, path_cstrs[0], FSAM_READ, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(10, storage_file_read_vector(file, vector, COUNT_OF(vector)));
+    storage_file_close(file);
+    mu_check(memcmp(head, "012", 3) == 0);
+    mu_assert_string_eq("3456", middle);
+    mu_assert_string_eq("789", tail);
+
+    for(size_t i = 0; i < COUNT_OF(paths); i++) {
+        furi_string_free(paths[i]);
+    }
+    mu_check(storage_simply_remove_recursive(storage, STORAGE_TEST_DIR));
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(storage_dir) {
     MU_RUN_TEST(storage_dir_open_close);
     MU_RUN_TEST(storage_dir_open_lock);
     MU_RUN_TEST(storage_dir_exists_test);
+    MU_RUN_TEST(storage_batch_test);
 }
 
 static const char* const storage_copy_test_paths[] = {
@@ -738,6 +813,57 @@ MU_TEST(test_md5_calc) {
     furi_record_close(RECORD_STORAGE);
 }
 
+MU_TEST(test_md5_cache) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    const char* path = UNIT_TESTS_PATH("md5_cache.test");
+    // Digests of another directory are kept in another table
+    const char* other_path = EXT_PATH(".tmp/md5_cache.test");
+
+    uint8_t md5_expected[MD5_HASH_SIZE];
+    uint8_t md5_output[MD5_HASH_SIZE];
+
+    storage_simply_remove(storage, path);
+    mu_check(storage_file_create(storage, path, "first"));
+    storage_simply_remove(storage, other_path);
+    mu_check(storage_file_create(storage, other_path, "other"));
+
+    // Calculated, then cached
+    mu_check(md5_calc_file(file, path, md5_expected, NULL));
+    for(size_t i = 0; i < 2; i++) {
+        memset(md5_output, 0, MD5_HASH_SIZE);
+        mu_assert_int_eq(FSE_OK, storage_common_md5(storage, path, md5_output));
+        mu_assert_mem_eq(md5_expected, md5_output, MD5_HASH_SIZE);
+    }
+
+    // Same size and likely the same modification time, only invalidation tells it apart
+    mu_check(storage_file_open(file, path, FSAM_WRITE, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(5, storage_file_write(file, "fresh", 5));
+    mu_check(storage_file_close(file));
+
+    mu_check(md5_calc_file(file, path, md5_expected, NULL));
+    mu_assert_int_eq(FSE_OK, storage_common_md5(storage, path, md5_output));
+    mu_assert_mem_eq(md5_expected, md5_output, MD5_HASH_SIZE);
+
+    // Rewritten while the table of another directory is in use
+    mu_assert_int_eq(FSE_OK, storage_common_md5(storage, other_path, md5_output));
+    mu_check(storage_file_open(file, path, FSAM_WRITE, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(5, storage_file_write(file, "third", 5));
+    mu_check(storage_file_close(file));
+
+    mu_check(md5_calc_file(file, path, md5_expected, NULL));
+    mu_assert_int_eq(FSE_OK, storage_common_md5(storage, path, md5_output));
+    mu_assert_mem_eq(md5_expected, md5_output, MD5_HASH_SIZE);
+
+    mu_check(storage_simply_remove(storage, other_path));
+    mu_check(storage_simply_remove(storage, path));
+    mu_assert_int_eq(FSE_NOT_EXIST, storage_common_md5(storage, path, md5_output));
+    mu_assert_int_eq(FSE_INVALID_NAME, storage_common_md5(storage, "/bad/path", md5_output));
+
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(test_data_path) {
     MU_RUN_TEST(test_storage_data_path);
     MU_RUN_TEST(test_storage_data_path_apps);
@@ -749,6 +875,7 @@ MU_TEST_SUITE(test_storage_common) {
 
 MU_TEST_SUITE(test_md5_calc_suite) {
     MU_RUN_TEST(test_md5_calc);
+    MU_RUN_TEST(test_md5_cache);
 }
 
 int run_minunit_test_storage(void) {
@@ -17,6 +17,20 @@ static const char* stream_test_right_data =
 
 #define FILESTREAM_PATH EXT_PATH(".tmp/unit_tests/filestream.str")
 
+#define TAG "StreamTest"
+
+#define STREAM_BENCH_MAX_LINES   256
+#define STREAM_BENCH_LOOKUPS     200
+#define STREAM_BENCH_READ_LENGTH 16
+#define STREAM_BENCH_BLOCK_SIZE  512U
+
+static const char* const stream_bench_files[] = {
+    EXT_PATH("unit_tests/nfc/Ntag216.nfc"),
+    EXT_PATH("unit_tests/nfc/Felica.nfc"),
+    EXT_PATH("unit_tests/subghz/ansonic_raw.sub"),
+    EXT_PATH("unit_tests/subghz/bett.sub"),
+};
+
 MU_TEST_1(stream_composite_subtest, Stream* stream) {
     const size_t data_size = 128;
     uint8_t data[data_size];
@@ -517,12 +531,112 @@ MU_TEST(stream_buffered_large_file_test) {
     furi_string_free(output_data);
 }
 
+typedef struct {
+    uint32_t ms;
+    BufferedFileStreamCacheStats stats;
+} StreamBenchResult;
+
+// Key lookup pattern of FlipperFormat: go back to the header, then forward to the next key
+static bool stream_bench_run(
+    Storage* storage,
+    const char* path,
+    size_t cache_size,
+    const size_t* line_offsets,
+    size_t line_count,
+    const uint8_t* expected,
+    StreamBenchResult* result) {
+    Stream* stream = buffered_file_stream_alloc_ex(storage, cache_size);
+    bool success = buffered_file_stream_open(stream, path, FSAM_READ, FSOM_OPEN_EXISTING);
+    uint8_t buf[STREAM_BENCH_READ_LENGTH];
+    uint32_t seed = 0xC0FFEE;
+
+    const uint32_t start = furi_get_tick();
+    for(size_t i = 0; success && (i < STREAM_BENCH_LOOKUPS); i++) {
+        seed = seed * 1664525 + 1013904223;
+        const size_t line = (seed >> 8) % line_count;
+
+        success &= stream_seek(stream, line_offsets[0], StreamOffsetFromStart);
+        success &= stream_read(stream, buf, sizeof(buf)) == sizeof(buf);
+        success &= memcmp(buf, expected, sizeof(buf)) == 0;
+
+        success &= stream_seek(stream, line_offsets[line], StreamOffsetFromStart);
+        const size_t size = stream_read(stream, buf, sizeof(buf));
+        success &= memcmp(buf, expected + line * sizeof(buf), size) == 0;
+    }
+    result->ms = furi_get_tick() - start;
+
+    buffered_file_stream_get_cache_stats(stream, &result->stats);
+    stream_free(stream);
+    return success;
+}
+
+MU_TEST(stream_buffered_cache_benchmark_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    size_t* line_offsets = malloc(sizeof(size_t) * STREAM_BENCH_MAX_LINES);
+    uint8_t* expected = malloc(STREAM_BENCH_READ_LENGTH * STREAM_BENCH_MAX_LINES);
+    FuriString* line = furi_string_alloc();
+
+    for(size_t i = 0; i < COUNT_OF(stream_bench_files); i++) {
+        const char* path = stream_bench_files[i];
+
+        // reference data through the plain file stream
+        Stream* stream = file_stream_alloc(storage);
+        mu_check(file_stream_open(stream, path, FSAM_READ, FSOM_OPEN_EXISTING));
+        size_t line_count = 0;
+        while(line_count < STREAM_BENCH_MAX_LINES) {
+            line_offsets[line_count] = stream_tell(stream);
+            if(!stream_read_line(stream, line)) break;
+            line_count++;
+        }
+        for(size_t j = 0; j < line_count; j++) {
+            uint8_t* data = expected + j * STREAM_BENCH_READ_LENGTH;
+            memset(data, 0, STREAM_BENCH_READ_LENGTH);
+            mu_check(stream_seek(stream, line_offsets[j], StreamOffsetFromStart));
+            stream_read(stream, data, STREAM_BENCH_READ_LENGTH);
+        }
+        stream_free(stream);
+        mu_check(line_count > 1);
+
+        // single block cache behaves like the old one buffer cache
+        StreamBenchResult single, multi;
+        mu_check(stream_bench_run(
+            storage, path, STREAM_BENCH_BLOCK_SIZE, line_offsets, line_count, expected, &single));
+        mu_check(stream_bench_run(
+            storage,
+            path,
+            BUFFERED_FILE_STREAM_CACHE_SIZE_DEFAULT,
+            line_offsets,
+            line_count,
+            expected,
+            &multi));
+        mu_check(multi.stats.misses <= single.stats.misses);
+
+        FURI_LOG_I(
+            TAG,
+            "%s: 1 block %lums %lu/%lu hit/miss, %u blocks %lums %lu/%lu hit/miss",
+            path,
+            single.ms,
+            single.stats.hits,
+            single.stats.misses,
+            BUFFERED_FILE_STREAM_CACHE_SIZE_DEFAULT / STREAM_BENCH_BLOCK_SIZE,
+            multi.ms,
+            multi.stats.hits,
+            multi.stats.misses);
+    }
+
+    furi_string_free(line);
+    free(expected);
+    free(line_offsets);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(stream_suite) {
     MU_RUN_TEST(stream_write_read_save_load_test);
     MU_RUN_TEST(stream_composite_test);
     MU_RUN_TEST(stream_split_test);
     MU_RUN_TEST(stream_buffered_write_after_read_test);
     MU_RUN_TEST(stream_buffered_large_file_test);
+    MU_RUN_TEST(stream_buffered_cache_benchmark_test);
 }
 
 int run_minunit_test_stream(void) {
@@ -17,9 +17,24 @@
 #define NICE_FLOR_S_DIR_NAME    EXT_PATH("subghz/assets/nice_flor_s")
 #define ALUTECH_AT_4N_DIR_NAME  EXT_PATH("subghz/assets/alutech_at_4n")
 #define TEST_RANDOM_DIR_NAME    EXT_PATH("unit_tests/subghz/test_random_raw.sub")
+#define TEST_DOORHAN_DIR_NAME   EXT_PATH("unit_tests/subghz/doorhan.sub")
 #define TEST_RANDOM_COUNT_PARSE 329
 #define TEST_TIMEOUT            10000
 
+#define TEST_KEYSTORE_BENCH_DIR          EXT_PATH(".tmp/unit_tests")
+#define TEST_KEYSTORE_BENCH_FILE_NAME    EXT_PATH(".tmp/unit_tests/subghz_keystore_bench.txt")
+#define TEST_KEYSTORE_BENCH_KEY_COUNT    1000
+#define TEST_KEYSTORE_BENCH_NAME_COUNT   50
+#define TEST_KEYSTORE_BENCH_PACKET_COUNT 20
+#define TEST_KEYSTORE_BENCH_SEED         0x2545F491UL
+#define TEST_KEYSTORE_BENCH_UNKNOWN_KEY  0x1122334455667788ULL
+
+#define TEST_RECEIVER_BENCH_CHUNK 512
+
+#define TEST_RAW_BENCH_FILE_NAME    EXT_PATH(".tmp/unit_tests/subghz_raw_bench.sub")
+#define TEST_RAW_BENCH_LINE_VALUES  512
+#define TEST_RAW_BENCH_LINES        700
+
 static SubGhzEnvironment* environment_handler;
 static SubGhzReceiver* receiver_handler;
 //static SubGhzTransmitter* transmitter_handler;
@@ -217,6 +232,376 @@ MU_TEST(subghz_keystore_test) {
         "Test keystore error");
 }
 
+static uint32_t subghz_keystore_bench_random(uint32_t* seed) {
+    // xorshift32
+    *seed ^= *seed << 13;
+    *seed ^= *seed >> 17;
+    *seed ^= *seed << 5;
+    return *seed;
+}
+
+static bool subghz_keystore_bench_file_create(const char* path, size_t key_count) {
+    bool result = false;
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+
+    do {
+        if(!storage_simply_mkdir(storage, TEST_KEYSTORE_BENCH_DIR)) break;
+        if(!flipper_format_file_open_always(flipper_format, path)) break;
+        if(!flipper_format_write_header_cstr(flipper_format, "Flipper SubGhz Keystore File", 0))
+            break;
+        uint32_t encryption = 0;
+        if(!flipper_format_write_uint32(flipper_format, "Encryption", &encryption, 1)) break;
+
+        Stream* stream = flipper_format_get_raw_stream(flipper_format);
+        // Fixed seed, the same keys on every run
+        uint32_t seed = TEST_KEYSTORE_BENCH_SEED;
+        size_t index = 0;
+        for(; index < key_count; index++) {
+            const uint32_t key_high = subghz_keystore_bench_random(&seed);
+            const uint32_t key_low = subghz_keystore_bench_random(&seed);
+            // Rotate simple, normal, secure and magic xor learning types
+            if(!stream_write_format(
+                   stream,
+                   "%08lX%08lX:%zu:Bench_%zu\n",
+                   key_high,
+                   key_low,
+                   1 + index % 4,
+                   index % TEST_KEYSTORE_BENCH_NAME_COUNT)) {
+                break;
+            }
+        }
+        result = (index == key_count);
+    } while(false);
+
+    flipper_format_free(flipper_format);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+static uint32_t subghz_keystore_bench_run(
+    SubGhzProtocolDecoderBase* decoder,
+    FuriString* text,
+    size_t packet_count) {
+    uint32_t start = furi_get_tick();
+    for(size_t i = 0; i < packet_count; i++) {
+        furi_string_reset(text);
+        // Every get_string call runs the manufacture key lookup
+        subghz_protocol_decoder_base_get_string(decoder, text);
+    }
+    uint32_t elapsed = furi_get_tick() - start;
+    return packet_count * 1000 / (elapsed ? elapsed : 1);
+}
+
+// Replays a RAW capture from memory, either through the receiver dispatch table or by
+// feeding every decodable decoder with every pulse, the way the receiver used to do it
+static bool subghz_receiver_bench_run(
+    const char* path,
+    bool dispatch,
+    uint32_t* pulses_per_second,
+    uint16_t* decoded) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* flipper_format = flipper_format_buffered_file_alloc(storage);
+    int32_t* chunk = malloc(sizeof(int32_t) * TEST_RECEIVER_BENCH_CHUNK);
+
+    const SubGhzProtocolRegistry* registry = &subghz_protocol_registry;
+    size_t protocol_count = subghz_protocol_registry_count(registry);
+    SubGhzProtocolDecoderBase** decoders =
+        malloc(sizeof(SubGhzProtocolDecoderBase*) * protocol_count);
+    size_t decoder_count = 0;
+    for(size_t i = 0; i < protocol_count; i++) {
+        const SubGhzProtocol* protocol = subghz_protocol_registry_get_by_index(registry, i);
+        if((protocol->flag & SubGhzProtocolFlag_Decodable) == 0) continue;
+        SubGhzProtocolDecoderBase* decoder =
+            subghz_receiver_search_decoder_base_by_name(receiver_handler, protocol->name);
+        if(decoder) decoders[decoder_count++] = decoder;
+    }
+
+    subghz_test_decoder_count = 0;
+    subghz_receiver_reset(receiver_handler);
+
+    uint64_t cycles = 0;
+    uint64_t pulses = 0;
+    uint32_t count = 0;
+    if(flipper_format_buffered_file_open_existing(flipper_format, path)) {
+        while(flipper_format_get_value_count(flipper_format, "RAW_Data", &count)) {
+            count = MIN(count, (uint32_t)TEST_RECEIVER_BENCH_CHUNK);
+            if(!flipper_format_read_int32(flipper_format, "RAW_Data", chunk, count)) break;
+
+            uint32_t start = DWT->CYCCNT;
+            for(size_t i = 0; i < count; i++) {
+                bool level = chunk[i] > 0;
+                uint32_t duration = level ? chunk[i] : -chunk[i];
+                if(dispatch) {
+                    subghz_receiver_decode(receiver_handler, level, duration);
+                } else {
+                    for(size_t j = 0; j < decoder_count; j++) {
+                        decoders[j]->protocol->decoder->feed(decoders[j], level, duration);
+                    }
+                }
+            }
+            cycles += DWT->CYCCNT - start;
+            pulses += count;
+        }
+    }
+
+    uint64_t cycles_per_second = furi_hal_cortex_instructions_per_microsecond() * 1000000ULL;
+    *pulses_per_second = cycles ? pulses * cycles_per_second / cycles : 0;
+    *decoded = subghz_test_decoder_count;
+
+    free(decoders);
+    free(chunk);
+    flipper_format_free(flipper_format);
+    furi_record_close(RECORD_STORAGE);
+
+    return pulses > 0;
+}
+
+MU_TEST(subghz_receiver_dispatch_benchmark_test) {
+    const char* const paths[] = {
+        TEST_RANDOM_DIR_NAME,
+        EXT_PATH("unit_tests/subghz/princeton_raw.sub"),
+        EXT_PATH("unit_tests/subghz/security_pls_2_0_raw.sub"),
+    };
+
+    for(size_t i = 0; i < COUNT_OF(paths); i++) {
+        uint32_t linear_pulses = 0, dispatch_pulses = 0;
+        uint16_t linear_decoded = 0, dispatch_decoded = 0;
+        mu_assert(
+            subghz_receiver_bench_run(paths[i], false, &linear_pulses, &linear_decoded),
+            "Linear replay error");
+        mu_assert(
+            subghz_receiver_bench_run(paths[i], true, &dispatch_pulses, &dispatch_decoded),
+            "Dispatch replay error");
+        mu_assert(linear_decoded == dispatch_decoded, "Dispatch decode count mismatch");
+
+        FURI_LOG_I(
+            TAG,
+            "%s: pulses/s linear %lu, dispatch %lu, decoded %u",
+            paths[i],
+            linear_pulses,
+            dispatch_pulses,
+            dispatch_decoded);
+    }
+}
+
+static bool subghz_raw_bench_create(const char* path) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+    int32_t* line = malloc(sizeof(int32_t) * TEST_RAW_BENCH_LINE_VALUES);
+    bool created = false;
+
+    do {
+        if(!storage_simply_mkdir(storage, TEST_KEYSTORE_BENCH_DIR)) break;
+        if(!flipper_format_file_open_always(flipper_format, path)) break;
+        if(!flipper_format_write_header_cstr(flipper_format, SUBGHZ_RAW_FILE_TYPE, 1)) break;
+        if(!flipper_format_write_string_cstr(flipper_format, "Protocol", SUBGHZ_PROTOCOL_RAW_NAME))
+            break;
+
+        size_t index = 0;
+        for(size_t i = 0; i < TEST_RAW_BENCH_LINES; i++) {
+            for(size_t j = 0; j < TEST_RAW_BENCH_LINE_VALUES; j++, index++) {
+                int32_t duration = 100 + (index * 37) % 3000;
+                line[j] = (index & 1) ? -duration : duration;
+            }
+            if(!flipper_format_write_int32(
+                   flipper_format, "RAW_Data", line, TEST_RAW_BENCH_LINE_VALUES))
+                break;
+        }
+        created = (index == TEST_RAW_BENCH_LINES * TEST_RAW_BENCH_LINE_VALUES);
+    } while(false);
+
+    free(line);
+    flipper_format_free(flipper_format);
+    furi_record_close(RECORD_STORAGE);
+
+    return created;
+}
+
+typedef struct {
+    size_t count;
+    uint32_t checksum;
+    uint32_t ticks;
+    size_t underruns;
+} SubGhzRawBenchResult;
+
+// Drains the file encoder worker as fast as possible, the way the radio would if it was
+// infinitely fast, and counts how many times the worker could not keep up
+static bool subghz_raw_bench_replay(const char* path, SubGhzRawBenchResult* result) {
+    memset(result, 0, sizeof(SubGhzRawBenchResult));
+    bool finished = false;
+
+    SubGhzFileEncoderWorker* worker = subghz_file_encoder_worker_alloc();
+    if(subghz_file_encoder_worker_start(worker, path, NULL)) {
+        uint32_t start = 0;
+        uint32_t test_start = furi_get_tick();
+        while(furi_get_tick() - test_start < TEST_TIMEOUT * 10) {
+            LevelDuration level_duration = subghz_file_encoder_worker_get_level_duration(worker);
+            if(level_duration_is_reset(level_duration)) {
+                finished = true;
+                break;
+            } else if(level_duration_is_wait(level_duration)) {
+                if(result->count) result->underruns++;
+                furi_delay_tick(1);
+            } else {
+                if(!result->count) start = furi_get_tick();
+                uint32_t value = level_duration_get_duration(level_duration);
+                if(level_duration_get_level(level_duration)) value |= 0x80000000UL;
+                result->checksum = (result->checksum ^ value) * 16777619UL;
+                result->count++;
+            }
+        }
+        result->ticks = furi_get_tick() - start;
+        subghz_file_encoder_worker_stop(worker);
+    }
+    subghz_file_encoder_worker_free(worker);
+
+    return finished;
+}
+
+// Flips the last digit of the last RAW_Data line, file size stays the same
+static bool subghz_raw_bench_edit(Storage* storage, const char* path) {
+    File* file = storage_file_alloc(storage);
+    bool edited = false;
+
+    do {
+        if(!storage_file_open(file, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING)) break;
+        uint64_t position = storage_file_size(file) - 2;
+        char digit;
+        if(!storage_file_seek(file, position, true)) break;
+        if(storage_file_read(file, &digit, 1) != 1 || digit < '0' || digit > '9') break;
+        digit ^= 1;
+        if(!storage_file_seek(file, position, true)) break;
+        edited = storage_file_write(file, &digit, 1) == 1;
+    } while(false);
+
+    storage_file_close(file);
+    storage_file_free(file);
+
+    return edited;
+}
+
+MU_TEST(subghz_raw_sidecar_benchmark_test) {
+    mu_assert(subghz_raw_bench_create(TEST_RAW_BENCH_FILE_NAME), "Unable to create RAW capture");
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    SubGhzRawBenchResult text, binary, edited;
+    FuriString* sidecar = furi_string_alloc();
+    subghz_file_encoder_worker_get_sidecar_path(TEST_RAW_BENCH_FILE_NAME, sidecar);
+
+    // Key files never get a sidecar
+    mu_assert(
+        !subghz_file_encoder_worker_build_sidecar(storage, TEST_DOORHAN_DIR_NAME),
+        "Sidecar built for a key file");
+
+    // Worker never writes the sidecar itself
+    subghz_file_encoder_worker_remove_sidecar(storage, TEST_RAW_BENCH_FILE_NAME);
+    mu_assert(subghz_raw_bench_replay(TEST_RAW_BENCH_FILE_NAME, &text), "Text replay error");
+    mu_assert(
+        !storage_file_exists(storage, furi_string_get_cstr(sidecar)), "Sidecar written on TX");
+
+    mu_assert(
+        subghz_file_encoder_worker_build_sidecar(storage, TEST_RAW_BENCH_FILE_NAME),
+        "Unable to build sidecar");
+    mu_assert(
+        storage_file_exists(storage, furi_string_get_cstr(sidecar)), "Sidecar was not created");
+    mu_assert(subghz_raw_bench_replay(TEST_RAW_BENCH_FILE_NAME, &binary), "Binary replay error");
+
+    mu_assert_int_eq(TEST_RAW_BENCH_LINES * TEST_RAW_BENCH_LINE_VALUES, text.count);
+    mu_assert_int_eq(text.count, binary.count);
+    mu_assert(text.checksum == binary.checksum, "Binary replay differs from text");
+
+    // Same size edit must send the worker back to the text
+    mu_assert(subghz_raw_bench_edit(storage, TEST_RAW_BENCH_FILE_NAME), "Unable to edit");
+    mu_assert(subghz_raw_bench_replay(TEST_RAW_BENCH_FILE_NAME, &edited), "Edited replay error");
+    mu_assert_int_eq(text.count, edited.count);
+    mu_assert(text.checksum != edited.checksum, "Outdated sidecar was replayed");
+
+    FURI_LOG_I(
+        TAG,
+        "RAW replay of %zu values: text %lu ms (%zu underruns), binary %lu ms (%zu underruns)",
+        text.count,
+        text.ticks,
+        text.underruns,
+        binary.ticks,
+        binary.underruns);
+
+    subghz_file_encoder_worker_remove_sidecar(storage, TEST_RAW_BENCH_FILE_NAME);
+    storage_simply_remove(storage, TEST_RAW_BENCH_FILE_NAME);
+    furi_string_free(sidecar);
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(subghz_keystore_benchmark_test) {
+    mu_assert(
+        subghz_keystore_bench_file_create(
+            TEST_KEYSTORE_BENCH_FILE_NAME, TEST_KEYSTORE_BENCH_KEY_COUNT),
+        "Unable to create synthetic keystore");
+
+    SubGhzEnvironment* environment = subghz_environment_alloc();
+    subghz_environment_set_protocol_registry(environment, (void*)&subghz_protocol_registry);
+    // Real keys go first: lookup keeps file order, synthetic keys never shadow them
+    mu_assert(
+        subghz_environment_load_keystore(environment, KEYSTORE_DIR_NAME),
+        "Keystore load error");
+    mu_assert(
+        subghz_environment_load_keystore(environment, TEST_KEYSTORE_BENCH_FILE_NAME),
+        "Synthetic keystore load error");
+
+    SubGhzReceiver* receiver = subghz_receiver_alloc_init(environment);
+    SubGhzProtocolDecoderBase* decoder =
+        subghz_receiver_search_decoder_base_by_name(receiver, SUBGHZ_PROTOCOL_KEELOQ_NAME);
+    mu_check(decoder);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+    FuriString* text = furi_string_alloc();
+
+    // Known manufacture: first lookup scans the table, next ones hit the recent list
+    mu_check(flipper_format_file_open_existing(flipper_format, TEST_DOORHAN_DIR_NAME));
+    mu_check(
+        subghz_protocol_decoder_base_deserialize(decoder, flipper_format) ==
+        SubGhzProtocolStatusOk);
+    uint32_t cold_packets = subghz_keystore_bench_run(decoder, text, 1);
+    mu_assert(strstr(furi_string_get_cstr(text), "MF:DoorHan"), "Manufacture not found");
+    uint32_t recent_packets =
+        subghz_keystore_bench_run(decoder, text, TEST_KEYSTORE_BENCH_PACKET_COUNT);
+    mu_assert(strstr(furi_string_get_cstr(text), "MF:DoorHan"), "Recent manufacture not found");
+
+    // Unknown manufacture: worst case, every key is checked
+    flipper_format_free(flipper_format);
+    flipper_format = flipper_format_string_alloc();
+    uint32_t bit_count = 64;
+    uint8_t key_data[sizeof(uint64_t)] = {0};
+    for(size_t i = 0; i < sizeof(key_data); i++) {
+        key_data[i] = TEST_KEYSTORE_BENCH_UNKNOWN_KEY >> ((sizeof(key_data) - i - 1) * 8);
+    }
+    mu_check(flipper_format_write_uint32(flipper_format, "Bit", &bit_count, 1));
+    mu_check(flipper_format_write_hex(flipper_format, "Key", key_data, sizeof(key_data)));
+    mu_check(
+        subghz_protocol_decoder_base_deserialize(decoder, flipper_format) ==
+        SubGhzProtocolStatusOk);
+    uint32_t unknown_packets =
+        subghz_keystore_bench_run(decoder, text, TEST_KEYSTORE_BENCH_PACKET_COUNT);
+
+    FURI_LOG_I(
+        TAG,
+        "Keystore %d synthetic keys, packets/s: cold %lu, recent %lu, unknown %lu",
+        TEST_KEYSTORE_BENCH_KEY_COUNT,
+        cold_packets,
+        recent_packets,
+        unknown_packets);
+
+    furi_string_free(text);
+    flipper_format_free(flipper_format);
+    storage_simply_remove(storage, TEST_KEYSTORE_BENCH_FILE_NAME);
+    furi_record_close(RECORD_STORAGE);
+
+    subghz_receiver_free(receiver);
+    subghz_environment_free(environment);
+}
+
 typedef enum {
     SubGhzHalAsyncTxTestTypeNormal,
     SubGhzHalAsyncTxTestTypeInvalidStart,
@@ -842,6 +1227,7 @@ MU_TEST(subghz_random_test) {
 MU_TEST_SUITE(subghz) {
     subghz_test_init();
     MU_RUN_TEST(subghz_keystore_test);
+    MU_RUN_TEST(subghz_keystore_benchmark_test);
 
     MU_RUN_TEST(subghz_hal_async_tx_test);
 
@@ -917,6 +1303,8 @@ MU_TEST_SUITE(subghz) {
     MU_RUN_TEST(subghz_encoder_dickert_test);
 
     MU_RUN_TEST(subghz_random_test);
+    MU_RUN_TEST(subghz_receiver_dispatch_benchmark_test);
+    MU_RUN_TEST(subghz_raw_sidecar_benchmark_test);
     subghz_test_deinit();
 }
 
@@ -5,6 +5,9 @@
 #include <FreeRTOS-Kernel/include/queue.h>
 #include <task.h>
 
+#include <loader/firmware_api/firmware_api.h>
+#include <flipper_application/elf/elf_link_cache.h>
+
 #include <rpc/rpc_i.h>
 #include <flipper.pb.h>
 #include <core/event_loop.h>
@@ -42,4 +45,19 @@ static constexpr auto unit_tests_api_table = sort(create_array_t<sym_entry>(
     API_METHOD(furi_event_loop_unsubscribe, void, (FuriEventLoop*, FuriEventLoopObject*)),
     API_METHOD(furi_event_loop_run, void, (FuriEventLoop*)),
     API_METHOD(furi_event_loop_stop, void, (FuriEventLoop*)),
+    API_METHOD(firmware_api_get_fingerprint, uint32_t, (void)),
+    API_METHOD(elf_link_cache_set_api, void, (const ElfApiInterface*, uint32_t)),
+    API_METHOD(elf_link_cache_alloc, ElfLinkCache*, (Storage*)),
+    API_METHOD(elf_link_cache_free, void, (ElfLinkCache*)),
+    API_METHOD(elf_link_cache_begin, void, (ElfLinkCache*, const char*, uint16_t, uint16_t)),
+    API_METHOD(elf_link_cache_feed, void, (ElfLinkCache*, const void*, size_t)),
+    API_METHOD(elf_link_cache_read_begin, bool, (ElfLinkCache*)),
+    API_METHOD(elf_link_cache_read, bool, (ElfLinkCache*, ElfLinkCacheRecord*, uint32_t*)),
+    API_METHOD(elf_link_cache_read_end, bool, (ElfLinkCache*)),
+    API_METHOD(elf_link_cache_write_begin, bool, (ElfLinkCache*)),
+    API_METHOD(elf_link_cache_write, void, (ElfLinkCache*, const ElfLinkCacheRecord*, uint32_t)),
+    API_METHOD(elf_link_cache_write_end, void, (ElfLinkCache*, bool)),
+    API_METHOD(elf_link_cache_get_path, const char*, (ElfLinkCache*)),
+    API_METHOD(elf_link_cache_remove, void, (ElfLinkCache*)),
+    API_METHOD(elf_link_cache_prune, void, (Storage*)),
     API_VARIABLE(PB_Main_msg, PB_Main_msg_t)));
@@ -2,6 +2,8 @@
 #include "archive_apps.h"
 #include "archive_browser.h"
 
+#include <lib/subghz/subghz_file_encoder_worker.h>
+
 #define TAG "Archive"
 
 #define ASSETS_DIR "assets"
@@ -96,6 +98,9 @@ void archive_delete_file(void* context, const char* format, ...) {
         res = storage_simply_remove_recursive(fs_api, furi_string_get_cstr(filename));
     } else {
         res = (storage_common_remove(fs_api, furi_string_get_cstr(filename)) == FSE_OK);
+        if(res && furi_string_end_withi(filename, known_ext[ArchiveFileTypeSubGhz])) {
+            subghz_file_encoder_worker_remove_sidecar(fs_api, furi_string_get_cstr(filename));
+        }
     }
 
     furi_record_close(RECORD_STORAGE);
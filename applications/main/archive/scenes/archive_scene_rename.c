@@ -4,6 +4,7 @@
 #include "../helpers/archive_browser.h"
 #include "archive/views/archive_browser_view.h"
 #include "toolbox/path.h"
+#include <lib/subghz/subghz_file_encoder_worker.h>
 
 #define SCENE_RENAME_CUSTOM_EVENT (0UL)
 #define MAX_TEXT_INPUT_LEN        22
@@ -68,7 +69,11 @@ bool archive_scene_rename_on_event(void* context, SceneManagerEvent event) {
             furi_string_cat_printf(
                 path_dst, "/%s%s", archive->text_store, archive->file_extension);
 
-            storage_common_rename(fs_api, path_src, furi_string_get_cstr(path_dst));
+            FS_Error error =
+                storage_common_rename(fs_api, path_src, furi_string_get_cstr(path_dst));
+            if(error == FSE_OK && file->type == ArchiveFileTypeSubGhz) {
+                subghz_file_encoder_worker_remove_sidecar(fs_api, path_src);
+            }
             furi_record_close(RECORD_STORAGE);
 
             if(file->fav) {
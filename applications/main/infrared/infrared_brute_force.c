@@ -2,10 +2,39 @@
 
 #include <stdlib.h>
 #include <m-dict.h>
+#include <m-array.h>
 #include <flipper_format/flipper_format.h>
+#include <flipper_format/flipper_format_i.h>
+#include <toolbox/stream/buffered_file_stream.h>
+#include <toolbox/crc32_calc.h>
 
 #include "infrared_signal.h"
 
+#define TAG "InfraredBruteForce"
+
+#define INFRARED_BRUTE_FORCE_INDEX_EXTENSION ".idx"
+#define INFRARED_BRUTE_FORCE_INDEX_MAGIC     (0x58444942UL) // "BIDX"
+#define INFRARED_BRUTE_FORCE_INDEX_VERSION   (2U)
+// Pause between signals, same as the app got from its tick event when sending was blocking
+#define INFRARED_BRUTE_FORCE_SIGNAL_GAP_MS (100U)
+
+/*
+ * Index file layout:
+ * - InfraredBruteForceIndexHeader
+ * - signal_count entries in the database order: uint32_t offset, uint8_t name size, name
+ * Offset is the database position to read the signal name from. Database stays the source
+ * of truth, index is rebuilt when database size or MD5 changes.
+ */
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t reserved[3];
+    uint32_t signal_count;
+    uint32_t source_size;
+    uint8_t source_md5[16];
+    uint32_t checksum;
+} InfraredBruteForceIndexHeader;
+
 typedef struct {
     uint32_t index;
     uint32_t count;
@@ -18,12 +47,26 @@ DICT_DEF2(
     InfraredBruteForceRecord,
     M_POD_OPLIST);
 
+typedef struct {
+    uint32_t index;
+    uint32_t offset;
+} InfraredBruteForceSignal;
+
+ARRAY_DEF(InfraredBruteForceSignalArray, InfraredBruteForceSignal, M_POD_OPLIST);
+
 struct InfraredBruteForce {
     FlipperFormat* ff;
     const char* db_filename;
     FuriString* current_record_name;
+    uint32_t current_record_index;
     InfraredSignal* current_signal;
+    InfraredSignal* next_signal;
+    size_t next_signal_position;
+    bool is_next_signal_ready;
+    uint32_t transmit_end_tick;
     InfraredBruteForceRecordDict_t records;
+    // Signals of all records in the database order
+    InfraredBruteForceSignalArray_t signals;
     bool is_started;
 };
 
@@ -32,14 +75,17 @@ InfraredBruteForce* infrared_brute_force_alloc(void) {
     brute_force->ff = NULL;
     brute_force->db_filename = NULL;
     brute_force->current_signal = NULL;
+    brute_force->next_signal = NULL;
     brute_force->is_started = false;
     brute_force->current_record_name = furi_string_alloc();
     InfraredBruteForceRecordDict_init(brute_force->records);
+    InfraredBruteForceSignalArray_init(brute_force->signals);
     return brute_force;
 }
 
 void infrared_brute_force_free(InfraredBruteForce* brute_force) {
     furi_assert(!brute_force->is_started);
+    InfraredBruteForceSignalArray_clear(brute_force->signals);
     InfraredBruteForceRecordDict_clear(brute_force->records);
     furi_string_free(brute_force->current_record_name);
     free(brute_force);
@@ -50,6 +96,155 @@ void infrared_brute_force_set_db_filename(InfraredBruteForce* brute_force, const
     brute_force->db_filename = db_filename;
 }
 
+static void infrared_brute_force_add_signal(
+    InfraredBruteForce* brute_force,
+    const FuriString* signal_name,
+    uint32_t offset) {
+    InfraredBruteForceRecord* record =
+        InfraredBruteForceRecordDict_get(brute_force->records, signal_name);
+    if(record) {
+        ++(record->count);
+        InfraredBruteForceSignal signal = {.index = record->index, .offset = offset};
+        InfraredBruteForceSignalArray_push_back(brute_force->signals, signal);
+    }
+}
+
+static bool infrared_brute_force_index_load(
+    InfraredBruteForce* brute_force,
+    Stream* index,
+    const char* index_path,
+    uint32_t source_size,
+    const uint8_t* source_md5) {
+    bool index_loaded = false;
+    FuriString* signal_name = furi_string_alloc();
+    char name[UINT8_MAX + 1];
+
+    do {
+        if(!buffered_file_stream_open(index, index_path, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+
+        InfraredBruteForceIndexHeader header;
+        if(stream_read(index, (uint8_t*)&header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != INFRARED_BRUTE_FORCE_INDEX_MAGIC ||
+           header.version != INFRARED_BRUTE_FORCE_INDEX_VERSION) {
+            FURI_LOG_W(TAG, "Index format mismatch");
+            break;
+        }
+        if(header.source_size != source_size ||
+           memcmp(header.source_md5, source_md5, sizeof(header.source_md5)) != 0) {
+            FURI_LOG_I(TAG, "Index is outdated");
+            break;
+        }
+
+        uint32_t checksum = 0;
+        uint32_t signal_count = 0;
+        for(; signal_count < header.signal_count; ++signal_count) {
+            uint32_t offset;
+            uint8_t name_size;
+            if(stream_read(index, (uint8_t*)&offset, sizeof(offset)) != sizeof(offset)) break;
+            if(stream_read(index, &name_size, sizeof(name_size)) != sizeof(name_size)) break;
+            if(stream_read(index, (uint8_t*)name, name_size) != name_size) break;
+            name[name_size] = '\0';
+
+            checksum = crc32_calc_buffer(checksum, &offset, sizeof(offset));
+            checksum = crc32_calc_buffer(checksum, &name_size, sizeof(name_size));
+            checksum = crc32_calc_buffer(checksum, name, name_size);
+
+            furi_string_set(signal_name, name);
+            infrared_brute_force_add_signal(brute_force, signal_name, offset);
+        }
+        if(signal_count != header.signal_count || checksum != header.checksum) {
+            FURI_LOG_W(TAG, "Index is corrupted");
+            break;
+        }
+
+        index_loaded = true;
+    } while(false);
+
+    buffered_file_stream_close(index);
+    furi_string_free(signal_name);
+
+    return index_loaded;
+}
+
+static bool infrared_brute_force_index_write_entry(
+    Stream* index,
+    InfraredBruteForceIndexHeader* header,
+    const FuriString* signal_name,
+    uint32_t offset) {
+    size_t name_size = furi_string_size(signal_name);
+    if(name_size > UINT8_MAX) return false;
+
+    const uint8_t name_size_u8 = name_size;
+    const char* name = furi_string_get_cstr(signal_name);
+    header->checksum = crc32_calc_buffer(header->checksum, &offset, sizeof(offset));
+    header->checksum = crc32_calc_buffer(header->checksum, &name_size_u8, sizeof(name_size_u8));
+    header->checksum = crc32_calc_buffer(header->checksum, name, name_size);
+    header->signal_count++;
+
+    return stream_write(index, (const uint8_t*)&offset, sizeof(offset)) == sizeof(offset) &&
+           stream_write(index, &name_size_u8, sizeof(name_size_u8)) == sizeof(name_size_u8) &&
+           stream_write(index, (const uint8_t*)name, name_size) == name_size;
+}
+
+static InfraredErrorCode infrared_brute_force_parse_db(
+    InfraredBruteForce* brute_force,
+    FlipperFormat* ff,
+    Stream* index,
+    const char* index_path,
+    uint32_t source_size,
+    const uint8_t* source_md5) {
+    InfraredErrorCode error = InfraredErrorCodeNone;
+    Stream* stream = flipper_format_get_raw_stream(ff);
+    FuriString* signal_name = furi_string_alloc();
+    InfraredSignal* signal = infrared_signal_alloc();
+
+    InfraredBruteForceIndexHeader header = {
+        .magic = INFRARED_BRUTE_FORCE_INDEX_MAGIC,
+        .version = INFRARED_BRUTE_FORCE_INDEX_VERSION,
+        .source_size = source_size,
+    };
+    memcpy(header.source_md5, source_md5, sizeof(header.source_md5));
+
+    // Index is written along the way and dropped if anything goes wrong, header goes last
+    bool index_valid =
+        buffered_file_stream_open(index, index_path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS) &&
+        stream_write(index, (const uint8_t*)&header, sizeof(header)) == sizeof(header);
+
+    bool signals_valid = false;
+    uint32_t offset = stream_tell(stream);
+    while(infrared_signal_read_name(ff, signal_name) == InfraredErrorCodeNone) {
+        error = infrared_signal_read_body(signal, ff);
+        signals_valid = (!INFRARED_ERROR_PRESENT(error)) && infrared_signal_is_valid(signal);
+        if(!signals_valid) break;
+
+        infrared_brute_force_add_signal(brute_force, signal_name, offset);
+        if(index_valid) {
+            index_valid =
+                infrared_brute_force_index_write_entry(index, &header, signal_name, offset);
+        }
+        offset = stream_tell(stream);
+    }
+
+    if(signals_valid && index_valid) {
+        index_valid = stream_seek(index, 0, StreamOffsetFromStart) &&
+                      stream_write(index, (const uint8_t*)&header, sizeof(header)) ==
+                          sizeof(header);
+    }
+    buffered_file_stream_close(index);
+    if(!signals_valid || !index_valid) {
+        Storage* storage = furi_record_open(RECORD_STORAGE);
+        storage_simply_remove(storage, index_path);
+        furi_record_close(RECORD_STORAGE);
+    } else {
+        FURI_LOG_I(TAG, "Index saved: %s", index_path);
+    }
+
+    infrared_signal_free(signal);
+    furi_string_free(signal_name);
+
+    return error;
+}
+
 InfraredErrorCode infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
     furi_assert(!brute_force->is_started);
     furi_assert(brute_force->db_filename);
@@ -57,8 +252,17 @@ InfraredErrorCode infrared_brute_force_calculate_messages(InfraredBruteForce* br
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
-    FuriString* signal_name = furi_string_alloc();
-    InfraredSignal* signal = infrared_signal_alloc();
+    Stream* index = buffered_file_stream_alloc(storage);
+    FuriString* index_path = furi_string_alloc_printf(
+        "%s%s", brute_force->db_filename, INFRARED_BRUTE_FORCE_INDEX_EXTENSION);
+
+    InfraredBruteForceSignalArray_reset(brute_force->signals);
+    InfraredBruteForceRecordDict_it_t it;
+    for(InfraredBruteForceRecordDict_it(it, brute_force->records);
+        !InfraredBruteForceRecordDict_end_p(it);
+        InfraredBruteForceRecordDict_next(it)) {
+        InfraredBruteForceRecordDict_ref(it)->value.count = 0;
+    }
 
     do {
         if(!flipper_format_buffered_file_open_existing(ff, brute_force->db_filename)) {
@@ -66,29 +270,74 @@ InfraredErrorCode infrared_brute_force_calculate_messages(InfraredBruteForce* br
             break;
         }
 
-        bool signals_valid = false;
-        while(infrared_signal_read_name(ff, signal_name) == InfraredErrorCodeNone) {
-            error = infrared_signal_read_body(signal, ff);
-            signals_valid = (!INFRARED_ERROR_PRESENT(error)) && infrared_signal_is_valid(signal);
-            if(!signals_valid) break;
+        // Digest is cached by the storage service, unchanged database is not read again
+        uint32_t source_size = stream_size(flipper_format_get_raw_stream(ff));
+        uint8_t source_md5[16];
+        if(storage_common_md5(storage, brute_force->db_filename, source_md5) != FSE_OK) {
+            error = InfraredErrorCodeFileOperationFailed;
+            break;
+        }
 
-            InfraredBruteForceRecord* record =
-                InfraredBruteForceRecordDict_get(brute_force->records, signal_name);
-            if(record) { //-V547
-                ++(record->count);
-            }
+        if(infrared_brute_force_index_load(
+               brute_force, index, furi_string_get_cstr(index_path), source_size, source_md5)) {
+            break;
         }
-        if(!signals_valid) break;
-    } while(false);
 
-    infrared_signal_free(signal);
-    furi_string_free(signal_name);
+        // Partially loaded index may have left some signals behind
+        InfraredBruteForceSignalArray_reset(brute_force->signals);
+        for(InfraredBruteForceRecordDict_it(it, brute_force->records);
+            !InfraredBruteForceRecordDict_end_p(it);
+            InfraredBruteForceRecordDict_next(it)) {
+            InfraredBruteForceRecordDict_ref(it)->value.count = 0;
+        }
 
+        error = infrared_brute_force_parse_db(
+            brute_force, ff, index, furi_string_get_cstr(index_path), source_size, source_md5);
+    } while(false);
+
+    furi_string_free(index_path);
+    stream_free(index);
     flipper_format_free(ff);
     furi_record_close(RECORD_STORAGE);
     return error;
 }
 
+static bool infrared_brute_force_read_next(InfraredBruteForce* brute_force) {
+    brute_force->is_next_signal_ready = false;
+
+    // Skip signals of other records
+    size_t signal_count = InfraredBruteForceSignalArray_size(brute_force->signals);
+    const InfraredBruteForceSignal* signal = NULL;
+    while(brute_force->next_signal_position < signal_count) {
+        signal = InfraredBruteForceSignalArray_cget(
+            brute_force->signals, brute_force->next_signal_position++);
+        if(signal->index == brute_force->current_record_index) break;
+        signal = NULL;
+    }
+    if(!signal) return false;
+
+    Stream* stream = flipper_format_get_raw_stream(brute_force->ff);
+    FuriString* signal_name = furi_string_alloc();
+
+    do {
+        if(!stream_seek(stream, signal->offset, StreamOffsetFromStart)) break;
+        if(infrared_signal_read_name(brute_force->ff, signal_name) != InfraredErrorCodeNone)
+            break;
+        if(!furi_string_equal(signal_name, brute_force->current_record_name)) {
+            FURI_LOG_E(TAG, "Signal name mismatch at %lu", signal->offset);
+            break;
+        }
+        if(infrared_signal_read_body(brute_force->next_signal, brute_force->ff) !=
+           InfraredErrorCodeNone)
+            break;
+        brute_force->is_next_signal_ready = true;
+    } while(false);
+
+    furi_string_free(signal_name);
+
+    return brute_force->is_next_signal_ready;
+}
+
 bool infrared_brute_force_start(
     InfraredBruteForce* brute_force,
     uint32_t index,
@@ -115,10 +364,20 @@ bool infrared_brute_force_start(
         Storage* storage = furi_record_open(RECORD_STORAGE);
         brute_force->ff = flipper_format_buffered_file_alloc(storage);
         brute_force->current_signal = infrared_signal_alloc();
+        brute_force->next_signal = infrared_signal_alloc();
+        brute_force->current_record_index = index;
+        brute_force->next_signal_position = 0;
+        brute_force->is_next_signal_ready = false;
+        brute_force->transmit_end_tick = furi_get_tick() - INFRARED_BRUTE_FORCE_SIGNAL_GAP_MS;
         brute_force->is_started = true;
         success =
             flipper_format_buffered_file_open_existing(brute_force->ff, brute_force->db_filename);
-        if(!success) infrared_brute_force_stop(brute_force);
+        if(success) {
+            // First signal is decoded before the first send
+            infrared_brute_force_read_next(brute_force);
+        } else {
+            infrared_brute_force_stop(brute_force);
+        }
     }
     return success;
 }
@@ -131,8 +390,10 @@ void infrared_brute_force_stop(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
     furi_string_reset(brute_force->current_record_name);
     infrared_signal_free(brute_force->current_signal);
+    infrared_signal_free(brute_force->next_signal);
     flipper_format_free(brute_force->ff);
     brute_force->current_signal = NULL;
+    brute_force->next_signal = NULL;
     brute_force->ff = NULL;
     brute_force->is_started = false;
     furi_record_close(RECORD_STORAGE);
@@ -141,13 +402,23 @@ void infrared_brute_force_stop(InfraredBruteForce* brute_force) {
 bool infrared_brute_force_send_next(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
 
-    const bool success = infrared_signal_search_by_name_and_read(
-                             brute_force->current_signal,
-                             brute_force->ff,
-                             furi_string_get_cstr(brute_force->current_record_name)) ==
-                         InfraredErrorCodeNone;
+    const bool success = brute_force->is_next_signal_ready;
     if(success) {
-        infrared_signal_transmit(brute_force->current_signal);
+        InfraredSignal* signal = brute_force->next_signal;
+        brute_force->next_signal = brute_force->current_signal;
+        brute_force->current_signal = signal;
+
+        // Receivers need silence between signals to tell them apart
+        uint32_t elapsed = furi_get_tick() - brute_force->transmit_end_tick;
+        if(elapsed < INFRARED_BRUTE_FORCE_SIGNAL_GAP_MS) {
+            furi_delay_ms(INFRARED_BRUTE_FORCE_SIGNAL_GAP_MS - elapsed);
+        }
+
+        // Decode the following signal while the current one is on air
+        infrared_signal_transmit_start(brute_force->current_signal);
+        infrared_brute_force_read_next(brute_force);
+        infrared_signal_transmit_wait();
+        brute_force->transmit_end_tick = furi_get_tick();
     }
     return success;
 }
@@ -166,4 +437,5 @@ void infrared_brute_force_add_record(
 void infrared_brute_force_reset(InfraredBruteForce* brute_force) {
     furi_assert(!brute_force->is_started);
     InfraredBruteForceRecordDict_reset(brute_force->records);
+    InfraredBruteForceSignalArray_reset(brute_force->signals);
 }
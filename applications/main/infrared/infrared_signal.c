@@ -428,9 +428,14 @@ InfraredErrorCode infrared_signal_search_by_index_and_read(
 }
 
 void infrared_signal_transmit(const InfraredSignal* signal) {
+    infrared_signal_transmit_start(signal);
+    infrared_signal_transmit_wait();
+}
+
+void infrared_signal_transmit_start(const InfraredSignal* signal) {
     if(signal->is_raw) {
         const InfraredRawSignal* raw_signal = &signal->payload.raw;
-        infrared_send_raw_ext(
+        infrared_send_raw_ext_start(
             raw_signal->timings,
             raw_signal->timings_size,
             true,
@@ -438,6 +443,10 @@ void infrared_signal_transmit(const InfraredSignal* signal) {
             raw_signal->duty_cycle);
     } else {
         const InfraredMessage* message = &signal->payload.message;
-        infrared_send(message, 1);
+        infrared_send_start(message, 1);
     }
 }
+
+void infrared_signal_transmit_wait(void) {
+    infrared_send_wait();
+}
@@ -218,3 +218,18 @@ InfraredErrorCode
  * @param[in] signal pointer to the instance holding the signal to be transmitted.
  */
 void infrared_signal_transmit(const InfraredSignal* signal);
+
+/**
+ * @brief Start transmitting a signal contained in an InfraredSignal instance.
+ *
+ * Returns as soon as the transmission has started. The instance must not be
+ * modified or freed until infrared_signal_transmit_wait() returns.
+ *
+ * @param[in] signal pointer to the instance holding the signal to be transmitted.
+ */
+void infrared_signal_transmit_start(const InfraredSignal* signal);
+
+/**
+ * @brief Wait for the end of a transmission started with infrared_signal_transmit_start().
+ */
+void infrared_signal_transmit_wait(void);
@@ -7,6 +7,11 @@
 #include <flipper_application/plugins/plugin_manager.h>
 #include <flipper_application/plugins/composite_resolver.h>
 #include <loader/firmware_api/firmware_api.h>
+#include <toolbox/version.h>
+
+#include <nfc/protocols/mf_classic/mf_classic.h>
+#include <nfc/protocols/mf_desfire/mf_desfire.h>
+#include <bit_lib/bit_lib.h>
 
 #include <furi.h>
 #include <path.h>
@@ -17,6 +22,14 @@
 #define NFC_SUPPORTED_CARDS_PLUGINS_PATH  APP_DATA_PATH("plugins")
 #define NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX "_parser.fal"
 
+#define NFC_SUPPORTED_CARDS_INDEX_PATH      APP_DATA_PATH("plugins.idx")
+#define NFC_SUPPORTED_CARDS_INDEX_MAGIC     (0x4E504958UL)
+#define NFC_SUPPORTED_CARDS_INDEX_VERSION   (1u)
+#define NFC_SUPPORTED_CARDS_INDEX_HINTS_MAX (16u)
+
+#define NFC_SUPPORTED_CARDS_FNV_BASIS (0x811C9DC5UL)
+#define NFC_SUPPORTED_CARDS_FNV_PRIME (0x01000193UL)
+
 typedef enum {
     NfcSupportedCardsPluginFeatureHasVerify = (1U << 0),
     NfcSupportedCardsPluginFeatureHasRead = (1U << 1),
@@ -25,8 +38,11 @@ typedef enum {
 
 typedef struct {
     FuriString* name;
+    uint32_t size;
     NfcProtocol protocol;
     NfcSupportedCardsPluginFeature feature;
+    NfcSupportedCardPluginHint* hints;
+    size_t hints_count;
 } NfcSupportedCardsPluginCache;
 
 ARRAY_DEF(NfcSupportedCardsPluginCache, NfcSupportedCardsPluginCache, M_POD_OPLIST);
@@ -42,9 +58,27 @@ typedef struct {
     Storage* storage;
     File* directory;
     char file_name[256];
+    FileInfo file_info;
     FlipperApplication* app;
+    uint32_t plugin_api_version;
 } NfcSupportedCardsLoadContext;
 
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t firmware_api;
+    uint32_t firmware_hash;
+} NfcSupportedCardsIndexHeader;
+
+typedef struct {
+    uint32_t size;
+    uint8_t protocol;
+    uint8_t feature;
+    uint8_t hints_count;
+    uint8_t name_size;
+} NfcSupportedCardsIndexRecord;
+
 struct NfcSupportedCards {
     CompositeApiResolver* api_resolver;
     NfcSupportedCardsPluginCache_t plugins_cache_arr;
@@ -64,16 +98,25 @@ NfcSupportedCards* nfc_supported_cards_alloc(void) {
     return instance;
 }
 
-void nfc_supported_cards_free(NfcSupportedCards* instance) {
-    furi_assert(instance);
+static void nfc_supported_cards_plugin_cache_reset(NfcSupportedCardsPluginCache* plugin_cache) {
+    if(plugin_cache->name) furi_string_free(plugin_cache->name);
+    free(plugin_cache->hints);
+}
 
+static void nfc_supported_cards_plugin_cache_clear(NfcSupportedCardsPluginCache_t cache_arr) {
     NfcSupportedCardsPluginCache_it_t iter;
-    for(NfcSupportedCardsPluginCache_it(iter, instance->plugins_cache_arr);
+    for(NfcSupportedCardsPluginCache_it(iter, cache_arr);
         !NfcSupportedCardsPluginCache_end_p(iter);
         NfcSupportedCardsPluginCache_next(iter)) {
-        NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
-        furi_string_free(plugin_cache->name);
+        nfc_supported_cards_plugin_cache_reset(NfcSupportedCardsPluginCache_ref(iter));
     }
+    NfcSupportedCardsPluginCache_reset(cache_arr);
+}
+
+void nfc_supported_cards_free(NfcSupportedCards* instance) {
+    furi_assert(instance);
+
+    nfc_supported_cards_plugin_cache_clear(instance->plugins_cache_arr);
     NfcSupportedCardsPluginCache_clear(instance->plugins_cache_arr);
 
     composite_api_resolver_free(instance->api_resolver);
@@ -131,44 +174,281 @@ static const NfcSupportedCardsPlugin* nfc_supported_cards_get_plugin(
         if(descriptor == NULL) break;
 
         if(strcmp(descriptor->appid, NFC_SUPPORTED_CARD_PLUGIN_APP_ID) != 0) break;
-        if(descriptor->ep_api_version != NFC_SUPPORTED_CARD_PLUGIN_API_VERSION) break;
+        if(descriptor->ep_api_version < NFC_SUPPORTED_CARD_PLUGIN_API_VERSION_MIN ||
+           descriptor->ep_api_version > NFC_SUPPORTED_CARD_PLUGIN_API_VERSION)
+            break;
 
         plugin = descriptor->entry_point;
+        instance->plugin_api_version = descriptor->ep_api_version;
     } while(false);
     furi_string_free(plugin_path);
 
     return plugin;
 }
 
-static const NfcSupportedCardsPlugin* nfc_supported_cards_get_next_plugin(
-    NfcSupportedCardsLoadContext* instance,
-    const ElfApiInterface* api_interface) {
-    const NfcSupportedCardsPlugin* plugin = NULL;
+static bool nfc_supported_cards_get_next_plugin_name(NfcSupportedCardsLoadContext* instance) {
+    bool found = false;
 
-    do {
+    while(!found) {
         if(!storage_file_is_open(instance->directory)) break;
         if(!storage_dir_read(
-               instance->directory, NULL, instance->file_name, sizeof(instance->file_name)))
+               instance->directory,
+               &instance->file_info,
+               instance->file_name,
+               sizeof(instance->file_name)))
             break;
+        if(file_info_is_dir(&instance->file_info)) continue;
 
         const size_t suffix_len = strlen(NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX);
         const size_t file_name_len = strlen(instance->file_name);
-        if(file_name_len <= suffix_len) break;
+        if(file_name_len <= suffix_len) continue;
 
         size_t suffix_start_pos = file_name_len - suffix_len;
         if(memcmp(
                &instance->file_name[suffix_start_pos],
                NFC_SUPPORTED_CARDS_PLUGIN_SUFFIX,
                suffix_len) != 0) //-V1051
-            break;
+            continue;
 
         // Trim suffix from file_name to save memory. The suffix will be concatenated on plugin load.
         instance->file_name[suffix_start_pos] = '\0';
+        found = true;
+    }
 
-        plugin = nfc_supported_cards_get_plugin(instance, instance->file_name, api_interface);
-    } while(plugin == NULL); //-V654
+    return found;
+}
 
-    return plugin;
+static void nfc_supported_cards_plugin_cache_fill(
+    NfcSupportedCardsPluginCache* plugin_cache,
+    const NfcSupportedCardsPlugin* plugin,
+    uint32_t plugin_api_version) {
+    plugin_cache->protocol = plugin->protocol;
+    if(plugin->verify) {
+        plugin_cache->feature |= NfcSupportedCardsPluginFeatureHasVerify;
+    }
+    if(plugin->read) {
+        plugin_cache->feature |= NfcSupportedCardsPluginFeatureHasRead;
+    }
+    if(plugin->parse) {
+        plugin_cache->feature |= NfcSupportedCardsPluginFeatureHasParse;
+    }
+
+    // Version 1 plugins end before the hints, too many hints are as good as none
+    if(plugin_api_version >= 2 && plugin->hints && plugin->hints_count &&
+       plugin->hints_count <= NFC_SUPPORTED_CARDS_INDEX_HINTS_MAX) {
+        const size_t hints_size = sizeof(NfcSupportedCardPluginHint) * plugin->hints_count;
+        plugin_cache->hints = malloc(hints_size);
+        memcpy(plugin_cache->hints, plugin->hints, hints_size);
+        plugin_cache->hints_count = plugin->hints_count;
+    }
+}
+
+static bool nfc_supported_cards_plugin_cache_match(
+    const NfcSupportedCardsPluginCache* plugin_cache,
+    const NfcDevice* device) {
+    if(plugin_cache->hints_count == 0) return true;
+
+    bool match = false;
+
+    for(size_t i = 0; i < plugin_cache->hints_count && !match; i++) {
+        const NfcSupportedCardPluginHint* hint = &plugin_cache->hints[i];
+
+        if(hint->type == NfcSupportedCardPluginHintTypeMfClassicKeyA) {
+            if(plugin_cache->protocol != NfcProtocolMfClassic) continue;
+            const MfClassicData* data = nfc_device_get_data(device, NfcProtocolMfClassic);
+            if(hint->sector >= mf_classic_get_total_sectors_num(data->type)) continue;
+
+            const MfClassicSectorTrailer* sec_tr =
+                mf_classic_get_sector_trailer_by_sector(data, hint->sector);
+            match = bit_lib_bytes_to_num_be(sec_tr->key_a.data, sizeof(MfClassicKey)) ==
+                    hint->value;
+
+        } else if(hint->type == NfcSupportedCardPluginHintTypeMfDesfireAid) {
+            if(plugin_cache->protocol != NfcProtocolMfDesfire) continue;
+            const MfDesfireData* data = nfc_device_get_data(device, NfcProtocolMfDesfire);
+
+            MfDesfireApplicationId app_id;
+            bit_lib_num_to_bytes_be(hint->value, sizeof(app_id.data), app_id.data);
+            match = mf_desfire_get_application(data, &app_id) != NULL;
+
+        } else {
+            // Unknown to this firmware, can not rule the plugin out
+            match = true;
+        }
+    }
+
+    return match;
+}
+
+/****************** Index ******************/
+
+// Plugins are linked against the firmware, any other build may accept or reject them
+static uint32_t nfc_supported_cards_index_firmware_hash(void) {
+    uint32_t hash = NFC_SUPPORTED_CARDS_FNV_BASIS;
+    const char* stamps[] = {version_get_githash(NULL), version_get_builddate(NULL)};
+
+    for(size_t i = 0; i < COUNT_OF(stamps); i++) {
+        for(const char* c = stamps[i]; *c; c++) {
+            hash = (hash ^ (uint8_t)*c) * NFC_SUPPORTED_CARDS_FNV_PRIME;
+        }
+    }
+
+    return hash;
+}
+
+static void nfc_supported_cards_index_header_init(NfcSupportedCardsIndexHeader* header) {
+    header->magic = NFC_SUPPORTED_CARDS_INDEX_MAGIC;
+    header->version = NFC_SUPPORTED_CARDS_INDEX_VERSION;
+    header->firmware_api = (firmware_api_interface->api_version_major << 16) |
+                           firmware_api_interface->api_version_minor;
+    header->firmware_hash = nfc_supported_cards_index_firmware_hash();
+}
+
+static bool nfc_supported_cards_index_read_record(
+    File* file,
+    NfcSupportedCardsPluginCache* plugin_cache,
+    char* name_buffer) {
+    bool success = false;
+
+    do {
+        NfcSupportedCardsIndexRecord record;
+        if(storage_file_read(file, &record, sizeof(record)) != sizeof(record)) break;
+        if(record.name_size == 0 || record.hints_count > NFC_SUPPORTED_CARDS_INDEX_HINTS_MAX)
+            break;
+        if(storage_file_read(file, name_buffer, record.name_size) != record.name_size) break;
+        name_buffer[record.name_size] = '\0';
+
+        plugin_cache->name = furi_string_alloc_set(name_buffer);
+        plugin_cache->size = record.size;
+        plugin_cache->protocol = record.protocol;
+        plugin_cache->feature = record.feature;
+
+        if(record.hints_count) {
+            const size_t hints_size = sizeof(NfcSupportedCardPluginHint) * record.hints_count;
+            plugin_cache->hints = malloc(hints_size);
+            plugin_cache->hints_count = record.hints_count;
+            if(storage_file_read(file, plugin_cache->hints, hints_size) != hints_size) break;
+        }
+
+        success = true;
+    } while(false);
+
+    return success;
+}
+
+static void nfc_supported_cards_index_load(
+    NfcSupportedCardsLoadContext* instance,
+    NfcSupportedCardsPluginCache_t index_arr) {
+    File* file = storage_file_alloc(instance->storage);
+
+    do {
+        if(!storage_file_open(file, NFC_SUPPORTED_CARDS_INDEX_PATH, FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+
+        NfcSupportedCardsIndexHeader header;
+        NfcSupportedCardsIndexHeader expected;
+        nfc_supported_cards_index_header_init(&expected);
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != expected.magic || header.version != expected.version ||
+           header.firmware_api != expected.firmware_api ||
+           header.firmware_hash != expected.firmware_hash) {
+            FURI_LOG_D(TAG, "Index is outdated");
+            break;
+        }
+
+        for(size_t i = 0; i < header.count; i++) {
+            NfcSupportedCardsPluginCache plugin_cache = {};
+            if(!nfc_supported_cards_index_read_record(file, &plugin_cache, instance->file_name)) {
+                FURI_LOG_E(TAG, "Index is corrupted");
+                nfc_supported_cards_plugin_cache_reset(&plugin_cache);
+                nfc_supported_cards_plugin_cache_clear(index_arr);
+                break;
+            }
+            NfcSupportedCardsPluginCache_push_back(index_arr, plugin_cache);
+        }
+    } while(false);
+
+    storage_file_close(file);
+    storage_file_free(file);
+}
+
+static void nfc_supported_cards_index_save(
+    NfcSupportedCardsLoadContext* instance,
+    NfcSupportedCardsPluginCache_t cache_arr) {
+    File* file = storage_file_alloc(instance->storage);
+    bool success = false;
+
+    do {
+        if(!storage_file_open(
+               file, NFC_SUPPORTED_CARDS_INDEX_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS))
+            break;
+
+        NfcSupportedCardsIndexHeader header = {
+            .count = NfcSupportedCardsPluginCache_size(cache_arr),
+        };
+        nfc_supported_cards_index_header_init(&header);
+        if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) break;
+
+        NfcSupportedCardsPluginCache_it_t iter;
+        for(NfcSupportedCardsPluginCache_it(iter, cache_arr);
+            !NfcSupportedCardsPluginCache_end_p(iter);
+            NfcSupportedCardsPluginCache_next(iter)) {
+            const NfcSupportedCardsPluginCache* plugin_cache =
+                NfcSupportedCardsPluginCache_cref(iter);
+            const char* name = furi_string_get_cstr(plugin_cache->name);
+            const size_t hints_size = sizeof(NfcSupportedCardPluginHint) *
+                                      plugin_cache->hints_count;
+
+            NfcSupportedCardsIndexRecord record = {
+                .size = plugin_cache->size,
+                .protocol = plugin_cache->protocol,
+                .feature = plugin_cache->feature,
+                .hints_count = plugin_cache->hints_count,
+                .name_size = strlen(name),
+            };
+
+            const StorageIoVec vector[] = {
+                {.buff = &record, .size = sizeof(record)},
+                {.buff = (void*)name, .size = record.name_size},
+                {.buff = plugin_cache->hints, .size = hints_size},
+            };
+            const size_t record_size = sizeof(record) + record.name_size + hints_size;
+            if(storage_file_write_vector(file, vector, COUNT_OF(vector)) != record_size) break;
+        }
+
+        success = NfcSupportedCardsPluginCache_end_p(iter);
+    } while(false);
+
+    storage_file_close(file);
+    storage_file_free(file);
+
+    if(success) {
+        FURI_LOG_D(TAG, "Index saved");
+    } else {
+        // Better no index than a truncated one
+        FURI_LOG_E(TAG, "Failed to save index");
+        storage_simply_remove(instance->storage, NFC_SUPPORTED_CARDS_INDEX_PATH);
+    }
+}
+
+static bool nfc_supported_cards_index_take(
+    NfcSupportedCardsPluginCache_t index_arr,
+    const char* name,
+    uint64_t size,
+    NfcSupportedCardsPluginCache* plugin_cache) {
+    bool found = false;
+
+    for(size_t i = 0; i < NfcSupportedCardsPluginCache_size(index_arr); i++) {
+        const NfcSupportedCardsPluginCache* indexed =
+            NfcSupportedCardsPluginCache_cget(index_arr, i);
+        if(indexed->size == size && furi_string_equal_str(indexed->name, name)) {
+            NfcSupportedCardsPluginCache_pop_at(plugin_cache, index_arr, i);
+            found = true;
+            break;
+        }
+    }
+
+    return found;
 }
 
 void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
@@ -180,32 +460,59 @@ void nfc_supported_cards_load_cache(NfcSupportedCards* instance) {
             break;
 
         instance->load_context = nfc_supported_cards_load_context_alloc();
-
-        while(true) {
-            const ElfApiInterface* api_interface =
-                composite_api_resolver_get(instance->api_resolver);
-            const NfcSupportedCardsPlugin* plugin =
-                nfc_supported_cards_get_next_plugin(instance->load_context, api_interface);
-            if(plugin == NULL) break; //-V547
-
-            NfcSupportedCardsPluginCache plugin_cache = {}; //-V779
-            plugin_cache.name = furi_string_alloc_set(instance->load_context->file_name);
-            plugin_cache.protocol = plugin->protocol;
-            if(plugin->verify) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasVerify;
-            }
-            if(plugin->read) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasRead;
-            }
-            if(plugin->parse) {
-                plugin_cache.feature |= NfcSupportedCardsPluginFeatureHasParse;
+        NfcSupportedCardsLoadContext* load_context = instance->load_context;
+
+        NfcSupportedCardsPluginCache_t index_arr;
+        NfcSupportedCardsPluginCache_init(index_arr);
+        nfc_supported_cards_index_load(load_context, index_arr);
+
+        // Only plugins added or replaced since the index was saved are loaded
+        size_t plugins_scanned = 0;
+        while(nfc_supported_cards_get_next_plugin_name(load_context)) {
+            NfcSupportedCardsPluginCache plugin_cache = {};
+
+            if(!nfc_supported_cards_index_take(
+                   index_arr,
+                   load_context->file_name,
+                   load_context->file_info.size,
+                   &plugin_cache)) {
+                plugin_cache.name = furi_string_alloc_set(load_context->file_name);
+                plugin_cache.size = load_context->file_info.size;
+                // Files that are not valid plugins are indexed too, not to be loaded every time
+                plugin_cache.protocol = NfcProtocolInvalid;
+
+                const ElfApiInterface* api_interface =
+                    composite_api_resolver_get(instance->api_resolver);
+                const NfcSupportedCardsPlugin* plugin = nfc_supported_cards_get_plugin(
+                    load_context, load_context->file_name, api_interface);
+                if(plugin) {
+                    nfc_supported_cards_plugin_cache_fill(
+                        &plugin_cache, plugin, load_context->plugin_api_version);
+                }
+                plugins_scanned++;
             }
+
             NfcSupportedCardsPluginCache_push_back(instance->plugins_cache_arr, plugin_cache);
         }
 
+        // Whatever is left in the index was removed from the directory
+        if(plugins_scanned || !NfcSupportedCardsPluginCache_empty_p(index_arr)) {
+            FURI_LOG_D(TAG, "Scanned %zu plugins", plugins_scanned);
+            nfc_supported_cards_index_save(load_context, instance->plugins_cache_arr);
+        }
+        nfc_supported_cards_plugin_cache_clear(index_arr);
+        NfcSupportedCardsPluginCache_clear(index_arr);
+
         nfc_supported_cards_load_context_free(instance->load_context);
 
-        size_t plugins_loaded = NfcSupportedCardsPluginCache_size(instance->plugins_cache_arr);
+        size_t plugins_loaded = 0;
+        NfcSupportedCardsPluginCache_it_t iter;
+        for(NfcSupportedCardsPluginCache_it(iter, instance->plugins_cache_arr);
+            !NfcSupportedCardsPluginCache_end_p(iter);
+            NfcSupportedCardsPluginCache_next(iter)) {
+            if(NfcSupportedCardsPluginCache_cref(iter)->feature) plugins_loaded++;
+        }
+
         if(plugins_loaded == 0) {
             FURI_LOG_D(TAG, "Plugins not found");
             instance->load_state = NfcSupportedCardsLoadStateFail;
@@ -285,6 +592,7 @@ bool nfc_supported_cards_parse(
             NfcSupportedCardsPluginCache* plugin_cache = NfcSupportedCardsPluginCache_ref(iter);
             if(plugin_cache->protocol != protocol) continue;
             if((plugin_cache->feature & NfcSupportedCardsPluginFeatureHasParse) == 0) continue;
+            if(!nfc_supported_cards_plugin_cache_match(plugin_cache, device)) continue;
 
             const ElfApiInterface* api_interface =
                 composite_api_resolver_get(instance->api_resolver);
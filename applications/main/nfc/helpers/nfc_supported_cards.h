@@ -37,6 +37,10 @@ void nfc_supported_cards_free(NfcSupportedCards* instance);
 /**
  * @brief Load plugins information to cache.
  *
+ * Plugins information is kept in an index on the SD card. Only the plugins
+ * added or replaced since the index was saved are loaded, the index is
+ * discarded on firmware change.
+ *
  * @note This function must be called before calling read and parse fanctions.
  *
  * @param[in, out] instance pointer to NfcSupportedCards instance.
@@ -63,7 +67,8 @@ bool nfc_supported_cards_read(NfcSupportedCards* instance, NfcDevice* device, Nf
  * @brief Parse raw data into human-readable representation.
  *
  * This function will load all suitable supported card plugins one by one and
- * try to parse the data according to each implementation. Upon first success,
+ * try to parse the data according to each implementation. Plugins with hints
+ * not matching the data are skipped without loading. Upon first success,
  * no further attempts will be made and the function will return.
  *
  * @param[in, out] instance pointer to NfcSupportedCards instance.
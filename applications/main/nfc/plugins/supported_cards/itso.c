@@ -107,12 +107,18 @@ static bool itso_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardPluginHint itso_hints[] = {
+    {.type = NfcSupportedCardPluginHintTypeMfDesfireAid, .value = 0x1602a0},
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin itso_plugin = {
     .protocol = NfcProtocolMfDesfire,
     .verify = NULL,
     .read = NULL,
     .parse = itso_parse,
+    .hints = itso_hints,
+    .hints_count = COUNT_OF(itso_hints),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -95,12 +95,18 @@ static bool myki_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardPluginHint myki_hints[] = {
+    {.type = NfcSupportedCardPluginHintTypeMfDesfireAid, .value = 0x0011f2},
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin myki_plugin = {
     .protocol = NfcProtocolMfDesfire,
     .verify = NULL,
     .read = NULL,
     .parse = myki_parse,
+    .hints = myki_hints,
+    .hints_count = COUNT_OF(myki_hints),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -16,6 +16,9 @@
  * Then, register the plugin in the `application.fam` file in the `nfc` directory. Use the existing
  * entries as an example. After being registered, the plugin will be automatically deployed with the application.
  *
+ * If the card can be recognised by a MIFARE Classic key or a MIFARE DESFire application id,
+ * list them as hints, so the plugin is not loaded for every card of the same protocol.
+ *
  * @note the APPID field MUST end with `_parser` so the applicaton would know that this particular file
  * is a supported card plugin.
  *
@@ -36,7 +39,14 @@
 /**
  * @brief Currently supported plugin API version.
  */
-#define NFC_SUPPORTED_CARD_PLUGIN_API_VERSION 1
+#define NFC_SUPPORTED_CARD_PLUGIN_API_VERSION 2
+
+/**
+ * @brief Oldest plugin API version still accepted.
+ *
+ * Version 1 plugins lack the hints, they are tried on every card of their protocol.
+ */
+#define NFC_SUPPORTED_CARD_PLUGIN_API_VERSION_MIN 1
 
 /**
  * @brief Verify that the card is of a supported type.
@@ -81,6 +91,27 @@ typedef bool (*NfcSupportedCardPluginRead)(Nfc* nfc, NfcDevice* device);
  */
 typedef bool (*NfcSupportedCardPluginParse)(const NfcDevice* device, FuriString* parsed_data);
 
+/**
+ * @brief Kind of data a plugin hint is checked against.
+ */
+typedef enum {
+    NfcSupportedCardPluginHintTypeMfClassicKeyA, /**< Key A of a MIFARE Classic sector. */
+    NfcSupportedCardPluginHintTypeMfDesfireAid, /**< MIFARE DESFire application id. */
+} NfcSupportedCardPluginHintType;
+
+/**
+ * @brief Cheap check of the card data, done before the plugin is loaded.
+ *
+ * Hints are kept in the plugin index, so a plugin is only loaded to parse the data
+ * matching at least one of its hints. Every card the plugin is able to parse must
+ * match one of them, otherwise the card will never reach the parse() function.
+ */
+typedef struct {
+    NfcSupportedCardPluginHintType type; /**< Kind of data to check. */
+    uint8_t sector; /**< Sector number, MIFARE Classic key hints only. */
+    uint64_t value; /**< Expected key or application id, big endian. */
+} NfcSupportedCardPluginHint;
+
 /**
  * @brief Supported card plugin interface.
  *
@@ -91,4 +122,6 @@ typedef struct {
     NfcSupportedCardPluginVerify verify; /**< Pointer to the verify() function. */
     NfcSupportedCardPluginRead read; /**< Pointer to the read() function. */
     NfcSupportedCardPluginParse parse; /**< Pointer to the parse() function. */
+    const NfcSupportedCardPluginHint* hints; /**< Optional hints, checked before parse(). */
+    size_t hints_count; /**< Number of hints. */
 } NfcSupportedCardsPlugin;
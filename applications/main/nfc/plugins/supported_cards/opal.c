@@ -212,12 +212,18 @@ static bool opal_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+static const NfcSupportedCardPluginHint opal_hints[] = {
+    {.type = NfcSupportedCardPluginHintTypeMfDesfireAid, .value = 0x314553},
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin opal_plugin = {
     .protocol = NfcProtocolMfDesfire,
     .verify = NULL,
     .read = NULL,
     .parse = opal_parse,
+    .hints = opal_hints,
+    .hints_count = COUNT_OF(opal_hints),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -237,12 +237,19 @@ static bool plantain_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+/* Data sector key A, the same for all card types, see plantain_get_card_config() */
+static const NfcSupportedCardPluginHint plantain_hints[] = {
+    {.type = NfcSupportedCardPluginHintTypeMfClassicKeyA, .sector = 8, .value = 0x26973ea74321},
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin plantain_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = plantain_verify,
     .read = plantain_read,
     .parse = plantain_parse,
+    .hints = plantain_hints,
+    .hints_count = COUNT_OF(plantain_hints),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
@@ -242,12 +242,20 @@ static bool troika_parse(const NfcDevice* device, FuriString* parsed_data) {
     return parsed;
 }
 
+/* Data sector key A of every card type, see troika_get_card_config() */
+static const NfcSupportedCardPluginHint troika_hints[] = {
+    {.type = NfcSupportedCardPluginHintTypeMfClassicKeyA, .sector = 11, .value = 0x08b386463229},
+    {.type = NfcSupportedCardPluginHintTypeMfClassicKeyA, .sector = 8, .value = 0xA73F5DC1D333},
+};
+
 /* Actual implementation of app<>plugin interface */
 static const NfcSupportedCardsPlugin troika_plugin = {
     .protocol = NfcProtocolMfClassic,
     .verify = troika_verify,
     .read = troika_read,
     .parse = troika_parse,
+    .hints = troika_hints,
+    .hints_count = COUNT_OF(troika_hints),
 };
 
 /* Plugin descriptor to comply with basic plugin specification */
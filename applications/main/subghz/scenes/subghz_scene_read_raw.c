@@ -233,6 +233,8 @@ bool subghz_scene_read_raw_on_event(void* context, SceneManagerEvent event) {
             subghz->state_notifications = SubGhzNotificationStateIDLE;
             subghz_txrx_stop(subghz->txrx);
             subghz_read_raw_stop_send(subghz->subghz_read_raw);
+            // Files that were not recorded here get their sidecar after the first replay
+            subghz_update_raw_sidecar(subghz, furi_string_get_cstr(subghz->file_path));
             consumed = true;
             break;
 
@@ -253,13 +255,14 @@ bool subghz_scene_read_raw_on_event(void* context, SceneManagerEvent event) {
                 subghz_txrx_get_fff_data(subghz->txrx),
                 furi_string_get_cstr(temp_str),
                 subghz_txrx_radio_device_get_name(subghz->txrx));
-            furi_string_free(temp_str);
 
             if(spl_count > 0) {
+                subghz_update_raw_sidecar(subghz, furi_string_get_cstr(temp_str));
                 notification_message(subghz->notifications, &sequence_set_green_255);
             } else {
                 notification_message(subghz->notifications, &sequence_reset_rgb);
             }
+            furi_string_free(temp_str);
 
             subghz->state_notifications = SubGhzNotificationStateIDLE;
             subghz_rx_key_state_set(subghz, SubGhzRxKeyStateAddKey);
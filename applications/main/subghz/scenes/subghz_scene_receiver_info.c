@@ -10,14 +10,14 @@ void subghz_scene_receiver_info_callback(SubGhzCustomEvent event, void* context)
 
 static bool subghz_scene_receiver_info_update_parser(void* context) {
     SubGhz* subghz = context;
+    FlipperFormat* raw_data =
+        subghz_history_get_raw_data(subghz->history, subghz->idx_menu_chosen);
+    const char* protocol_name =
+        subghz_history_get_protocol_name(subghz->history, subghz->idx_menu_chosen);
 
-    if(subghz_txrx_load_decoder_by_name_protocol(
-           subghz->txrx,
-           subghz_history_get_protocol_name(subghz->history, subghz->idx_menu_chosen))) {
+    if(raw_data && subghz_txrx_load_decoder_by_name_protocol(subghz->txrx, protocol_name)) {
         // we are trying to deserialize without checking for errors, since it is assumed that we just received this chignal
-        subghz_protocol_decoder_base_deserialize(
-            subghz_txrx_get_decoder(subghz->txrx),
-            subghz_history_get_raw_data(subghz->history, subghz->idx_menu_chosen));
+        subghz_protocol_decoder_base_deserialize(subghz_txrx_get_decoder(subghz->txrx), raw_data);
 
         SubGhzRadioPreset* preset =
             subghz_history_get_radio_preset(subghz->history, subghz->idx_menu_chosen);
@@ -77,11 +77,14 @@ bool subghz_scene_receiver_info_on_event(void* context, SceneManagerEvent event)
             if(!subghz_scene_receiver_info_update_parser(subghz)) {
                 return false;
             }
+            FlipperFormat* raw_data =
+                subghz_history_get_raw_data(subghz->history, subghz->idx_menu_chosen);
+            if(!raw_data) {
+                return false;
+            }
             //CC1101 Stop RX -> Start TX
             subghz_txrx_hopper_pause(subghz->txrx);
-            if(!subghz_tx_start(
-                   subghz,
-                   subghz_history_get_raw_data(subghz->history, subghz->idx_menu_chosen))) {
+            if(!subghz_tx_start(subghz, raw_data)) {
                 subghz_txrx_rx_start(subghz->txrx);
                 subghz_txrx_hopper_unpause(subghz->txrx);
                 subghz->state_notifications = SubGhzNotificationStateRx;
@@ -116,10 +116,13 @@ bool subghz_scene_save_name_on_event(void* context, SceneManagerEvent event) {
                             SubGhzSceneSetType,
                             SubGhzCustomEventManagerNoSet);
                     } else {
+                        FlipperFormat* raw_data =
+                            subghz_history_get_raw_data(subghz->history, subghz->idx_menu_chosen);
+                        if(!raw_data) {
+                            return false;
+                        }
                         subghz_save_protocol_to_file(
-                            subghz,
-                            subghz_history_get_raw_data(subghz->history, subghz->idx_menu_chosen),
-                            furi_string_get_cstr(subghz->file_path));
+                            subghz, raw_data, furi_string_get_cstr(subghz->file_path));
                     }
                 }
 
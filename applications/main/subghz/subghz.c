@@ -54,6 +54,12 @@ SubGhz* subghz_alloc(void) {
     subghz->file_path = furi_string_alloc();
     subghz->file_path_tmp = furi_string_alloc();
 
+    // RAW sidecar builder
+    subghz->sidecar_path = furi_string_alloc();
+    subghz->sidecar_thread =
+        furi_thread_alloc_ex("SubGhzSidecar", 2048, subghz_update_raw_sidecar_thread, subghz);
+    furi_thread_set_priority(subghz->sidecar_thread, FuriThreadPriorityLow);
+
     // GUI
     subghz->gui = furi_record_open(RECORD_GUI);
 
@@ -228,6 +234,11 @@ void subghz_free(SubGhz* subghz) {
     furi_record_close(RECORD_NOTIFICATION);
     subghz->notifications = NULL;
 
+    // RAW sidecar builder
+    furi_thread_join(subghz->sidecar_thread);
+    furi_thread_free(subghz->sidecar_thread);
+    furi_string_free(subghz->sidecar_path);
+
     // Path strings
     furi_string_free(subghz->file_path);
     furi_string_free(subghz->file_path_tmp);
@@ -1,93 +1,168 @@
 #include "subghz_history.h"
 #include <lib/subghz/receiver.h>
-#include <lib/subghz/protocols/came.h>
+#include <lib/flipper_format/flipper_format_i.h>
+#include <storage/storage.h>
 
 #include <furi.h>
 
-#define SUBGHZ_HISTORY_MAX       50
+#define SUBGHZ_HISTORY_MAX       2048
 #define SUBGHZ_HISTORY_FREE_HEAP 20480
 
+/** Records are allocated in blocks, so growing the history never moves them */
+#define SUBGHZ_HISTORY_BLOCK_SIZE  64
+#define SUBGHZ_HISTORY_BLOCK_COUNT (SUBGHZ_HISTORY_MAX / SUBGHZ_HISTORY_BLOCK_SIZE)
+
+/** Serialized items are kept in RAM till the arena is full, then the full arena is appended to
+ * the spill file by subghz_history_flush while the other one takes new items */
+#define SUBGHZ_HISTORY_ARENA_SIZE 4096
+#define SUBGHZ_HISTORY_SPILL_PATH SUBGHZ_APP_FOLDER "/.history.tmp"
+
+/** Names and presets are referenced by 8 bit index */
+#define SUBGHZ_HISTORY_TABLE_MAX UINT8_MAX
+
 #define TAG "SubGhzHistory"
 
 typedef struct {
-    FuriString* item_str;
-    FlipperFormat* flipper_string;
+    uint8_t key[sizeof(uint64_t)];
+    uint32_t frequency;
+    uint32_t timestamp;
+    uint32_t offset; /**< of the serialized item, in the spill file or the arena after it */
+    uint16_t size;
+    uint16_t bit_count;
+    uint8_t name;
+    uint8_t preset;
     uint8_t type;
-    SubGhzRadioPreset* preset;
+    int8_t rssi;
 } SubGhzHistoryItem;
 
-ARRAY_DEF(SubGhzHistoryItemArray, SubGhzHistoryItem, M_POD_OPLIST)
+typedef struct {
+    const char* protocol;
+    FuriString* label;
+} SubGhzHistoryName;
 
-#define M_OPL_SubGhzHistoryItemArray_t() ARRAY_OPLIST(SubGhzHistoryItemArray, M_POD_OPLIST)
+ARRAY_DEF(SubGhzHistoryNameArray, SubGhzHistoryName, M_POD_OPLIST)
+ARRAY_DEF(SubGhzHistoryPresetArray, SubGhzRadioPreset, M_POD_OPLIST)
 
-typedef struct {
-    SubGhzHistoryItemArray_t data;
-} SubGhzHistoryStruct;
+#define M_OPL_SubGhzHistoryNameArray_t() ARRAY_OPLIST(SubGhzHistoryNameArray, M_POD_OPLIST)
+#define M_OPL_SubGhzHistoryPresetArray_t() \
+    ARRAY_OPLIST(SubGhzHistoryPresetArray, M_POD_OPLIST)
 
 struct SubGhzHistory {
     uint32_t last_update_timestamp;
     uint16_t last_index_write;
     uint8_t code_last_hash_data;
     FuriString* tmp_string;
-    SubGhzHistoryStruct* history;
+    FuriMutex* mutex;
+
+    SubGhzHistoryItem* blocks[SUBGHZ_HISTORY_BLOCK_COUNT];
+    SubGhzHistoryNameArray_t names;
+    SubGhzHistoryPresetArray_t presets;
+
+    uint8_t* arena; /**< takes new items */
+    size_t arena_used;
+    uint8_t* arena_full; /**< waits to be spilled, items after it are in the arena */
+    size_t arena_full_used;
+    uint32_t spilled;
+    bool spill_failed;
+    Storage* storage;
+    File* spill_file;
+
+    FlipperFormat* serialized; /**< scratch for new items, used by the worker */
+    FlipperFormat* materialized; /**< returned item */
+    SubGhzRadioPreset preset;
 };
 
 SubGhzHistory* subghz_history_alloc(void) {
     SubGhzHistory* instance = malloc(sizeof(SubGhzHistory));
     instance->tmp_string = furi_string_alloc();
-    instance->history = malloc(sizeof(SubGhzHistoryStruct));
-    SubGhzHistoryItemArray_init(instance->history->data);
+    instance->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    SubGhzHistoryNameArray_init(instance->names);
+    SubGhzHistoryPresetArray_init(instance->presets);
+    instance->arena = malloc(SUBGHZ_HISTORY_ARENA_SIZE);
+    instance->arena_full = malloc(SUBGHZ_HISTORY_ARENA_SIZE);
+    instance->storage = furi_record_open(RECORD_STORAGE);
+    instance->serialized = flipper_format_string_alloc();
+    instance->materialized = flipper_format_string_alloc();
     return instance;
 }
 
+static void subghz_history_clear(SubGhzHistory* instance) {
+    for(size_t i = 0; i < SUBGHZ_HISTORY_BLOCK_COUNT; i++) {
+        free(instance->blocks[i]);
+        instance->blocks[i] = NULL;
+    }
+    for
+        M_EACH(name, instance->names, SubGhzHistoryNameArray_t) {
+            furi_string_free(name->label);
+        }
+    SubGhzHistoryNameArray_reset(instance->names);
+    for
+        M_EACH(preset, instance->presets, SubGhzHistoryPresetArray_t) {
+            furi_string_free(preset->name);
+        }
+    SubGhzHistoryPresetArray_reset(instance->presets);
+
+    instance->arena_used = 0;
+    instance->arena_full_used = 0;
+    instance->spilled = 0;
+    instance->spill_failed = false;
+    if(instance->spill_file) {
+        storage_file_free(instance->spill_file);
+        instance->spill_file = NULL;
+        storage_simply_remove(instance->storage, SUBGHZ_HISTORY_SPILL_PATH);
+    }
+    instance->last_index_write = 0;
+}
+
 void subghz_history_free(SubGhzHistory* instance) {
     furi_assert(instance);
+    subghz_history_clear(instance);
     furi_string_free(instance->tmp_string);
-    for
-        M_EACH(item, instance->history->data, SubGhzHistoryItemArray_t) {
-            furi_string_free(item->item_str);
-            furi_string_free(item->preset->name);
-            free(item->preset);
-            flipper_format_free(item->flipper_string);
-            item->type = 0;
-        }
-    SubGhzHistoryItemArray_clear(instance->history->data);
-    free(instance->history);
+    furi_mutex_free(instance->mutex);
+    SubGhzHistoryNameArray_clear(instance->names);
+    SubGhzHistoryPresetArray_clear(instance->presets);
+    free(instance->arena);
+    free(instance->arena_full);
+    furi_record_close(RECORD_STORAGE);
+    flipper_format_free(instance->serialized);
+    flipper_format_free(instance->materialized);
     free(instance);
 }
 
+static SubGhzHistoryItem* subghz_history_get(SubGhzHistory* instance, uint16_t idx) {
+    furi_check(idx < instance->last_index_write);
+    return &instance->blocks[idx / SUBGHZ_HISTORY_BLOCK_SIZE][idx % SUBGHZ_HISTORY_BLOCK_SIZE];
+}
+
 uint32_t subghz_history_get_frequency(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->preset->frequency;
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    uint32_t frequency = subghz_history_get(instance, idx)->frequency;
+    furi_mutex_release(instance->mutex);
+    return frequency;
 }
 
 SubGhzRadioPreset* subghz_history_get_radio_preset(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->preset;
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
+    instance->preset = *SubGhzHistoryPresetArray_get(instance->presets, item->preset);
+    instance->preset.frequency = item->frequency;
+    furi_mutex_release(instance->mutex);
+    return &instance->preset;
 }
 
 const char* subghz_history_get_preset(SubGhzHistory* instance, uint16_t idx) {
-    furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return furi_string_get_cstr(item->preset->name);
+    return furi_string_get_cstr(subghz_history_get_radio_preset(instance, idx)->name);
 }
 
 void subghz_history_reset(SubGhzHistory* instance) {
     furi_assert(instance);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
     furi_string_reset(instance->tmp_string);
-    for
-        M_EACH(item, instance->history->data, SubGhzHistoryItemArray_t) {
-            furi_string_free(item->item_str);
-            furi_string_free(item->preset->name);
-            free(item->preset);
-            flipper_format_free(item->flipper_string);
-            item->type = 0;
-        }
-    SubGhzHistoryItemArray_reset(instance->history->data);
-    instance->last_index_write = 0;
+    subghz_history_clear(instance);
     instance->code_last_hash_data = 0;
+    furi_mutex_release(instance->mutex);
 }
 
 uint16_t subghz_history_get_item(SubGhzHistory* instance) {
@@ -97,30 +172,65 @@ uint16_t subghz_history_get_item(SubGhzHistory* instance) {
 
 uint8_t subghz_history_get_type_protocol(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    return item->type;
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    uint8_t type = subghz_history_get(instance, idx)->type;
+    furi_mutex_release(instance->mutex);
+    return type;
 }
 
 const char* subghz_history_get_protocol_name(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    flipper_format_rewind(item->flipper_string);
-    if(!flipper_format_read_string(item->flipper_string, "Protocol", instance->tmp_string)) {
-        FURI_LOG_E(TAG, "Missing Protocol");
-        furi_string_reset(instance->tmp_string);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
+    const char* protocol = SubGhzHistoryNameArray_get(instance->names, item->name)->protocol;
+    furi_mutex_release(instance->mutex);
+    return protocol;
+}
+
+// Items in RAM are copied under the lock, spilled ones are read after it is released
+static const uint8_t*
+    subghz_history_find_data(SubGhzHistory* instance, const SubGhzHistoryItem* item) {
+    const uint32_t arena_start = instance->spilled + instance->arena_full_used;
+
+    if(item->offset >= arena_start) {
+        return instance->arena + (item->offset - arena_start);
+    } else if(item->offset >= instance->spilled) {
+        return instance->arena_full + (item->offset - instance->spilled);
+    } else {
+        return NULL;
     }
-    return furi_string_get_cstr(instance->tmp_string);
 }
 
 FlipperFormat* subghz_history_get_raw_data(SubGhzHistory* instance, uint16_t idx) {
     furi_assert(instance);
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    if(item->flipper_string) {
-        return item->flipper_string;
+    Stream* stream = flipper_format_get_raw_stream(instance->materialized);
+    stream_clean(stream);
+
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    const SubGhzHistoryItem item = *subghz_history_get(instance, idx);
+    const uint8_t* data = subghz_history_find_data(instance, &item);
+    bool result = data && stream_write(stream, data, item.size) == item.size;
+    furi_mutex_release(instance->mutex);
+
+    // Spilled part of the file is never changed, the file is used only by the caller thread
+    if(!data) {
+        uint8_t* buffer = malloc(item.size);
+        result = storage_file_seek(instance->spill_file, item.offset, true) &&
+                 storage_file_read(instance->spill_file, buffer, item.size) == item.size &&
+                 stream_write(stream, buffer, item.size) == item.size;
+        free(buffer);
+
+        if(!result) FURI_LOG_E(TAG, "Failed to read item at %lu", item.offset);
+    }
+
+    if(result) {
+        flipper_format_rewind(instance->materialized);
+        return instance->materialized;
     } else {
         return NULL;
     }
 }
+
 bool subghz_history_get_text_space_left(SubGhzHistory* instance, FuriString* output) {
     furi_assert(instance);
     if(memmgr_get_free_heap() < SUBGHZ_HISTORY_FREE_HEAP) {
@@ -137,104 +247,259 @@ bool subghz_history_get_text_space_left(SubGhzHistory* instance, FuriString* out
 }
 
 void subghz_history_get_text_item_menu(SubGhzHistory* instance, FuriString* output, uint16_t idx) {
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_get(instance->history->data, idx);
-    furi_string_set(output, item->item_str);
+    furi_assert(instance);
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    SubGhzHistoryItem* item = subghz_history_get(instance, idx);
+    const char* label =
+        furi_string_get_cstr(SubGhzHistoryNameArray_get(instance->names, item->name)->label);
+
+    uint64_t data = 0;
+    for(uint8_t i = 0; i < sizeof(uint64_t); i++) {
+        data = (data << 8) | item->key[i];
+    }
+    if(data != 0) {
+        if(!(uint32_t)(data >> 32)) {
+            furi_string_printf(output, "%s %lX", label, (uint32_t)(data & 0xFFFFFFFF));
+        } else {
+            furi_string_printf(
+                output,
+                "%s %lX%08lX",
+                label,
+                (uint32_t)(data >> 32),
+                (uint32_t)(data & 0xFFFFFFFF));
+        }
+    } else {
+        furi_string_printf(output, "%s", label);
+    }
+    furi_mutex_release(instance->mutex);
 }
 
-bool subghz_history_add_to_history(
+static bool subghz_history_find_name(
     SubGhzHistory* instance,
-    void* context,
-    SubGhzRadioPreset* preset) {
-    furi_assert(instance);
-    furi_assert(context);
+    const char* protocol,
+    FuriString* label,
+    uint8_t* index) {
+    size_t count = SubGhzHistoryNameArray_size(instance->names);
+    for(size_t i = 0; i < count; i++) {
+        SubGhzHistoryName* name = SubGhzHistoryNameArray_get(instance->names, i);
+        if(name->protocol == protocol && furi_string_equal(name->label, label)) {
+            *index = i;
+            return true;
+        }
+    }
+    if(count == SUBGHZ_HISTORY_TABLE_MAX) return false;
 
-    if(memmgr_get_free_heap() < SUBGHZ_HISTORY_FREE_HEAP) return false;
-    if(instance->last_index_write >= SUBGHZ_HISTORY_MAX) return false;
+    SubGhzHistoryName* name = SubGhzHistoryNameArray_push_raw(instance->names);
+    name->protocol = protocol;
+    name->label = furi_string_alloc_set(label);
+    *index = count;
+    return true;
+}
 
-    SubGhzProtocolDecoderBase* decoder_base = context;
-    if((instance->code_last_hash_data ==
-        subghz_protocol_decoder_base_get_hash_data(decoder_base)) &&
-       ((furi_get_tick() - instance->last_update_timestamp) < 500)) {
-        instance->last_update_timestamp = furi_get_tick();
+static bool subghz_history_find_preset(
+    SubGhzHistory* instance,
+    SubGhzRadioPreset* preset,
+    uint8_t* index) {
+    size_t count = SubGhzHistoryPresetArray_size(instance->presets);
+    for(size_t i = 0; i < count; i++) {
+        SubGhzRadioPreset* item = SubGhzHistoryPresetArray_get(instance->presets, i);
+        if(item->data == preset->data && item->data_size == preset->data_size &&
+           furi_string_equal(item->name, preset->name)) {
+            *index = i;
+            return true;
+        }
+    }
+    if(count == SUBGHZ_HISTORY_TABLE_MAX) return false;
+
+    SubGhzRadioPreset* item = SubGhzHistoryPresetArray_push_raw(instance->presets);
+    item->name = furi_string_alloc_set(preset->name);
+    item->frequency = 0;
+    item->data = preset->data;
+    item->data_size = preset->data_size;
+    *index = count;
+    return true;
+}
+
+// Append-only, called without the lock: the full arena is not touched by the worker
+static bool subghz_history_spill(SubGhzHistory* instance, const uint8_t* data, size_t size) {
+    if(!instance->spill_file) {
+        storage_simply_mkdir(instance->storage, SUBGHZ_APP_FOLDER);
+        instance->spill_file = storage_file_alloc(instance->storage);
+        if(!storage_file_open(
+               instance->spill_file,
+               SUBGHZ_HISTORY_SPILL_PATH,
+               FSAM_READ_WRITE,
+               FSOM_CREATE_ALWAYS)) {
+            FURI_LOG_E(TAG, "Failed to open spill file");
+            storage_file_free(instance->spill_file);
+            instance->spill_file = NULL;
+            return false;
+        }
+    }
+
+    if(!storage_file_seek(instance->spill_file, instance->spilled, true) ||
+       storage_file_write(instance->spill_file, data, size) != size) {
+        FURI_LOG_E(TAG, "Failed to spill items");
         return false;
     }
 
-    instance->code_last_hash_data = subghz_protocol_decoder_base_get_hash_data(decoder_base);
-    instance->last_update_timestamp = furi_get_tick();
+    return true;
+}
+
+void subghz_history_flush(SubGhzHistory* instance) {
+    furi_assert(instance);
+
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    const size_t size = instance->spill_failed ? 0 : instance->arena_full_used;
+    furi_mutex_release(instance->mutex);
+
+    if(!size) return;
+
+    // Items stay readable from RAM if the card fails, new ones are dropped once the arena is full
+    const bool result = subghz_history_spill(instance, instance->arena_full, size);
+
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    if(result) {
+        instance->spilled += size;
+        instance->arena_full_used = 0;
+    } else {
+        instance->spill_failed = true;
+    }
+    furi_mutex_release(instance->mutex);
+}
 
-    FuriString* text;
-    text = furi_string_alloc();
-    SubGhzHistoryItem* item = SubGhzHistoryItemArray_push_raw(instance->history->data);
-    item->preset = malloc(sizeof(SubGhzRadioPreset));
-    item->type = decoder_base->protocol->type;
-    item->preset->frequency = preset->frequency;
-    item->preset->name = furi_string_alloc();
-    furi_string_set(item->preset->name, preset->name);
-    item->preset->data = preset->data;
-    item->preset->data_size = preset->data_size;
-
-    item->item_str = furi_string_alloc();
-    item->flipper_string = flipper_format_string_alloc();
-    subghz_protocol_decoder_base_serialize(decoder_base, item->flipper_string, preset);
+// Label shown in the menu and key are taken from the serialized item
+static void subghz_history_parse(
+    SubGhzHistory* instance,
+    FuriString* label,
+    SubGhzHistoryItem* item) {
+    FlipperFormat* flipper_format = instance->serialized;
+    FuriString* text = furi_string_alloc();
 
     do {
-        if(!flipper_format_rewind(item->flipper_string)) {
+        if(!flipper_format_rewind(flipper_format)) {
             FURI_LOG_E(TAG, "Rewind error");
             break;
         }
-        if(!flipper_format_read_string(item->flipper_string, "Protocol", instance->tmp_string)) {
+        if(!flipper_format_read_string(flipper_format, "Protocol", label)) {
             FURI_LOG_E(TAG, "Missing Protocol");
             break;
         }
-        if(!strcmp(furi_string_get_cstr(instance->tmp_string), "KeeLoq")) {
-            furi_string_set(instance->tmp_string, "KL ");
-            if(!flipper_format_read_string(item->flipper_string, "Manufacture", text)) {
+        if(!strcmp(furi_string_get_cstr(label), "KeeLoq")) {
+            furi_string_set(label, "KL ");
+            if(!flipper_format_read_string(flipper_format, "Manufacture", text)) {
                 FURI_LOG_E(TAG, "Missing Protocol");
                 break;
             }
-            furi_string_cat(instance->tmp_string, text);
-        } else if(!strcmp(furi_string_get_cstr(instance->tmp_string), "Star Line")) {
-            furi_string_set(instance->tmp_string, "SL ");
-            if(!flipper_format_read_string(item->flipper_string, "Manufacture", text)) {
+            furi_string_cat(label, text);
+        } else if(!strcmp(furi_string_get_cstr(label), "Star Line")) {
+            furi_string_set(label, "SL ");
+            if(!flipper_format_read_string(flipper_format, "Manufacture", text)) {
                 FURI_LOG_E(TAG, "Missing Protocol");
                 break;
             }
-            furi_string_cat(instance->tmp_string, text);
+            furi_string_cat(label, text);
+        }
+        if(!flipper_format_rewind(flipper_format)) {
+            FURI_LOG_E(TAG, "Rewind error");
+            break;
+        }
+        uint32_t bit_count = 0;
+        if(flipper_format_read_uint32(flipper_format, "Bit", &bit_count, 1)) {
+            item->bit_count = MIN(bit_count, (uint32_t)UINT16_MAX);
         }
-        if(!flipper_format_rewind(item->flipper_string)) {
+        if(!flipper_format_rewind(flipper_format)) {
             FURI_LOG_E(TAG, "Rewind error");
             break;
         }
-        uint8_t key_data[sizeof(uint64_t)] = {0};
-        if(!flipper_format_read_hex(item->flipper_string, "Key", key_data, sizeof(uint64_t))) {
+        if(!flipper_format_read_hex(flipper_format, "Key", item->key, sizeof(uint64_t))) {
             FURI_LOG_D(TAG, "No Key");
         }
-        uint64_t data = 0;
-        for(uint8_t i = 0; i < sizeof(uint64_t); i++) {
-            data = (data << 8) | key_data[i];
-        }
-        if(data != 0) {
-            if(!(uint32_t)(data >> 32)) {
-                furi_string_printf(
-                    item->item_str,
-                    "%s %lX",
-                    furi_string_get_cstr(instance->tmp_string),
-                    (uint32_t)(data & 0xFFFFFFFF));
-            } else {
-                furi_string_printf(
-                    item->item_str,
-                    "%s %lX%08lX",
-                    furi_string_get_cstr(instance->tmp_string),
-                    (uint32_t)(data >> 32),
-                    (uint32_t)(data & 0xFFFFFFFF));
+    } while(false);
+
+    furi_string_free(text);
+}
+
+bool subghz_history_add_to_history(
+    SubGhzHistory* instance,
+    void* context,
+    SubGhzRadioPreset* preset,
+    float rssi) {
+    furi_assert(instance);
+    furi_assert(context);
+
+    if(memmgr_get_free_heap() < SUBGHZ_HISTORY_FREE_HEAP) return false;
+    if(instance->last_index_write >= SUBGHZ_HISTORY_MAX) return false;
+
+    SubGhzProtocolDecoderBase* decoder_base = context;
+    if((instance->code_last_hash_data ==
+        subghz_protocol_decoder_base_get_hash_data(decoder_base)) &&
+       ((furi_get_tick() - instance->last_update_timestamp) < 500)) {
+        instance->last_update_timestamp = furi_get_tick();
+        return false;
+    }
+
+    instance->code_last_hash_data = subghz_protocol_decoder_base_get_hash_data(decoder_base);
+    instance->last_update_timestamp = furi_get_tick();
+
+    Stream* stream = flipper_format_get_raw_stream(instance->serialized);
+    stream_clean(stream);
+    subghz_protocol_decoder_base_serialize(decoder_base, instance->serialized, preset);
+    const size_t size = stream_size(stream);
+    if(size > SUBGHZ_HISTORY_ARENA_SIZE) {
+        FURI_LOG_E(TAG, "Item is too large: %zu", size);
+        return false;
+    }
+
+    SubGhzHistoryItem item = {
+        .frequency = preset->frequency,
+        .timestamp = furi_hal_rtc_get_timestamp(),
+        .size = size,
+        .type = decoder_base->protocol->type,
+        .rssi = (int8_t)CLAMP(rssi, (float)INT8_MAX, (float)INT8_MIN),
+    };
+    subghz_history_parse(instance, instance->tmp_string, &item);
+
+    furi_check(furi_mutex_acquire(instance->mutex, FuriWaitForever) == FuriStatusOk);
+    bool result = false;
+
+    do {
+        if(!subghz_history_find_name(
+               instance, decoder_base->protocol->name, instance->tmp_string, &item.name) ||
+           !subghz_history_find_preset(instance, preset, &item.preset)) {
+            FURI_LOG_E(TAG, "Too many protocols or presets");
+            break;
+        }
+
+        // No card access here, the arenas are swapped and the full one is spilled by the GUI
+        if(instance->arena_used + size > SUBGHZ_HISTORY_ARENA_SIZE) {
+            if(instance->arena_full_used) {
+                FURI_LOG_W(TAG, "Arena is not spilled yet, item dropped");
+                break;
             }
-        } else {
-            furi_string_printf(item->item_str, "%s", furi_string_get_cstr(instance->tmp_string));
+            uint8_t* arena = instance->arena_full;
+            instance->arena_full = instance->arena;
+            instance->arena_full_used = instance->arena_used;
+            instance->arena = arena;
+            instance->arena_used = 0;
+        }
+
+        const size_t block = instance->last_index_write / SUBGHZ_HISTORY_BLOCK_SIZE;
+        if(!instance->blocks[block]) {
+            instance->blocks[block] =
+                malloc(sizeof(SubGhzHistoryItem) * SUBGHZ_HISTORY_BLOCK_SIZE);
         }
 
+        item.offset = instance->spilled + instance->arena_full_used + instance->arena_used;
+        stream_rewind(stream);
+        stream_read(stream, instance->arena + instance->arena_used, size);
+        instance->arena_used += size;
+
+        instance->blocks[block][instance->last_index_write % SUBGHZ_HISTORY_BLOCK_SIZE] = item;
+        instance->last_index_write++;
+        result = true;
     } while(false);
 
-    furi_string_free(text);
-    instance->last_index_write++;
-    return true;
+    furi_mutex_release(instance->mutex);
+    return result;
 }
@@ -1,4 +1,14 @@
-
+/**
+ * @file subghz_history.h
+ * SubGhz: history of received signals
+ *
+ * Items are kept as fixed size records. Serialized items are kept in a RAM
+ * arena. When it is full, new items go to a second arena and the full one is
+ * appended to a spill file on the SD card by subghz_history_flush, so the
+ * worker never waits for the card. Items are loaded back into FlipperFormat
+ * only when an item is opened. Access is thread safe: items are added by the
+ * worker, shown, opened and flushed by the GUI.
+ */
 #pragma once
 
 #include <math.h>
@@ -35,6 +45,14 @@ void subghz_history_reset(SubGhzHistory* instance);
  */
 uint32_t subghz_history_get_frequency(SubGhzHistory* instance, uint16_t idx);
 
+/** Get radio preset to history[idx]
+ * 
+ * @warning returned data is valid till next call
+ * 
+ * @param instance  - SubGhzHistory instance
+ * @param idx       - record index  
+ * @return preset   - SubGhzRadioPreset
+ */
 SubGhzRadioPreset* subghz_history_get_radio_preset(SubGhzHistory* instance, uint16_t idx);
 
 /** Get preset to history[idx]
@@ -89,17 +107,30 @@ bool subghz_history_get_text_space_left(SubGhzHistory* instance, FuriString* out
  * @param instance  - SubGhzHistory instance
  * @param context    - SubGhzProtocolCommon context
  * @param preset    - SubGhzRadioPreset preset
+ * @param rssi      - signal RSSI, dBm
  * @return bool;
  */
 bool subghz_history_add_to_history(
     SubGhzHistory* instance,
     void* context,
-    SubGhzRadioPreset* preset);
+    SubGhzRadioPreset* preset,
+    float rssi);
+
+/** Write the full arena to the SD card, if there is one
+ * 
+ * Call periodically from the GUI thread while receiving, items are dropped
+ * if both arenas are full.
+ * 
+ * @param instance  - SubGhzHistory instance
+ */
+void subghz_history_flush(SubGhzHistory* instance);
 
 /** Get SubGhzProtocolCommonLoad to load into the protocol decoder bin data
+ * 
+ * @warning returned data is valid till next call
  * 
  * @param instance  - SubGhzHistory instance
  * @param idx       - record index
- * @return SubGhzProtocolCommonLoad*
+ * @return SubGhzProtocolCommonLoad*, NULL if the item can not be read
  */
 FlipperFormat* subghz_history_get_raw_data(SubGhzHistory* instance, uint16_t idx);
@@ -13,6 +13,7 @@
 #include <flipper_format/flipper_format_i.h>
 #include <lib/toolbox/stream/stream.h>
 #include <lib/subghz/protocols/raw.h>
+#include <lib/subghz/subghz_file_encoder_worker.h>
 
 #define TAG "SubGhz"
 
@@ -287,6 +288,7 @@ bool subghz_save_protocol_to_file(
         if(!storage_simply_remove(storage, dev_file_name)) {
             break;
         }
+        subghz_file_encoder_worker_remove_sidecar(storage, dev_file_name);
         stream_seek(flipper_format_stream, 0, StreamOffsetFromStart);
         stream_save_to_file(flipper_format_stream, storage, dev_file_name, FSOM_CREATE_ALWAYS);
 
@@ -350,6 +352,10 @@ bool subghz_rename_file(SubGhz* subghz) {
         if(fs_result != FSE_OK) {
             dialog_message_show_storage_error(subghz->dialogs, "Cannot rename\n file/directory");
             ret = false;
+        } else {
+            subghz_file_encoder_worker_remove_sidecar(
+                storage, furi_string_get_cstr(subghz->file_path_tmp));
+            subghz_update_raw_sidecar(subghz, furi_string_get_cstr(subghz->file_path));
         }
     }
     furi_record_close(RECORD_STORAGE);
@@ -378,7 +384,9 @@ bool subghz_delete_file(SubGhz* subghz) {
     furi_assert(subghz);
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
-    bool result = storage_simply_remove(storage, furi_string_get_cstr(subghz->file_path_tmp));
+    const char* file_path = furi_string_get_cstr(subghz->file_path_tmp);
+    bool result = storage_simply_remove(storage, file_path);
+    subghz_file_encoder_worker_remove_sidecar(storage, file_path);
     furi_record_close(RECORD_STORAGE);
 
     subghz_file_name_clear(subghz);
@@ -386,6 +394,30 @@ bool subghz_delete_file(SubGhz* subghz) {
     return result;
 }
 
+int32_t subghz_update_raw_sidecar_thread(void* context) {
+    furi_assert(context);
+    SubGhz* subghz = context;
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    if(!subghz_file_encoder_worker_build_sidecar(
+           storage, furi_string_get_cstr(subghz->sidecar_path))) {
+        FURI_LOG_D(TAG, "No sidecar for %s", furi_string_get_cstr(subghz->sidecar_path));
+    }
+    furi_record_close(RECORD_STORAGE);
+
+    return 0;
+}
+
+void subghz_update_raw_sidecar(SubGhz* subghz, const char* file_path) {
+    furi_assert(subghz);
+    furi_assert(file_path);
+
+    // Only one build at a time, the previous one is short and owns sidecar_path
+    furi_thread_join(subghz->sidecar_thread);
+    furi_string_set(subghz->sidecar_path, file_path);
+    furi_thread_start(subghz->sidecar_thread);
+}
+
 void subghz_file_name_clear(SubGhz* subghz) {
     furi_assert(subghz);
     furi_string_set(subghz->file_path, SUBGHZ_APP_FOLDER);
@@ -68,6 +68,8 @@ struct SubGhz {
     SubGhzHistory* history;
     uint16_t idx_menu_chosen;
     SubGhzLoadTypeFile load_type_file;
+    FuriThread* sidecar_thread;
+    FuriString* sidecar_path;
     void* rpc_ctx;
 };
 
@@ -89,6 +91,8 @@ bool subghz_load_protocol_from_file(SubGhz* subghz);
 bool subghz_rename_file(SubGhz* subghz);
 bool subghz_file_available(SubGhz* subghz);
 bool subghz_delete_file(SubGhz* subghz);
+int32_t subghz_update_raw_sidecar_thread(void* context);
+void subghz_update_raw_sidecar(SubGhz* subghz, const char* file_path);
 void subghz_file_name_clear(SubGhz* subghz);
 bool subghz_path_is_file(FuriString* path);
 SubGhzLoadTypeFile subghz_get_load_type_file(SubGhz* subghz);
@@ -8,6 +8,13 @@ typedef struct SubGhzViewReceiver SubGhzViewReceiver;
 
 typedef void (*SubGhzViewReceiverCallback)(SubGhzCustomEvent event, void* context);
 
+/** Called from the GUI thread to get text and SubGhzProtocolType of a visible item */
+typedef void (*SubGhzViewReceiverItemCallback)(
+    uint16_t idx,
+    FuriString* text,
+    uint8_t* type,
+    void* context);
+
 void subghz_receiver_rssi(SubGhzViewReceiver* instance, float rssi);
 
 void subghz_view_receiver_set_lock(SubGhzViewReceiver* subghz_receiver, bool keyboard);
@@ -17,6 +24,11 @@ void subghz_view_receiver_set_callback(
     SubGhzViewReceiverCallback callback,
     void* context);
 
+void subghz_view_receiver_set_item_callback(
+    SubGhzViewReceiver* subghz_receiver,
+    SubGhzViewReceiverItemCallback callback,
+    void* context);
+
 SubGhzViewReceiver* subghz_view_receiver_alloc(void);
 
 void subghz_view_receiver_free(SubGhzViewReceiver* subghz_receiver);
@@ -33,10 +45,9 @@ void subghz_view_receiver_set_radio_device_type(
     SubGhzViewReceiver* subghz_receiver,
     SubGhzRadioDeviceType device_type);
 
-void subghz_view_receiver_add_item_to_menu(
-    SubGhzViewReceiver* subghz_receiver,
-    const char* name,
-    uint8_t type);
+void subghz_view_receiver_add_item_to_menu(SubGhzViewReceiver* subghz_receiver);
+
+void subghz_view_receiver_set_item_count(SubGhzViewReceiver* subghz_receiver, uint16_t count);
 
 uint16_t subghz_view_receiver_get_idx_menu(SubGhzViewReceiver* subghz_receiver);
 
@@ -191,6 +191,8 @@ bool cli_command_log_level_set_from_string(FuriString* level) {
             "<log debug> — debug information including <log info> (may impact system performance)\r\n");
         printf(
             "<log trace> — system traces including <log debug> (may impact system performance)\r\n");
+        printf(
+            "<log binary [level]> — deferred binary records, decode them with scripts/logdecode.py\r\n");
     }
     return false;
 }
@@ -201,6 +203,13 @@ void cli_command_log(Cli* cli, FuriString* args, void* context) {
     uint8_t buffer[CLI_COMMAND_LOG_BUFFER_SIZE];
     FuriLogLevel previous_level = furi_log_get_level();
     bool restore_log_level = false;
+    bool set_deferred = false;
+
+    if(furi_string_start_with_str(args, "binary")) {
+        furi_string_right(args, strlen("binary"));
+        furi_string_trim(args);
+        set_deferred = true;
+    }
 
     if(furi_string_size(args) > 0) {
         if(!cli_command_log_level_set_from_string(args)) {
@@ -220,6 +229,7 @@ void cli_command_log(Cli* cli, FuriString* args, void* context) {
     };
 
     furi_log_add_handler(log_handler);
+    if(set_deferred) set_deferred = furi_log_deferred_start(log_handler);
 
     printf("Use <log ?> to list available log levels\r\n");
     printf("Press CTRL+C to stop...\r\n");
@@ -228,6 +238,14 @@ void cli_command_log(Cli* cli, FuriString* args, void* context) {
         cli_write(cli, buffer, ret);
     }
 
+    if(set_deferred) {
+        // Pending records end up in the ring, send them before leaving
+        furi_log_deferred_stop();
+        size_t ret;
+        while((ret = furi_stream_buffer_receive(ring, buffer, CLI_COMMAND_LOG_BUFFER_SIZE, 0))) {
+            cli_write(cli, buffer, ret);
+        }
+    }
     furi_log_remove_handler(log_handler);
 
     if(restore_log_level) {
@@ -460,6 +478,19 @@ void cli_command_free(Cli* cli, FuriString* args, void* context) {
     printf("Minimum heap size: %zu\r\n", memmgr_get_minimum_free_heap());
     printf("Maximum heap block: %zu\r\n", memmgr_heap_get_max_free_block());
 
+    for(size_t i = 0; i < memmgr_heap_get_pool_count(); i++) {
+        MemmgrHeapPoolStats stats;
+        memmgr_heap_get_pool_stats(i, &stats);
+        printf(
+            "Heap pool %zu: slabs %zu, blocks %zu/%zu, peak %zu, allocs %zu\r\n",
+            stats.block_size,
+            stats.slab_count,
+            stats.used_block_count,
+            stats.block_count,
+            stats.peak_used_block_count,
+            stats.alloc_count);
+    }
+
     printf("Pool free: %zu\r\n", memmgr_pool_get_free());
     printf("Maximum pool block: %zu\r\n", memmgr_pool_get_max_block());
 }
@@ -16,6 +16,7 @@ const CanvasFontParameters canvas_font_params[FontTotalNumber] = {
 Canvas* canvas_init(void) {
     Canvas* canvas = malloc(sizeof(Canvas));
     canvas->compress_icon = compress_icon_alloc(ICON_DECOMPRESSOR_BUFFER_SIZE);
+    canvas->icon_cache = icon_cache_alloc(ICON_CACHE_BUDGET);
 
     // Initialize mutex
     canvas->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
@@ -26,6 +27,9 @@ Canvas* canvas_init(void) {
     // Setup u8g2
     u8g2_Setup_st756x_flipper(&canvas->fb, U8G2_R0, u8x8_hw_spi_stm32, u8g2_gpio_and_delay_stm32);
     canvas->orientation = CanvasOrientationHorizontal;
+    // Display content is unknown, first commit sends everything
+    canvas->committed_buffer = malloc(canvas_get_buffer_size(canvas));
+    canvas->invalidated = true;
     // Initialize display
     u8g2_InitDisplay(&canvas->fb);
     // Wake up display
@@ -40,12 +44,19 @@ Canvas* canvas_init(void) {
 
 void canvas_free(Canvas* canvas) {
     furi_check(canvas);
+    icon_cache_free(canvas->icon_cache);
     compress_icon_free(canvas->compress_icon);
+    free(canvas->committed_buffer);
     CanvasCallbackPairArray_clear(canvas->canvas_callback_pair);
     furi_mutex_free(canvas->mutex);
     free(canvas);
 }
 
+static const uint8_t*
+    canvas_decode_icon(Canvas* canvas, const uint8_t* data, size_t width, size_t height) {
+    return icon_cache_decode(canvas->icon_cache, canvas->compress_icon, data, width, height);
+}
+
 static void canvas_lock(Canvas* canvas) {
     furi_assert(canvas);
     furi_check(furi_mutex_acquire(canvas->mutex, FuriWaitForever) == FuriStatusOk);
@@ -66,9 +77,57 @@ void canvas_reset(Canvas* canvas) {
     canvas_set_font_direction(canvas, CanvasDirectionLeftToRight);
 }
 
+// Sends changed span of every tile row, returns number of bytes sent
+static size_t canvas_send_changed_tiles(Canvas* canvas) {
+    u8x8_t* u8x8 = u8g2_GetU8x8(&canvas->fb);
+    const size_t tile_width = u8x8->display_info->tile_width;
+    const size_t tile_height = u8x8->display_info->tile_height;
+    const size_t row_size = tile_width * 8;
+    const bool send_all = canvas->invalidated ||
+                          canvas->committed_orientation != canvas->orientation;
+    size_t sent = 0;
+
+    for(size_t row = 0; row < tile_height; row++) {
+        const uint8_t* buffer = canvas_get_buffer(canvas) + row * row_size;
+        uint8_t* committed = canvas->committed_buffer + row * row_size;
+        size_t first = 0;
+        size_t last = tile_width - 1;
+
+        if(!send_all) {
+            if(memcmp(buffer, committed, row_size) == 0) continue;
+            while(memcmp(buffer + first * 8, committed + first * 8, 8) == 0) {
+                first++;
+            }
+            while(memcmp(buffer + last * 8, committed + last * 8, 8) == 0) {
+                last--;
+            }
+        }
+
+        const size_t count = last - first + 1;
+        u8g2_UpdateDisplayArea(&canvas->fb, first, row, count, 1);
+        memcpy(committed + first * 8, buffer + first * 8, count * 8);
+        sent += count * 8;
+    }
+
+    if(sent) u8x8_RefreshDisplay(u8x8);
+    canvas->invalidated = false;
+    canvas->committed_orientation = canvas->orientation;
+
+    return sent;
+}
+
 void canvas_commit(Canvas* canvas) {
     furi_check(canvas);
-    u8g2_SendBuffer(&canvas->fb);
+    icon_cache_commit(canvas->icon_cache);
+
+    const size_t sent = canvas_send_changed_tiles(canvas);
+    canvas->commit_stats.commits++;
+    canvas->commit_stats.last_bytes = sent;
+    canvas->commit_stats.total_bytes += sent;
+    if(!sent) {
+        canvas->commit_stats.skipped++;
+        return;
+    }
 
     // Iterate over callbacks
     canvas_lock(canvas);
@@ -247,8 +306,8 @@ void canvas_draw_bitmap(
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* bitmap_data = NULL;
-    compress_icon_decode(canvas->compress_icon, compressed_bitmap_data, &bitmap_data);
+    const uint8_t* bitmap_data =
+        canvas_decode_icon(canvas, compressed_bitmap_data, width, height);
     canvas_draw_u8g2_bitmap(&canvas->fb, x, y, width, height, bitmap_data, IconRotation0);
 }
 
@@ -262,17 +321,11 @@ void canvas_draw_icon_animation(
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* icon_data = NULL;
-    compress_icon_decode(
-        canvas->compress_icon, icon_animation_get_data(icon_animation), &icon_data);
-    canvas_draw_u8g2_bitmap(
-        &canvas->fb,
-        x,
-        y,
-        icon_animation_get_width(icon_animation),
-        icon_animation_get_height(icon_animation),
-        icon_data,
-        IconRotation0);
+    const uint8_t width = icon_animation_get_width(icon_animation);
+    const uint8_t height = icon_animation_get_height(icon_animation);
+    const uint8_t* icon_data =
+        canvas_decode_icon(canvas, icon_animation_get_data(icon_animation), width, height);
+    canvas_draw_u8g2_bitmap(&canvas->fb, x, y, width, height, icon_data, IconRotation0);
 }
 
 static void canvas_draw_u8g2_bitmap_int(
@@ -389,8 +442,8 @@ void canvas_draw_icon_ex(
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* icon_data = NULL;
-    compress_icon_decode(canvas->compress_icon, icon_get_frame_data(icon, 0), &icon_data);
+    const uint8_t* icon_data = canvas_decode_icon(
+        canvas, icon_get_frame_data(icon, 0), icon_get_width(icon), icon_get_height(icon));
     canvas_draw_u8g2_bitmap(
         &canvas->fb, x, y, icon_get_width(icon), icon_get_height(icon), icon_data, rotation);
 }
@@ -401,8 +454,8 @@ void canvas_draw_icon(Canvas* canvas, int32_t x, int32_t y, const Icon* icon) {
 
     x += canvas->offset_x;
     y += canvas->offset_y;
-    uint8_t* icon_data = NULL;
-    compress_icon_decode(canvas->compress_icon, icon_get_frame_data(icon, 0), &icon_data);
+    const uint8_t* icon_data = canvas_decode_icon(
+        canvas, icon_get_frame_data(icon, 0), icon_get_width(icon), icon_get_height(icon));
     canvas_draw_u8g2_bitmap(
         &canvas->fb, x, y, icon_get_width(icon), icon_get_height(icon), icon_data, IconRotation0);
 }
@@ -568,6 +621,27 @@ CanvasOrientation canvas_get_orientation(const Canvas* canvas) {
     return canvas->orientation;
 }
 
+void canvas_set_icon_cache_budget(Canvas* canvas, size_t budget) {
+    furi_check(canvas);
+    icon_cache_set_budget(canvas->icon_cache, budget);
+}
+
+void canvas_get_icon_cache_stats(const Canvas* canvas, IconCacheStats* stats) {
+    furi_check(canvas);
+    icon_cache_get_stats(canvas->icon_cache, stats);
+}
+
+void canvas_invalidate(Canvas* canvas) {
+    furi_check(canvas);
+    canvas->invalidated = true;
+}
+
+void canvas_get_commit_stats(const Canvas* canvas, CanvasCommitStats* stats) {
+    furi_check(canvas);
+    furi_check(stats);
+    *stats = canvas->commit_stats;
+}
+
 void canvas_add_framebuffer_callback(Canvas* canvas, CanvasCommitCallback callback, void* context) {
     furi_check(canvas);
 
@@ -576,6 +650,8 @@ void canvas_add_framebuffer_callback(Canvas* canvas, CanvasCommitCallback callba
     canvas_lock(canvas);
     furi_check(!CanvasCallbackPairArray_count(canvas->canvas_callback_pair, p));
     CanvasCallbackPairArray_push_back(canvas->canvas_callback_pair, p);
+    // New callback has not seen the current frame yet
+    canvas->invalidated = true;
     canvas_unlock(canvas);
 }
 
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "canvas.h"
+#include "icon_cache.h"
 #include <u8g2.h>
 #include <toolbox/compress.h>
 #include <m-array.h>
@@ -13,6 +14,7 @@
 #include <furi.h>
 
 #define ICON_DECOMPRESSOR_BUFFER_SIZE (128u * 64 / 8)
+#define ICON_CACHE_BUDGET             (8u * 1024)
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,6 +37,13 @@ ARRAY_DEF(CanvasCallbackPairArray, CanvasCallbackPair, M_POD_OPLIST);
 
 ALGO_DEF(CanvasCallbackPairArray, CanvasCallbackPairArray_t);
 
+typedef struct {
+    uint32_t commits; /**< canvas commits */
+    uint32_t skipped; /**< commits without changes, nothing was sent */
+    size_t last_bytes; /**< bytes sent to the display by the last commit */
+    uint32_t total_bytes; /**< bytes sent to the display by all commits */
+} CanvasCommitStats;
+
 /** Canvas structure
  */
 struct Canvas {
@@ -45,6 +54,11 @@ struct Canvas {
     size_t width;
     size_t height;
     CompressIcon* compress_icon;
+    IconCache* icon_cache;
+    uint8_t* committed_buffer;
+    CanvasOrientation committed_orientation;
+    bool invalidated;
+    CanvasCommitStats commit_stats;
     CanvasCallbackPairArray_t canvas_callback_pair;
     FuriMutex* mutex;
 };
@@ -126,9 +140,39 @@ void canvas_draw_u8g2_bitmap(
     const uint8_t* bitmap,
     IconRotation rotation);
 
+/** Set memory budget of decoded icon cache
+ *
+ * Must be called from the thread drawing on the canvas.
+ *
+ * @param      canvas  Canvas instance
+ * @param      budget  budget in bytes, 0 disables the cache
+ */
+void canvas_set_icon_cache_budget(Canvas* canvas, size_t budget);
+
+/** Get decoded icon cache statistics
+ *
+ * @param      canvas  Canvas instance
+ * @param      stats   IconCacheStats to fill
+ */
+void canvas_get_icon_cache_stats(const Canvas* canvas, IconCacheStats* stats);
+
+/** Send the whole frame on the next commit, even if it did not change
+ *
+ * @param      canvas  Canvas instance
+ */
+void canvas_invalidate(Canvas* canvas);
+
+/** Get display update statistics
+ *
+ * @param      canvas  Canvas instance
+ * @param      stats   CanvasCommitStats to fill
+ */
+void canvas_get_commit_stats(const Canvas* canvas, CanvasCommitStats* stats);
+
 /** Add canvas commit callback.
  *
- * This callback will be called upon Canvas commit.
+ * This callback will be called upon Canvas commit, if the frame has changed
+ * since the previous one.
  * 
  * @param      canvas    Canvas instance
  * @param      callback  CanvasCommitCallback
@@ -0,0 +1,222 @@
+#include "gui_i.h"
+#include "view_i.h"
+#include "modules/menu.h"
+
+#include <applications.h>
+#include <assets_icons.h>
+#include <cli/cli.h>
+#include <lib/toolbox/args.h>
+
+#define GUI_CLI_BENCH_FRAMES_DEFAULT (500)
+#define GUI_CLI_BENCH_SCROLL_PERIOD  (10)
+
+typedef void (*GuiCliBenchDraw)(Canvas* canvas, uint32_t frame, void* context);
+
+static void gui_cli_print_usage(void) {
+    printf("Usage:\r\n");
+    printf("gui <cmd> <args>\r\n");
+    printf("Cmd list:\r\n");
+    printf("\tbench [<frames>]\t - render main menu and desktop animation, print FPS\r\n");
+    printf("\tredraw [<frames>]\t - redraw common views on display, print latency\r\n");
+}
+
+// Same items as the loader menu, scrolled down every few frames
+static Menu* gui_cli_bench_menu_alloc(void) {
+    Menu* menu = menu_alloc();
+    uint32_t index = 0;
+
+    for(size_t i = 0; i < FLIPPER_EXTERNAL_APPS_COUNT; i++) {
+        menu_add_item(
+            menu,
+            FLIPPER_EXTERNAL_APPS[i].name,
+            FLIPPER_EXTERNAL_APPS[i].icon,
+            index++,
+            NULL,
+            NULL);
+    }
+    for(size_t i = 0; i < FLIPPER_APPS_COUNT; i++) {
+        menu_add_item(menu, FLIPPER_APPS[i].name, FLIPPER_APPS[i].icon, index++, NULL, NULL);
+    }
+    menu_add_item(menu, "Settings", &A_Settings_14, index++, NULL, NULL);
+    menu_add_item(menu, "Apps", &A_Plugins_14, index++, NULL, NULL);
+
+    return menu;
+}
+
+static void gui_cli_bench_menu_draw(Canvas* canvas, uint32_t frame, void* context) {
+    View* view = context;
+
+    if(frame % GUI_CLI_BENCH_SCROLL_PERIOD == 0) {
+        InputEvent event = {.key = InputKeyDown, .type = InputTypeShort};
+        view_input(view, &event);
+    }
+    view_draw(view, canvas);
+}
+
+static void gui_cli_bench_idle_draw(Canvas* canvas, uint32_t frame, void* context) {
+    UNUSED(frame);
+    view_draw(context, canvas);
+}
+
+// Drawn the same way as one shot desktop animations
+static void gui_cli_bench_animation_draw(Canvas* canvas, uint32_t frame, void* context) {
+    const Icon* icon = context;
+    canvas_draw_bitmap(
+        canvas,
+        0,
+        0,
+        icon_get_width(icon),
+        icon_get_height(icon),
+        icon_get_frame_data(icon, frame % icon_get_frame_count(icon)));
+}
+
+static void gui_cli_bench_run(
+    Canvas* canvas,
+    const char* name,
+    uint32_t frames,
+    GuiCliBenchDraw draw,
+    void* context) {
+    for(size_t cached = 0; cached < 2; cached++) {
+        IconCacheStats before, after;
+        canvas_set_icon_cache_budget(canvas, cached ? ICON_CACHE_BUDGET : 0);
+        canvas_get_icon_cache_stats(canvas, &before);
+
+        // Frames are rendered only, display transfer time is not measured
+        const uint32_t start = furi_get_tick();
+        for(uint32_t frame = 0; frame < frames; frame++) {
+            canvas_reset(canvas);
+            draw(canvas, frame, context);
+        }
+        const uint32_t elapsed = MAX(furi_get_tick() - start, 1UL);
+
+        canvas_commit(canvas);
+        canvas_get_icon_cache_stats(canvas, &after);
+        printf(
+            "%-10s %-8s %8.1f fps, %lu hits, %lu misses, %zu bytes cached\r\n",
+            name,
+            cached ? "cached" : "decoded",
+            (double)(frames * 1000.0f / elapsed),
+            after.hits - before.hits,
+            after.misses - before.misses,
+            after.size);
+    }
+}
+
+// Whole frame is sent on every commit first, then only changed tiles
+static void gui_cli_redraw_run(
+    Canvas* canvas,
+    const char* name,
+    uint32_t frames,
+    GuiCliBenchDraw draw,
+    void* context) {
+    for(size_t partial = 0; partial < 2; partial++) {
+        CanvasCommitStats before, after;
+        canvas_get_commit_stats(canvas, &before);
+
+        const uint32_t start = furi_get_tick();
+        for(uint32_t frame = 0; frame < frames; frame++) {
+            canvas_reset(canvas);
+            draw(canvas, frame, context);
+            if(!partial) canvas_invalidate(canvas);
+            canvas_commit(canvas);
+        }
+        const uint32_t elapsed = furi_get_tick() - start;
+
+        canvas_get_commit_stats(canvas, &after);
+        printf(
+            "%-10s %-8s %6lu us/frame, %5lu bytes/frame, %lu frames skipped\r\n",
+            name,
+            partial ? "partial" : "full",
+            elapsed * 1000UL / frames,
+            (after.total_bytes - before.total_bytes) / frames,
+            after.skipped - before.skipped);
+    }
+}
+
+static bool gui_cli_read_frames(FuriString* args, const char* cmd, int* frames) {
+    *frames = GUI_CLI_BENCH_FRAMES_DEFAULT;
+
+    if(furi_string_size(args) && (!args_read_int_and_trim(args, frames) || *frames <= 0)) {
+        cli_print_usage(cmd, "[<frames>]", furi_string_get_cstr(args));
+        return false;
+    }
+
+    return true;
+}
+
+static void gui_cli_bench(Cli* cli, FuriString* args) {
+    UNUSED(cli);
+    int frames;
+
+    if(!gui_cli_read_frames(args, "gui bench", &frames)) return;
+
+    Gui* gui = furi_record_open(RECORD_GUI);
+    Canvas* canvas = gui_direct_draw_acquire(gui);
+
+    Menu* menu = gui_cli_bench_menu_alloc();
+    gui_cli_bench_run(canvas, "Main menu", frames, gui_cli_bench_menu_draw, menu_get_view(menu));
+    menu_free(menu);
+
+    gui_cli_bench_run(
+        canvas, "Animation", frames, gui_cli_bench_animation_draw, (void*)&A_Levelup1_128x64);
+
+    gui_direct_draw_release(gui);
+    furi_record_close(RECORD_GUI);
+}
+
+static void gui_cli_redraw(Cli* cli, FuriString* args) {
+    UNUSED(cli);
+    int frames;
+
+    if(!gui_cli_read_frames(args, "gui redraw", &frames)) return;
+
+    Gui* gui = furi_record_open(RECORD_GUI);
+    Canvas* canvas = gui_direct_draw_acquire(gui);
+
+    Menu* menu = gui_cli_bench_menu_alloc();
+    gui_cli_redraw_run(canvas, "Menu idle", frames, gui_cli_bench_idle_draw, menu_get_view(menu));
+    gui_cli_redraw_run(canvas, "Main menu", frames, gui_cli_bench_menu_draw, menu_get_view(menu));
+    menu_free(menu);
+
+    gui_cli_redraw_run(
+        canvas, "Animation", frames, gui_cli_bench_animation_draw, (void*)&A_Levelup1_128x64);
+
+    gui_direct_draw_release(gui);
+    furi_record_close(RECORD_GUI);
+}
+
+static void gui_cli(Cli* cli, FuriString* args, void* context) {
+    UNUSED(context);
+    FuriString* cmd = furi_string_alloc();
+
+    do {
+        if(!args_read_string_and_trim(args, cmd)) {
+            gui_cli_print_usage();
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "bench") == 0) {
+            gui_cli_bench(cli, args);
+            break;
+        }
+
+        if(furi_string_cmp_str(cmd, "redraw") == 0) {
+            gui_cli_redraw(cli, args);
+            break;
+        }
+
+        gui_cli_print_usage();
+    } while(false);
+
+    furi_string_free(cmd);
+}
+
+void gui_on_system_start(void) {
+#ifdef SRV_CLI
+    Cli* cli = furi_record_open(RECORD_CLI);
+    cli_add_command(cli, RECORD_GUI, CliCommandFlagDefault, gui_cli, NULL);
+    furi_record_close(RECORD_CLI);
+#else
+    UNUSED(gui_cli);
+#endif
+}
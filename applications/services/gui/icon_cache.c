@@ -0,0 +1,179 @@
+#include "icon_cache.h"
+
+#include <furi.h>
+#include <furi_hal.h>
+#include <m-i-list.h>
+
+#define TAG "IconCache"
+
+#define ICON_CACHE_BUCKETS (32u)
+
+/** Cache is dropped when free heap gets below this */
+#define ICON_CACHE_HEAP_RESERVE (16u * 1024)
+
+/** Frames drawn within this many canvas commits are not evicted for new ones */
+#define ICON_CACHE_HOT_FRAMES (32u)
+
+#define ICON_CACHE_FNV_BASIS (0x811C9DC5)
+#define ICON_CACHE_FNV_PRIME (0x01000193)
+
+typedef struct IconCacheEntry IconCacheEntry;
+
+struct IconCacheEntry {
+    const uint8_t* data;
+    uint32_t checksum;
+    uint32_t last_used;
+    size_t size;
+    IconCacheEntry* bucket_next;
+    ILIST_INTERFACE(IconCacheLru, IconCacheEntry);
+    uint8_t bitmap[];
+};
+
+ILIST_DEF(IconCacheLru, IconCacheEntry, M_POD_OPLIST)
+
+struct IconCache {
+    IconCacheEntry* buckets[ICON_CACHE_BUCKETS];
+    IconCacheLru_t lru;
+    IconCacheStats stats;
+    uint32_t commits;
+};
+
+static size_t icon_cache_bucket(const uint8_t* data) {
+    const uintptr_t key = (uintptr_t)data;
+    return ((key >> 2) ^ (key >> 9)) % ICON_CACHE_BUCKETS;
+}
+
+// Firmware assets never change, anything else may be freed and reused
+static bool icon_cache_is_static(const uint8_t* data) {
+    return ((uintptr_t)data >= FLASH_BASE) && ((uintptr_t)data < (FLASH_BASE + FLASH_SIZE));
+}
+
+static uint32_t icon_cache_checksum(const uint8_t* data, size_t size) {
+    uint32_t hash = ICON_CACHE_FNV_BASIS;
+    for(size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * ICON_CACHE_FNV_PRIME;
+    }
+    return hash;
+}
+
+static void icon_cache_remove(IconCache* cache, IconCacheEntry* entry) {
+    IconCacheEntry** link = &cache->buckets[icon_cache_bucket(entry->data)];
+    while(*link != entry) {
+        link = &(*link)->bucket_next;
+    }
+    *link = entry->bucket_next;
+
+    IconCacheLru_unlink(entry);
+    cache->stats.count--;
+    cache->stats.size -= entry->size;
+    free(entry);
+}
+
+// Recently drawn frames are kept unless forced, so a long animation does not churn the cache
+static bool icon_cache_evict(IconCache* cache, size_t size, bool force) {
+    while(cache->stats.size > size) {
+        IconCacheEntry* entry = IconCacheLru_back(cache->lru);
+        if(!force && cache->commits - entry->last_used < ICON_CACHE_HOT_FRAMES) return false;
+        icon_cache_remove(cache, entry);
+        cache->stats.evictions++;
+    }
+    return true;
+}
+
+IconCache* icon_cache_alloc(size_t budget) {
+    IconCache* cache = malloc(sizeof(IconCache));
+    IconCacheLru_init(cache->lru);
+    cache->stats.budget = budget;
+    return cache;
+}
+
+void icon_cache_free(IconCache* cache) {
+    furi_check(cache);
+    icon_cache_evict(cache, 0, true);
+    free(cache);
+}
+
+const uint8_t* icon_cache_decode(
+    IconCache* cache,
+    CompressIcon* compress_icon,
+    const uint8_t* data,
+    size_t width,
+    size_t height) {
+    furi_check(cache);
+    furi_check(compress_icon);
+    furi_check(data);
+
+    if(cache->stats.count && memmgr_get_free_heap() < ICON_CACHE_HEAP_RESERVE) {
+        FURI_LOG_D(TAG, "Low heap, dropping %zu frames", cache->stats.count);
+        icon_cache_evict(cache, 0, true);
+    }
+
+    const size_t compressed_size = compress_icon_get_compressed_size(data);
+    const size_t bitmap_size = ((width + 7) / 8) * height;
+    const size_t entry_size = sizeof(IconCacheEntry) + bitmap_size;
+    uint8_t* bitmap = NULL;
+
+    // Uncompressed frames are drawn straight from their data
+    if(compressed_size == 0 || entry_size > cache->stats.budget) {
+        compress_icon_decode(compress_icon, data, &bitmap);
+        return bitmap;
+    }
+
+    const uint32_t checksum =
+        icon_cache_is_static(data) ? 0 : icon_cache_checksum(data, compressed_size);
+    IconCacheEntry** bucket = &cache->buckets[icon_cache_bucket(data)];
+    for(IconCacheEntry* entry = *bucket; entry; entry = entry->bucket_next) {
+        if(entry->data != data) continue;
+
+        if(entry->checksum == checksum && entry->size == entry_size) {
+            IconCacheLru_unlink(entry);
+            IconCacheLru_push_front(cache->lru, entry);
+            entry->last_used = cache->commits;
+            cache->stats.hits++;
+            return entry->bitmap;
+        }
+
+        // Memory of the frame was reused for another one
+        icon_cache_remove(cache, entry);
+        break;
+    }
+
+    compress_icon_decode(compress_icon, data, &bitmap);
+    cache->stats.misses++;
+
+    if(memmgr_get_free_heap() >= ICON_CACHE_HEAP_RESERVE + entry_size &&
+       icon_cache_evict(cache, cache->stats.budget - entry_size, false)) {
+        IconCacheEntry* entry = malloc(entry_size);
+        entry->data = data;
+        entry->checksum = checksum;
+        entry->last_used = cache->commits;
+        entry->size = entry_size;
+        memcpy(entry->bitmap, bitmap, bitmap_size);
+
+        entry->bucket_next = *bucket;
+        *bucket = entry;
+        IconCacheLru_init_field(entry);
+        IconCacheLru_push_front(cache->lru, entry);
+        cache->stats.count++;
+        cache->stats.size += entry_size;
+    }
+
+    return bitmap;
+}
+
+void icon_cache_set_budget(IconCache* cache, size_t budget) {
+    furi_check(cache);
+    cache->stats.budget = budget;
+    icon_cache_evict(cache, budget, true);
+}
+
+void icon_cache_commit(IconCache* cache) {
+    furi_check(cache);
+    cache->commits++;
+}
+
+void icon_cache_get_stats(const IconCache* cache, IconCacheStats* stats) {
+    furi_check(cache);
+    furi_check(stats);
+    *stats = cache->stats;
+}
@@ -0,0 +1,88 @@
+/**
+ * @file icon_cache.h
+ * GUI: decoded icon cache
+ *
+ * Keeps decompressed icon frames, so redraws of static screens and looped
+ * animations do not decode the same frames again. Frames are keyed by their
+ * data pointer. Frames outside of flash are also checked against a checksum
+ * of their compressed data, since their memory may be reused. Least recently
+ * used frames are evicted when the memory budget is exceeded, except frames
+ * drawn recently: an animation larger than the budget keeps its first frames
+ * cached instead of replacing all of them in turn. The whole cache is dropped
+ * when the heap runs low.
+ */
+#pragma once
+
+#include <toolbox/compress.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct IconCache IconCache;
+
+typedef struct {
+    uint32_t hits; /**< frames drawn from the cache */
+    uint32_t misses; /**< compressed frames decoded */
+    uint32_t evictions; /**< frames dropped to fit the budget or the heap */
+    size_t count; /**< frames in the cache */
+    size_t size; /**< memory used by the cache, bytes */
+    size_t budget; /**< memory budget, bytes */
+} IconCacheStats;
+
+/** Allocate IconCache
+ *
+ * @param      budget  memory budget in bytes, 0 disables the cache
+ *
+ * @return     IconCache instance
+ */
+IconCache* icon_cache_alloc(size_t budget);
+
+/** Free IconCache
+ *
+ * @param      cache  IconCache instance
+ */
+void icon_cache_free(IconCache* cache);
+
+/** Decode icon frame, from the cache if possible
+ *
+ * @warning    returned data is valid till next call
+ *
+ * @param      cache          IconCache instance
+ * @param      compress_icon  decoder for frames missing in the cache
+ * @param      data           icon frame data
+ * @param      width          frame width
+ * @param      height         frame height
+ *
+ * @return     decoded frame
+ */
+const uint8_t* icon_cache_decode(
+    IconCache* cache,
+    CompressIcon* compress_icon,
+    const uint8_t* data,
+    size_t width,
+    size_t height);
+
+/** Set memory budget, evicts frames over the new budget
+ *
+ * @param      cache   IconCache instance
+ * @param      budget  memory budget in bytes, 0 disables the cache
+ */
+void icon_cache_set_budget(IconCache* cache, size_t budget);
+
+/** Mark the end of a frame, used to tell recently drawn icons
+ *
+ * @param      cache  IconCache instance
+ */
+void icon_cache_commit(IconCache* cache);
+
+/** Get cache statistics
+ *
+ * @param      cache  IconCache instance
+ * @param      stats  statistics
+ */
+void icon_cache_get_stats(const IconCache* cache, IconCacheStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
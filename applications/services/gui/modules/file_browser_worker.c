@@ -19,6 +19,12 @@
 #define FILE_NAME_LEN_MAX   256
 #define LONG_LOAD_THRESHOLD 100
 
+#define SNAPSHOT_DIR         EXT_PATH(".tmp")
+#define SNAPSHOT_STEP        32
+#define SNAPSHOT_BUFFER_SIZE 512
+#define SNAPSHOT_HEADER_SIZE 2
+#define SNAPSHOT_FLAG_FOLDER (1 << 0)
+
 typedef enum {
     WorkerEvtStop = (1 << 0),
     WorkerEvtLoad = (1 << 1),
@@ -34,6 +40,24 @@ typedef enum {
 
 ARRAY_DEF(IdxLastArray, int32_t)
 ARRAY_DEF(ExtFilterArray, FuriString*, FURI_STRING_OPLIST)
+ARRAY_DEF(CheckpointArray, uint32_t)
+
+// Filtered folder listing, written once when the folder is opened. Records are
+// [flags][name length][name], every SNAPSHOT_STEP-th record offset is kept in RAM.
+typedef struct {
+    File* file;
+    FuriString* file_path;
+    FuriString* folder;
+    CheckpointArray_t checkpoints;
+    uint32_t count;
+    uint32_t size;
+    uint32_t change_count;
+    bool valid;
+
+    uint8_t* buffer;
+    size_t buffer_pos;
+    size_t buffer_len;
+} BrowserSnapshot;
 
 struct BrowserWorker {
     FuriThread* thread;
@@ -48,6 +72,7 @@ struct BrowserWorker {
     bool hide_dot_files;
     IdxLastArray_t idx_last;
     ExtFilterArray_t ext_filter;
+    BrowserSnapshot snapshot;
 
     void* cb_ctx;
     BrowserWorkerFolderOpenCallback folder_cb;
@@ -167,12 +192,164 @@ static bool browser_folder_check_and_switch(FuriString* path) {
     return is_root;
 }
 
+static void browser_snapshot_init(BrowserWorker* browser, Storage* storage) {
+    BrowserSnapshot* snapshot = &browser->snapshot;
+
+    snapshot->file = storage_file_alloc(storage);
+    snapshot->file_path = furi_string_alloc_printf("%s/browser_%p.idx", SNAPSHOT_DIR, browser);
+    snapshot->folder = furi_string_alloc();
+    CheckpointArray_init(snapshot->checkpoints);
+    snapshot->buffer = malloc(SNAPSHOT_BUFFER_SIZE);
+}
+
+static void browser_snapshot_deinit(BrowserWorker* browser, Storage* storage) {
+    BrowserSnapshot* snapshot = &browser->snapshot;
+
+    if(storage_file_is_open(snapshot->file)) {
+        storage_file_close(snapshot->file);
+        storage_simply_remove(storage, furi_string_get_cstr(snapshot->file_path));
+    }
+    storage_file_free(snapshot->file);
+
+    free(snapshot->buffer);
+    CheckpointArray_clear(snapshot->checkpoints);
+    furi_string_free(snapshot->folder);
+    furi_string_free(snapshot->file_path);
+}
+
+static bool browser_snapshot_begin(BrowserSnapshot* snapshot, Storage* storage, FuriString* path) {
+    snapshot->valid = false;
+    snapshot->count = 0;
+    snapshot->size = 0;
+    snapshot->buffer_len = 0;
+    CheckpointArray_reset(snapshot->checkpoints);
+    furi_string_set(snapshot->folder, path);
+
+    // Index is kept open and rewritten in place
+    if(!storage_file_is_open(snapshot->file)) {
+        storage_simply_mkdir(storage, SNAPSHOT_DIR);
+        if(!storage_file_open(
+               snapshot->file,
+               furi_string_get_cstr(snapshot->file_path),
+               FSAM_READ_WRITE,
+               FSOM_CREATE_ALWAYS)) {
+            storage_file_close(snapshot->file);
+        }
+    }
+    return storage_file_is_open(snapshot->file) && storage_file_seek(snapshot->file, 0, true);
+}
+
+static bool browser_snapshot_flush(BrowserSnapshot* snapshot) {
+    bool result =
+        storage_file_write(snapshot->file, snapshot->buffer, snapshot->buffer_len) ==
+        snapshot->buffer_len;
+    snapshot->buffer_len = 0;
+    return result;
+}
+
+static bool browser_snapshot_add(BrowserSnapshot* snapshot, const char* name, bool is_folder) {
+    size_t name_len = strlen(name);
+    size_t record_size = SNAPSHOT_HEADER_SIZE + name_len;
+
+    if(snapshot->count % SNAPSHOT_STEP == 0) {
+        CheckpointArray_push_back(snapshot->checkpoints, snapshot->size);
+    }
+    if(snapshot->buffer_len + record_size > SNAPSHOT_BUFFER_SIZE) {
+        if(!browser_snapshot_flush(snapshot)) return false;
+    }
+
+    uint8_t* record = &snapshot->buffer[snapshot->buffer_len];
+    record[0] = is_folder ? SNAPSHOT_FLAG_FOLDER : 0;
+    record[1] = name_len;
+    memcpy(&record[SNAPSHOT_HEADER_SIZE], name, name_len);
+
+    snapshot->buffer_len += record_size;
+    snapshot->size += record_size;
+    snapshot->count++;
+    return true;
+}
+
+static void browser_snapshot_end(BrowserSnapshot* snapshot, Storage* storage, bool result) {
+    result = result && browser_snapshot_flush(snapshot) && storage_file_truncate(snapshot->file);
+    if(result) {
+        const char* folder = furi_string_get_cstr(snapshot->folder);
+        result = storage_common_change_count(storage, folder, &snapshot->change_count) == FSE_OK;
+    }
+    if(!result) {
+        // Card may have been removed, index is opened again by the next attempt
+        storage_file_close(snapshot->file);
+    }
+    snapshot->valid = result;
+}
+
+static bool
+    browser_snapshot_is_valid(BrowserSnapshot* snapshot, Storage* storage, FuriString* path) {
+    // Writes, removals and card changes all bump the storage change counter
+    uint32_t change_count;
+    return snapshot->valid && (furi_string_cmp(snapshot->folder, path) == 0) &&
+           (storage_common_change_count(storage, furi_string_get_cstr(path), &change_count) ==
+            FSE_OK) &&
+           (change_count == snapshot->change_count);
+}
+
+static bool browser_snapshot_fill(BrowserSnapshot* snapshot, size_t size) {
+    size_t available = snapshot->buffer_len - snapshot->buffer_pos;
+    if(available >= size) return true;
+
+    memmove(snapshot->buffer, &snapshot->buffer[snapshot->buffer_pos], available);
+    snapshot->buffer_pos = 0;
+    snapshot->buffer_len = available;
+    snapshot->buffer_len += storage_file_read(
+        snapshot->file,
+        &snapshot->buffer[snapshot->buffer_len],
+        SNAPSHOT_BUFFER_SIZE - snapshot->buffer_len);
+
+    return snapshot->buffer_len >= size;
+}
+
+static bool browser_snapshot_read(BrowserSnapshot* snapshot, char* name, bool* is_folder) {
+    if(!browser_snapshot_fill(snapshot, SNAPSHOT_HEADER_SIZE)) return false;
+
+    const uint8_t* record = &snapshot->buffer[snapshot->buffer_pos];
+    size_t name_len = record[1];
+    *is_folder = record[0] & SNAPSHOT_FLAG_FOLDER;
+
+    if(!browser_snapshot_fill(snapshot, SNAPSHOT_HEADER_SIZE + name_len)) return false;
+
+    record = &snapshot->buffer[snapshot->buffer_pos];
+    memcpy(name, &record[SNAPSHOT_HEADER_SIZE], name_len);
+    name[name_len] = '\0';
+    snapshot->buffer_pos += SNAPSHOT_HEADER_SIZE + name_len;
+
+    return true;
+}
+
+static bool browser_snapshot_seek(BrowserSnapshot* snapshot, uint32_t index) {
+    snapshot->buffer_pos = 0;
+    snapshot->buffer_len = 0;
+
+    if(index == snapshot->count) return true;
+
+    uint32_t offset = *CheckpointArray_get(snapshot->checkpoints, index / SNAPSHOT_STEP);
+    if(!storage_file_seek(snapshot->file, offset, true)) return false;
+
+    // At most SNAPSHOT_STEP - 1 records are skipped
+    char name_temp[FILE_NAME_LEN_MAX];
+    bool is_folder;
+    for(uint32_t i = index - index % SNAPSHOT_STEP; i < index; i++) {
+        if(!browser_snapshot_read(snapshot, name_temp, &is_folder)) return false;
+    }
+
+    return true;
+}
+
 static bool browser_folder_init(
     BrowserWorker* browser,
     FuriString* path,
     FuriString* filename,
     uint32_t* item_cnt,
-    int32_t* file_idx) {
+    int32_t* file_idx,
+    bool long_load_notify) {
     bool state = false;
     FileInfo file_info;
     uint32_t total_files_cnt = 0;
@@ -187,6 +364,9 @@ static bool browser_folder_init(
     *item_cnt = 0;
     *file_idx = -1;
 
+    // Filtered items are written to the snapshot while counting, pages are read from it
+    bool snapshot_state = browser_snapshot_begin(&browser->snapshot, storage, path);
+
     if(storage_dir_open(directory, furi_string_get_cstr(path))) {
         state = true;
         while(1) {
@@ -197,14 +377,18 @@ static bool browser_folder_init(
                 total_files_cnt++;
                 furi_string_set(name_str, name_temp);
                 if(browser_filter_by_name(browser, name_str, file_info_is_dir(&file_info))) {
-                    if(!furi_string_empty(filename)) {
+                    if(filename && !furi_string_empty(filename)) {
                         if(furi_string_cmp(name_str, filename) == 0) {
                             *file_idx = *item_cnt;
                         }
                     }
+                    if(snapshot_state) {
+                        snapshot_state = browser_snapshot_add(
+                            &browser->snapshot, name_temp, file_info_is_dir(&file_info));
+                    }
                     (*item_cnt)++;
                 }
-                if(total_files_cnt == LONG_LOAD_THRESHOLD) {
+                if(total_files_cnt == LONG_LOAD_THRESHOLD && long_load_notify) {
                     // There are too many files in folder and counting them will take some time - send callback to app
                     if(browser->long_load_cb) {
                         browser->long_load_cb(browser->cb_ctx);
@@ -219,13 +403,64 @@ static bool browser_folder_init(
     storage_dir_close(directory);
     storage_file_free(directory);
 
+    browser_snapshot_end(&browser->snapshot, storage, snapshot_state && state);
+
     furi_record_close(RECORD_STORAGE);
 
     return state;
 }
 
-static bool
-    browser_folder_load(BrowserWorker* browser, FuriString* path, uint32_t offset, uint32_t count) {
+static bool browser_folder_load_snapshot(
+    BrowserWorker* browser,
+    FuriString* path,
+    uint32_t offset,
+    uint32_t count) {
+    BrowserSnapshot* snapshot = &browser->snapshot;
+
+    char name_temp[FILE_NAME_LEN_MAX];
+    bool is_folder;
+    FuriString* name_str;
+    name_str = furi_string_alloc();
+
+    uint32_t items_cnt = 0;
+
+    do {
+        if(offset > snapshot->count) {
+            break;
+        }
+        if(!browser_snapshot_seek(snapshot, offset)) {
+            break;
+        }
+
+        if(browser->list_load_cb) {
+            browser->list_load_cb(browser->cb_ctx, offset);
+        }
+
+        while((items_cnt < count) && (offset + items_cnt < snapshot->count)) {
+            if(!browser_snapshot_read(snapshot, name_temp, &is_folder)) {
+                break;
+            }
+            furi_string_printf(name_str, "%s/%s", furi_string_get_cstr(path), name_temp);
+            if(browser->list_item_cb) {
+                browser->list_item_cb(browser->cb_ctx, name_str, is_folder, false);
+            }
+            items_cnt++;
+        }
+        if(browser->list_item_cb) {
+            browser->list_item_cb(browser->cb_ctx, NULL, false, true);
+        }
+    } while(0);
+
+    furi_string_free(name_str);
+
+    return items_cnt == count;
+}
+
+static bool browser_folder_load_dir(
+    BrowserWorker* browser,
+    FuriString* path,
+    uint32_t offset,
+    uint32_t count) {
     FileInfo file_info;
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
@@ -298,6 +533,27 @@ static bool
     return items_cnt == count;
 }
 
+static bool
+    browser_folder_load(BrowserWorker* browser, FuriString* path, uint32_t offset, uint32_t count) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool is_valid = browser_snapshot_is_valid(&browser->snapshot, storage, path);
+    furi_record_close(RECORD_STORAGE);
+
+    if(!is_valid && storage_file_is_open(browser->snapshot.file)) {
+        // Folder was changed since it was opened, read it again the same way
+        uint32_t items_cnt;
+        int32_t file_idx;
+        browser_folder_init(browser, path, NULL, &items_cnt, &file_idx, false);
+        FURI_LOG_D(TAG, "Snapshot rebuilt: %lu items", items_cnt);
+    }
+
+    if(browser->snapshot.valid) {
+        return browser_folder_load_snapshot(browser, path, offset, count);
+    } else {
+        return browser_folder_load_dir(browser, path, offset, count);
+    }
+}
+
 static int32_t browser_worker(void* context) {
     BrowserWorker* browser = (BrowserWorker*)context;
     furi_check(browser);
@@ -311,6 +567,9 @@ static int32_t browser_worker(void* context) {
     FuriString* filename;
     filename = furi_string_alloc();
 
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    browser_snapshot_init(browser, storage);
+
     furi_thread_flags_set(furi_thread_get_id(browser->thread), WorkerEvtConfigChange);
 
     while(1) {
@@ -324,6 +583,7 @@ static int32_t browser_worker(void* context) {
                 path_extract_filename(browser->path_next, filename, false);
             }
             IdxLastArray_reset(browser->idx_last);
+            browser->snapshot.valid = false;
 
             furi_thread_flags_set(furi_thread_get_id(browser->thread), WorkerEvtFolderEnter);
         }
@@ -336,7 +596,7 @@ static int32_t browser_worker(void* context) {
             IdxLastArray_push_back(browser->idx_last, browser->item_sel_idx);
 
             int32_t file_idx = 0;
-            browser_folder_init(browser, path, filename, &items_cnt, &file_idx);
+            browser_folder_init(browser, path, filename, &items_cnt, &file_idx, true);
             furi_string_set(browser->path_current, path);
             FURI_LOG_D(
                 TAG,
@@ -355,7 +615,7 @@ static int32_t browser_worker(void* context) {
             bool is_root = browser_folder_check_and_switch(path);
 
             int32_t file_idx = 0;
-            browser_folder_init(browser, path, filename, &items_cnt, &file_idx);
+            browser_folder_init(browser, path, filename, &items_cnt, &file_idx, true);
             if(IdxLastArray_size(browser->idx_last) > 0) {
                 // Pop previous selected item index from history array
                 IdxLastArray_pop_back(&file_idx, browser->idx_last);
@@ -377,7 +637,7 @@ static int32_t browser_worker(void* context) {
 
             int32_t file_idx = 0;
             furi_string_reset(filename);
-            browser_folder_init(browser, path, filename, &items_cnt, &file_idx);
+            browser_folder_init(browser, path, filename, &items_cnt, &file_idx, true);
             FURI_LOG_D(
                 TAG,
                 "Refresh folder: %s items: %lu idx: %ld",
@@ -400,6 +660,9 @@ static int32_t browser_worker(void* context) {
         }
     }
 
+    browser_snapshot_deinit(browser, storage);
+    furi_record_close(RECORD_STORAGE);
+
     furi_string_free(filename);
     furi_string_free(path);
 
@@ -21,6 +21,25 @@ constexpr HashtableApiInterface elf_api_interface{
 };
 const ElfApiInterface* const firmware_api_interface = &elf_api_interface;
 
+extern "C" uint32_t firmware_api_get_fingerprint(void) {
+    static uint32_t fingerprint = 0;
+
+    if(!fingerprint) {
+        // FNV-1a
+        uint32_t hash = 0x811C9DC5;
+        for(const sym_entry& entry : elf_api_table) {
+            const uint32_t words[] = {entry.hash, entry.address};
+            const uint8_t* data = reinterpret_cast<const uint8_t*>(words);
+            for(size_t i = 0; i < sizeof(words); i++) {
+                hash = (hash ^ data[i]) * 0x01000193;
+            }
+        }
+        fingerprint = hash ? hash : 1;
+    }
+
+    return fingerprint;
+}
+
 extern "C" void furi_hal_info_get_api_version(uint16_t* major, uint16_t* minor) {
     *major = firmware_api_interface->api_version_major;
     *minor = firmware_api_interface->api_version_minor;
@@ -2,4 +2,20 @@
 
 #include <flipper_application/elf/elf_api_interface.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 extern const ElfApiInterface* const firmware_api_interface;
+
+/**
+ * @brief Get firmware API fingerprint
+ * Hash over all exported symbols and their addresses, changes with every
+ * firmware build that moves any of them.
+ * @return fingerprint value
+ */
+uint32_t firmware_api_get_fingerprint(void);
+
+#ifdef __cplusplus
+}
+#endif
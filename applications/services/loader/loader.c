@@ -8,6 +8,7 @@
 #include <dialogs/dialogs.h>
 #include <toolbox/path.h>
 #include <flipper_application/flipper_application.h>
+#include <flipper_application/elf/elf_link_cache.h>
 #include <loader/firmware_api/firmware_api.h>
 
 #define TAG "Loader"
@@ -731,6 +732,9 @@ int32_t loader_srv(void* p) {
     Loader* loader = loader_alloc();
     furi_record_create(RECORD_LOADER, loader);
 
+    // Firmware imports don't move within a build, FAPs can reuse resolved relocations
+    elf_link_cache_set_api(firmware_api_interface, firmware_api_get_fingerprint());
+
     FURI_LOG_I(TAG, "Executing system start hooks");
     for(size_t i = 0; i < FLIPPER_ON_SYSTEM_START_COUNT; i++) {
         FLIPPER_ON_SYSTEM_START[i]();
@@ -5,7 +5,6 @@
 #include <rpc/rpc_i.h>
 #include <storage/filesystem_api_defines.h>
 #include <storage/storage.h>
-#include <lib/toolbox/md5_calc.h>
 #include <lib/toolbox/path.h>
 #include <update_util/int_backup.h>
 #include <toolbox/tar/tar_archive.h>
@@ -20,19 +19,121 @@
 
 static const size_t MAX_DATA_SIZE = 512;
 
+#define RPC_STORAGE_WORKER_STACK_SIZE (1024u)
+
 typedef enum {
     RpcStorageStateIdle = 0,
     RpcStorageStateWriting,
 } RpcStorageState;
 
+/** Worker thread doing file IO while RPC thread encodes and sends or decodes the
+ * next chunk. Chunks are passed as pb_bytes_array_t*, NULL ends the transfer.
+ * One chunk waits in the queue while another one is processed on each side.
+ */
+typedef struct {
+    File* file;
+    size_t size;
+    size_t chunk_size;
+    FuriMessageQueue* queue;
+    FuriThread* thread;
+    bool error;
+} RpcStoragePipe;
+
 typedef struct {
     RpcSession* session;
     Storage* api;
     File* file;
+    RpcStoragePipe* write_pipe;
     RpcStorageState state;
     uint32_t current_command_id;
 } RpcStorageSystem;
 
+static RpcStoragePipe* rpc_system_storage_pipe_alloc(
+    File* file,
+    const char* name,
+    FuriThreadCallback worker,
+    size_t size,
+    size_t chunk_size) {
+    RpcStoragePipe* pipe = malloc(sizeof(RpcStoragePipe));
+    pipe->file = file;
+    pipe->size = size;
+    pipe->chunk_size = chunk_size;
+    pipe->queue = furi_message_queue_alloc(1, sizeof(pb_bytes_array_t*));
+    pipe->thread = furi_thread_alloc_ex(name, RPC_STORAGE_WORKER_STACK_SIZE, worker, pipe);
+    furi_thread_start(pipe->thread);
+    return pipe;
+}
+
+/** Wait for the worker to finish and free the pipe
+ *
+ * @return     true if the worker did not fail
+ */
+static bool rpc_system_storage_pipe_free(RpcStoragePipe* pipe) {
+    furi_thread_join(pipe->thread);
+    const bool success = !pipe->error;
+    furi_thread_free(pipe->thread);
+    furi_message_queue_free(pipe->queue);
+    free(pipe);
+    return success;
+}
+
+static void rpc_system_storage_pipe_put(RpcStoragePipe* pipe, pb_bytes_array_t* chunk) {
+    furi_check(furi_message_queue_put(pipe->queue, &chunk, FuriWaitForever) == FuriStatusOk);
+}
+
+static pb_bytes_array_t* rpc_system_storage_pipe_get(RpcStoragePipe* pipe) {
+    pb_bytes_array_t* chunk;
+    furi_check(furi_message_queue_get(pipe->queue, &chunk, FuriWaitForever) == FuriStatusOk);
+    return chunk;
+}
+
+static int32_t rpc_system_storage_read_worker(void* context) {
+    RpcStoragePipe* pipe = context;
+    size_t size_left = pipe->size;
+
+    while(size_left) {
+        const size_t read_size = MIN(size_left, pipe->chunk_size);
+        pb_bytes_array_t* chunk = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(read_size));
+        chunk->size = storage_file_read(pipe->file, chunk->bytes, read_size);
+        if(chunk->size != read_size) {
+            pipe->error = true;
+            free(chunk);
+            break;
+        }
+        size_left -= read_size;
+        rpc_system_storage_pipe_put(pipe, chunk);
+    }
+
+    rpc_system_storage_pipe_put(pipe, NULL);
+    return 0;
+}
+
+// Chunks after a failed write are dropped, error is reported on the next request
+static int32_t rpc_system_storage_write_worker(void* context) {
+    RpcStoragePipe* pipe = context;
+    pb_bytes_array_t* chunk;
+
+    while((chunk = rpc_system_storage_pipe_get(pipe))) {
+        if(!pipe->error) {
+            pipe->error = storage_file_write(pipe->file, chunk->bytes, chunk->size) != chunk->size;
+        }
+        free(chunk);
+    }
+
+    return 0;
+}
+
+/** Wait for queued chunks to be written and stop the writer
+ *
+ * @return     true if all chunks were written
+ */
+static bool rpc_system_storage_write_pipe_stop(RpcStorageSystem* rpc_storage) {
+    rpc_system_storage_pipe_put(rpc_storage->write_pipe, NULL);
+    const bool success = rpc_system_storage_pipe_free(rpc_storage->write_pipe);
+    rpc_storage->write_pipe = NULL;
+    return success;
+}
+
 static void rpc_system_storage_reset_state(
     RpcStorageSystem* rpc_storage,
     RpcSession* session,
@@ -49,6 +150,7 @@ static void rpc_system_storage_reset_state(
         }
 
         if(rpc_storage->state == RpcStorageStateWriting) {
+            if(rpc_storage->write_pipe) rpc_system_storage_write_pipe_stop(rpc_storage);
             storage_file_close(rpc_storage->file);
             storage_file_free(rpc_storage->file);
         }
@@ -102,6 +204,21 @@ static PB_CommandStatus rpc_system_storage_get_file_error(File* file) {
     return rpc_system_storage_get_error(storage_file_get_error(file));
 }
 
+static FS_Error
+    rpc_system_storage_md5(Storage* api, const char* path, char* md5sum, size_t md5sum_size) {
+    uint8_t md5[16];
+    furi_check(md5sum_size > sizeof(md5) * 2);
+
+    FS_Error error = storage_common_md5(api, path, md5);
+    if(error == FSE_OK) {
+        for(size_t i = 0; i < sizeof(md5); i++) {
+            snprintf(&md5sum[i * 2], 3, "%02x", md5[i]);
+        }
+    }
+
+    return error;
+}
+
 static void rpc_system_storage_info_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -280,9 +397,7 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
     PB_Storage_ListResponse* list = &response.content.storage_list_response;
 
     bool include_md5 = list_request->include_md5;
-    FuriString* md5 = furi_string_alloc();
     FuriString* md5_path = furi_string_alloc();
-    File* file = storage_file_alloc(rpc_storage->api);
 
     bool finish = false;
     int i = 0;
@@ -313,11 +428,11 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
                 if(include_md5 && !file_info_is_dir(&fileinfo)) {
                     furi_string_printf(md5_path, "%s/%s", list_request->path, name); //-V576
 
-                    if(md5_string_calc_file(file, furi_string_get_cstr(md5_path), md5, NULL)) {
-                        char* md5sum = list->file[i].md5sum;
-                        size_t md5sum_size = sizeof(list->file[i].md5sum);
-                        snprintf(md5sum, md5sum_size, "%s", furi_string_get_cstr(md5));
-                    }
+                    rpc_system_storage_md5(
+                        rpc_storage->api,
+                        furi_string_get_cstr(md5_path),
+                        list->file[i].md5sum,
+                        sizeof(list->file[i].md5sum));
                 }
 
                 ++i;
@@ -334,11 +449,38 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
     response.has_next = false;
     rpc_send_and_release(session, &response);
 
-    furi_string_free(md5);
     furi_string_free(md5_path);
     storage_dir_close(dir);
     storage_file_free(dir);
-    storage_file_free(file);
+}
+
+// Next chunk is read from storage while the previous one is encoded and sent
+static bool rpc_system_storage_read_pipelined(
+    RpcSession* session,
+    uint32_t command_id,
+    File* file,
+    size_t size,
+    size_t chunk_size) {
+    RpcStoragePipe* pipe = rpc_system_storage_pipe_alloc(
+        file, "RpcStorageRead", rpc_system_storage_read_worker, size, chunk_size);
+
+    PB_Main response = {
+        .command_id = command_id,
+        .command_status = PB_CommandStatus_OK,
+        .which_content = PB_Main_storage_read_response_tag,
+        .content.storage_read_response.has_file = true,
+    };
+
+    pb_bytes_array_t* chunk;
+    while((chunk = rpc_system_storage_pipe_get(pipe))) {
+        size -= chunk->size;
+        response.has_next = (size > 0);
+        response.content.storage_read_response.file.data = chunk;
+        rpc_send(session, &response);
+        free(chunk);
+    }
+
+    return rpc_system_storage_pipe_free(pipe);
 }
 
 static void rpc_system_storage_read_process(const PB_Main* request, void* context) {
@@ -362,24 +504,23 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
 
     if(fs_operation_success) {
         size_t size_left = storage_file_size(file);
-        do {
+        if(size_left > MAX_DATA_SIZE) {
+            fs_operation_success = rpc_system_storage_read_pipelined(
+                session, request->command_id, file, size_left, MAX_DATA_SIZE);
+        } else {
+            // Whole file fits into one response
             response->command_id = request->command_id;
             response->which_content = PB_Main_storage_read_response_tag;
             response->command_status = PB_CommandStatus_OK;
+            response->has_next = false;
+            response->content.storage_read_response.has_file = true;
 
-            size_t read_size = MIN(size_left, MAX_DATA_SIZE);
-            if(read_size) {
-                response->content.storage_read_response.has_file = true;
+            if(size_left) {
                 response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(read_size));
-                uint8_t* buffer = &response->content.storage_read_response.file.data->bytes[0];
-                uint16_t* read_size_msg = &response->content.storage_read_response.file.data->size;
-
-                *read_size_msg = storage_file_read(file, buffer, read_size);
-                size_left -= *read_size_msg;
-                fs_operation_success = (*read_size_msg == read_size);
-
-                response->has_next = fs_operation_success && (size_left > 0);
+                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(size_left));
+                pb_bytes_array_t* data = response->content.storage_read_response.file.data;
+                data->size = storage_file_read(file, data->bytes, size_left);
+                fs_operation_success = (data->size == size_left);
             } else {
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Warray-bounds"
@@ -387,15 +528,13 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
                     malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(0));
                 response->content.storage_read_response.file.data->size = 0;
 #pragma GCC diagnostic pop
-                response->content.storage_read_response.has_file = true;
-                response->has_next = false;
-                fs_operation_success = true;
             }
 
             if(fs_operation_success) {
-                rpc_send_and_release(session, response);
+                rpc_send(session, response);
             }
-        } while((size_left != 0) && fs_operation_success);
+            pb_release(&PB_Main_msg, response);
+        }
     }
 
     if(!fs_operation_success) {
@@ -441,19 +580,41 @@ static void rpc_system_storage_write_process(const PB_Main* request, void* conte
         const char* path = request->content.storage_write_request.path;
         fs_operation_success =
             storage_file_open(rpc_storage->file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS);
+        // Next chunk is received while the previous one is written
+        if(fs_operation_success && request->has_next) {
+            rpc_storage->write_pipe = rpc_system_storage_pipe_alloc(
+                rpc_storage->file, "RpcStorageWrite", rpc_system_storage_write_worker, 0, 0);
+        }
     }
 
     File* file = rpc_storage->file;
+    RpcStoragePipe* pipe = rpc_storage->write_pipe;
     bool send_response = false;
 
+    if(fs_operation_success && pipe) {
+        // Error of previous chunk is set by the writer, stale read is caught later
+        fs_operation_success = !pipe->error;
+    }
+
     if(fs_operation_success) {
         if(request->content.storage_write_request.has_file &&
            request->content.storage_write_request.file.data &&
            request->content.storage_write_request.file.data->size) {
             uint8_t* buffer = request->content.storage_write_request.file.data->bytes;
             size_t buffer_size = request->content.storage_write_request.file.data->size;
-            size_t written_size = storage_file_write(file, buffer, buffer_size);
-            fs_operation_success = (written_size == buffer_size);
+            if(pipe) {
+                pb_bytes_array_t* chunk = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(buffer_size));
+                chunk->size = buffer_size;
+                memcpy(chunk->bytes, buffer, buffer_size);
+                rpc_system_storage_pipe_put(pipe, chunk);
+            } else {
+                size_t written_size = storage_file_write(file, buffer, buffer_size);
+                fs_operation_success = (written_size == buffer_size);
+            }
+        }
+
+        if(pipe && !request->has_next) {
+            fs_operation_success = rpc_system_storage_write_pipe_stop(rpc_storage);
         }
 
         send_response = !request->has_next;
@@ -588,30 +749,23 @@ static void rpc_system_storage_md5sum_process(const PB_Main* request, void* cont
         return;
     }
 
-    File* file = storage_file_alloc(rpc_storage->api);
-    FuriString* md5 = furi_string_alloc();
-    FS_Error file_error;
-
-    if(md5_string_calc_file(file, filename, md5, &file_error)) {
-        PB_Main response = {
-            .command_id = request->command_id,
-            .command_status = PB_CommandStatus_OK,
-            .which_content = PB_Main_storage_md5sum_response_tag,
-            .has_next = false,
-        };
+    PB_Main response = {
+        .command_id = request->command_id,
+        .command_status = PB_CommandStatus_OK,
+        .which_content = PB_Main_storage_md5sum_response_tag,
+        .has_next = false,
+    };
 
-        char* md5sum = response.content.storage_md5sum_response.md5sum;
-        size_t md5sum_size = sizeof(response.content.storage_md5sum_response.md5sum);
-        snprintf(md5sum, md5sum_size, "%s", furi_string_get_cstr(md5));
+    char* md5sum = response.content.storage_md5sum_response.md5sum;
+    size_t md5sum_size = sizeof(response.content.storage_md5sum_response.md5sum);
+    FS_Error file_error = rpc_system_storage_md5(rpc_storage->api, filename, md5sum, md5sum_size);
 
+    if(file_error == FSE_OK) {
         rpc_send_and_release(session, &response);
     } else {
         rpc_send_and_release_empty(
             session, request->command_id, rpc_system_storage_get_error(file_error));
     }
-
-    furi_string_free(md5);
-    storage_file_free(file);
 }
 
 static void rpc_system_storage_rename_process(const PB_Main* request, void* context) {
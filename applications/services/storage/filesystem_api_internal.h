@@ -146,6 +146,12 @@ typedef struct {
  *      @param name_length name buffer length
  *      @return FS_Error error info
  * 
+ *  @var FS_Common_Api::mtime
+ *      @brief Get file/directory modification time
+ *      @param path path to file/directory
+ *      @param mtime pointer to modification time value, in filesystem format
+ *      @return FS_Error error info
+ * 
  *  @var FS_Common_Api::remove
  *      @brief Remove file/directory from storage, 
  *          directory must be empty,
@@ -175,6 +181,7 @@ typedef struct {
  */
 typedef struct {
     FS_Error (*const stat)(void* context, const char* path, FileInfo* fileinfo);
+    FS_Error (*const mtime)(void* context, const char* path, uint32_t* mtime);
     FS_Error (*const remove)(void* context, const char* path);
     FS_Error (*const mkdir)(void* context, const char* path);
     FS_Error (*const fs_info)(
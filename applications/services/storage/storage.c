@@ -42,6 +42,7 @@ Storage* storage_app_alloc(void) {
     }
 
     storage_ext_init(&app->storage[ST_EXT]);
+    app->md5_cache = storage_md5_cache_alloc();
 
     // sd icon gui
     app->sd_gui.enabled = false;
@@ -71,6 +72,7 @@ void storage_tick(Storage* app) {
         view_port_enabled_set(app->sd_gui.view_port, false);
 
         FURI_LOG_I(TAG, "SD card unmount");
+        storage_md5_cache_reset(app->md5_cache);
         StorageEvent event = {.type = StorageEventTypeCardUnmount};
         furi_pubsub_publish(app->pubsub, &event);
     }
@@ -87,6 +89,7 @@ void storage_tick(Storage* app) {
 
         if(app->storage[ST_EXT].status == StorageStatusOK) {
             FURI_LOG_I(TAG, "SD card mount");
+            storage_md5_cache_reset(app->md5_cache);
             StorageEvent event = {.type = StorageEventTypeCardMount};
             furi_pubsub_publish(app->pubsub, &event);
         } else {
@@ -95,6 +98,11 @@ void storage_tick(Storage* app) {
             furi_pubsub_publish(app->pubsub, &event);
         }
     }
+
+    // Digests are written out once the storage gets idle
+    if(app->storage[ST_EXT].status == StorageStatusOK) {
+        storage_md5_cache_save(app->md5_cache, &app->storage[ST_EXT]);
+    }
 }
 
 int32_t storage_srv(void* p) {
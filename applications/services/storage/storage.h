@@ -135,6 +135,40 @@ size_t storage_file_read(File* file, void* buff, size_t bytes_to_read);
  */
 size_t storage_file_write(File* file, const void* buff, size_t bytes_to_write);
 
+/**
+ * @brief Buffer of a vectored read or write.
+ */
+typedef struct {
+    void* buff; /**< Pointer to the buffer, not modified by writes. */
+    size_t size; /**< Size of the buffer, in bytes. */
+} StorageIoVec;
+
+/**
+ * @brief Read bytes from a file into several buffers at once.
+ *
+ * Buffers are filled in order by a single storage request, reading stops at the
+ * first short read.
+ *
+ * @param file pointer to the file instance to read from.
+ * @param vector pointer to the array of buffers to be filled with read data.
+ * @param vector_count number of buffers in the array.
+ * @return actual number of bytes read into all buffers (may be fewer than requested).
+ */
+size_t storage_file_read_vector(File* file, const StorageIoVec* vector, size_t vector_count);
+
+/**
+ * @brief Write bytes from several buffers to a file at once.
+ *
+ * Buffers are written in order by a single storage request, writing stops at the
+ * first short write.
+ *
+ * @param file pointer to the file instance to write into.
+ * @param vector pointer to the array of buffers containing the data to be written.
+ * @param vector_count number of buffers in the array.
+ * @return actual number of bytes written from all buffers (may be fewer than requested).
+ */
+size_t storage_file_write_vector(File* file, const StorageIoVec* vector, size_t vector_count);
+
 /**
  * @brief Change the current access position in a file.
  *
@@ -246,6 +280,42 @@ bool storage_dir_close(File* file);
  */
 bool storage_dir_read(File* file, FileInfo* fileinfo, char* name, uint16_t name_length);
 
+/** Name buffer space storage_dir_read_batch() needs for every item after the first one */
+#define STORAGE_DIR_BATCH_NAME_SIZE (256)
+
+/**
+ * @brief Directory item read by storage_dir_read_batch().
+ */
+typedef struct {
+    FileInfo fileinfo; /**< Information about the item. */
+    const char* name; /**< Zero-terminated name in the name buffer (NULL if there is none). */
+} StorageDirEntry;
+
+/**
+ * @brief Get several next items in the directory at once.
+ *
+ * Items are read by a single storage request. Reading stops when the item
+ * array is full, at the end of the directory or when less than
+ * STORAGE_DIR_BATCH_NAME_SIZE bytes are left in the name buffer. The first
+ * item is always read, its name is truncated to fit the name buffer.
+ *
+ * If no items were read, the file error id is set to FSE_NOT_EXIST at the end
+ * of the directory or to the error that stopped reading.
+ *
+ * @param file pointer to a file instance representing the directory in question.
+ * @param entries pointer to the array of items to be filled.
+ * @param entries_count maximum number of items to read.
+ * @param names pointer to the buffer to contain the names (may be NULL).
+ * @param names_size capacity of the name buffer, in bytes.
+ * @return number of items read, 0 at the end of the directory or on error.
+ */
+size_t storage_dir_read_batch(
+    File* file,
+    StorageDirEntry* entries,
+    size_t entries_count,
+    char* names,
+    size_t names_size);
+
 /**
  * @brief Change the access position to first item in the directory.
  *
@@ -275,6 +345,19 @@ bool storage_dir_exists(Storage* storage, const char* path);
  */
 FS_Error storage_common_timestamp(Storage* storage, const char* path, uint32_t* timestamp);
 
+/**
+ * @brief Get the number of changes made to the storage the item is on.
+ *
+ * The counter is incremented by every operation that updates the storage timestamp,
+ * unlike the timestamp it tells apart changes made within the same second.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param path pointer to a zero-terminated string containing the path of the item in question.
+ * @param count pointer to a value to contain the change counter.
+ * @return FSE_OK if the counter has been successfully received, any other error code on failure.
+ */
+FS_Error storage_common_change_count(Storage* storage, const char* path, uint32_t* count);
+
 /**
  * @brief Get information about a file or a directory.
  *
@@ -285,6 +368,26 @@ FS_Error storage_common_timestamp(Storage* storage, const char* path, uint32_t*
  */
 FS_Error storage_common_stat(Storage* storage, const char* path, FileInfo* fileinfo);
 
+/**
+ * @brief Get information about several files or directories at once.
+ *
+ * All paths are checked by a single storage request, so the storage service is
+ * busy until the whole batch is done.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param paths pointer to the array of zero-terminated paths of the items in question.
+ * @param fileinfos pointer to the array of FileInfo structures to contain the info (may be NULL).
+ * @param errors pointer to the array to contain the error code of every item.
+ * @param count number of items.
+ * @return number of items with FSE_OK result.
+ */
+size_t storage_common_stat_batch(
+    Storage* storage,
+    const char* const* paths,
+    FileInfo* fileinfos,
+    FS_Error* errors,
+    size_t count);
+
 /**
  * @brief Remove a file or a directory.
  *
@@ -422,6 +525,19 @@ bool storage_common_equivalent_path(Storage* storage, const char* path1, const c
  */
 bool storage_common_is_subdir(Storage* storage, const char* parent, const char* child);
 
+/**
+ * @brief Get the MD5 digest of a file.
+ *
+ * Digests are cached by the storage service and are calculated again only
+ * if the file has been changed since.
+ *
+ * @param storage pointer to a storage API instance.
+ * @param path pointer to a zero-terminated string containing the path of the file.
+ * @param md5 pointer to a 16 byte buffer to contain the digest.
+ * @return FSE_OK if the digest has been successfully received, any other error code on failure.
+ */
+FS_Error storage_common_md5(Storage* storage, const char* path, uint8_t* md5);
+
 /******************* Error Functions *******************/
 
 /**
@@ -4,15 +4,22 @@
 #include <cli/cli.h>
 #include <lib/toolbox/args.h>
 #include <lib/toolbox/dir_walk.h>
-#include <lib/toolbox/md5_calc.h>
 #include <lib/toolbox/strint.h>
 #include <lib/toolbox/tar/tar_archive.h>
 #include <storage/storage.h>
 #include <storage/storage_sd_api.h>
 #include <power/power_service/power.h>
+#include <fatfs.h>
 
 #define MAX_NAME_LENGTH 255
 
+#define STORAGE_CLI_BENCH_BATCH            16
+#define STORAGE_CLI_BENCH_BATCH_NAMES_SIZE (4 * STORAGE_DIR_BATCH_NAME_SIZE)
+#define STORAGE_CLI_BENCH_STAT_MAX         32
+#define STORAGE_CLI_BENCH_ROUNDS           8
+#define STORAGE_CLI_BENCH_CHUNK            64
+#define STORAGE_CLI_BENCH_CHUNKS           16
+
 static void storage_cli_print_usage(void);
 
 static void storage_cli_print_error(FS_Error error) {
@@ -61,6 +68,17 @@ static void storage_cli_info(Cli* cli, FuriString* path, FuriString* args) {
                 sd_info.product_serial_number,
                 sd_info.manufacturing_month,
                 sd_info.manufacturing_year);
+
+            SectorCacheStats cache_stats;
+            user_diskio_get_cache_stats(&cache_stats);
+            printf(
+                "Sector cache: %lu hits, %lu misses, %lu read ahead\r\n"
+                "%lu evictions, %lu pinned\r\n",
+                cache_stats.hits,
+                cache_stats.misses,
+                cache_stats.read_ahead,
+                cache_stats.evictions,
+                cache_stats.pinned);
         }
     } else {
         storage_cli_print_usage();
@@ -468,20 +486,18 @@ static void storage_cli_md5(Cli* cli, FuriString* path, FuriString* args) {
     UNUSED(cli);
     UNUSED(args);
     Storage* api = furi_record_open(RECORD_STORAGE);
-    File* file = storage_file_alloc(api);
-    FuriString* md5 = furi_string_alloc();
-    FS_Error file_error;
+    uint8_t md5[16];
 
-    if(md5_string_calc_file(file, furi_string_get_cstr(path), md5, &file_error)) {
-        printf("%s\r\n", furi_string_get_cstr(md5));
+    FS_Error error = storage_common_md5(api, furi_string_get_cstr(path), md5);
+    if(error == FSE_OK) {
+        for(size_t i = 0; i < sizeof(md5); i++) {
+            printf("%02x", md5[i]);
+        }
+        printf("\r\n");
     } else {
-        storage_cli_print_error(file_error);
+        storage_cli_print_error(error);
     }
 
-    furi_string_free(md5);
-    storage_file_close(file);
-    storage_file_free(file);
-
     furi_record_close(RECORD_STORAGE);
 }
 
@@ -526,6 +542,143 @@ static void storage_cli_extract(Cli* cli, FuriString* old_path, FuriString* args
     furi_record_close(RECORD_STORAGE);
 }
 
+static void storage_cli_bench_print(const char* name, bool batched, uint32_t ops, uint32_t ticks) {
+    printf(
+        "%-10s %-8s %6lu ops, %8lu ops/s\r\n",
+        name,
+        batched ? "batched" : "single",
+        ops,
+        ops * 1000UL / MAX(ticks, 1UL));
+}
+
+// Without the batched reads, fills the stat list with the first items and finds a file to read
+static uint32_t storage_cli_bench_dir(
+    File* dir,
+    FuriString* path,
+    bool batched,
+    FuriString** items,
+    size_t* item_count,
+    FuriString* file_path) {
+    StorageDirEntry* entries = malloc(sizeof(StorageDirEntry) * STORAGE_CLI_BENCH_BATCH);
+    char* names = malloc(STORAGE_CLI_BENCH_BATCH_NAMES_SIZE);
+    uint32_t ops = 0;
+
+    if(storage_dir_open(dir, furi_string_get_cstr(path))) {
+        size_t count;
+        do {
+            if(batched) {
+                count = storage_dir_read_batch(
+                    dir,
+                    entries,
+                    STORAGE_CLI_BENCH_BATCH,
+                    names,
+                    STORAGE_CLI_BENCH_BATCH_NAMES_SIZE);
+            } else {
+                count = storage_dir_read(
+                    dir, &entries[0].fileinfo, names, STORAGE_DIR_BATCH_NAME_SIZE);
+                entries[0].name = names;
+            }
+
+            for(size_t i = 0; i < count && !batched; i++) {
+                const char* name = entries[i].name;
+                if(*item_count < STORAGE_CLI_BENCH_STAT_MAX) {
+                    furi_string_printf(
+                        items[(*item_count)++], "%s/%s", furi_string_get_cstr(path), name);
+                }
+                if(furi_string_empty(file_path) && !file_info_is_dir(&entries[i].fileinfo)) {
+                    furi_string_printf(file_path, "%s/%s", furi_string_get_cstr(path), name);
+                }
+            }
+            ops += count;
+        } while(count);
+    }
+    storage_dir_close(dir);
+
+    free(names);
+    free(entries);
+    return ops;
+}
+
+static void storage_cli_bench(Cli* cli, FuriString* path, FuriString* args) {
+    UNUSED(cli);
+    UNUSED(args);
+    Storage* api = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(api);
+    FuriString* file_path = furi_string_alloc();
+
+    FuriString* items[STORAGE_CLI_BENCH_STAT_MAX];
+    const char* item_paths[STORAGE_CLI_BENCH_STAT_MAX];
+    FS_Error errors[STORAGE_CLI_BENCH_STAT_MAX];
+    FileInfo fileinfo;
+    size_t item_count = 0;
+    for(size_t i = 0; i < STORAGE_CLI_BENCH_STAT_MAX; i++) {
+        items[i] = furi_string_alloc();
+    }
+
+    for(size_t batched = 0; batched < 2; batched++) {
+        uint32_t start = furi_get_tick();
+        uint32_t ops = storage_cli_bench_dir(file, path, batched, items, &item_count, file_path);
+        storage_cli_bench_print("dir read", batched, ops, furi_get_tick() - start);
+    }
+
+    for(size_t i = 0; i < item_count; i++) {
+        item_paths[i] = furi_string_get_cstr(items[i]);
+    }
+    for(size_t batched = 0; batched < 2 && item_count; batched++) {
+        uint32_t start = furi_get_tick();
+        for(size_t round = 0; round < STORAGE_CLI_BENCH_ROUNDS; round++) {
+            if(batched) {
+                storage_common_stat_batch(api, item_paths, NULL, errors, item_count);
+            } else {
+                for(size_t i = 0; i < item_count; i++) {
+                    storage_common_stat(api, item_paths[i], &fileinfo);
+                }
+            }
+        }
+        uint32_t ops = item_count * STORAGE_CLI_BENCH_ROUNDS;
+        storage_cli_bench_print("stat", batched, ops, furi_get_tick() - start);
+    }
+
+    if(!furi_string_empty(file_path) &&
+       storage_file_open(file, furi_string_get_cstr(file_path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+        uint8_t* data = malloc(STORAGE_CLI_BENCH_CHUNK * STORAGE_CLI_BENCH_CHUNKS);
+        StorageIoVec vector[STORAGE_CLI_BENCH_CHUNKS];
+        for(size_t i = 0; i < STORAGE_CLI_BENCH_CHUNKS; i++) {
+            vector[i].buff = &data[i * STORAGE_CLI_BENCH_CHUNK];
+            vector[i].size = STORAGE_CLI_BENCH_CHUNK;
+        }
+
+        for(size_t batched = 0; batched < 2; batched++) {
+            uint32_t ops = 0;
+            uint32_t start = furi_get_tick();
+            for(size_t round = 0; round < STORAGE_CLI_BENCH_ROUNDS; round++) {
+                storage_file_seek(file, 0, true);
+                if(batched) {
+                    size_t read = storage_file_read_vector(file, vector, COUNT_OF(vector));
+                    ops += read / STORAGE_CLI_BENCH_CHUNK;
+                } else {
+                    for(size_t i = 0; i < COUNT_OF(vector); i++) {
+                        size_t read =
+                            storage_file_read(file, vector[i].buff, STORAGE_CLI_BENCH_CHUNK);
+                        ops += read / STORAGE_CLI_BENCH_CHUNK;
+                    }
+                }
+            }
+            storage_cli_bench_print("file read", batched, ops, furi_get_tick() - start);
+        }
+
+        free(data);
+    }
+    storage_file_close(file);
+
+    for(size_t i = 0; i < STORAGE_CLI_BENCH_STAT_MAX; i++) {
+        furi_string_free(items[i]);
+    }
+    furi_string_free(file_path);
+    storage_file_free(file);
+    furi_record_close(RECORD_STORAGE);
+}
+
 typedef void (*StorageCliCommandCallback)(Cli* cli, FuriString* path, FuriString* args);
 
 typedef struct {
@@ -605,6 +758,11 @@ static const StorageCliCommand storage_cli_commands[] = {
         "last modification timestamp",
         &storage_cli_timestamp,
     },
+    {
+        "bench",
+        "time single and batched storage requests, <path> must be a dir",
+        &storage_cli_bench,
+    },
     {
         "extract",
         "extract tar archive to destination",
@@ -5,12 +5,15 @@
 #include "storage_message.h"
 #include <toolbox/stream/file_stream.h>
 #include <toolbox/dir_walk.h>
+#include <toolbox/md5_calc.h>
 #include "toolbox/path.h"
 
-#define MAX_NAME_LENGTH  256
 #define MAX_EXT_LEN      16
 #define FILE_BUFFER_SIZE 512
 
+#define DIR_BATCH_SIZE       16
+#define DIR_BATCH_NAMES_SIZE (4 * STORAGE_DIR_BATCH_NAME_SIZE)
+
 #define TAG "StorageApi"
 
 #define S_API_PROLOGUE FuriApiLock lock = api_lock_alloc_locked();
@@ -42,8 +45,8 @@
         }};
 
 #define S_RETURN_BOOL    (return_data.bool_value);
-#define S_RETURN_UINT16  (return_data.uint16_value);
 #define S_RETURN_UINT64  (return_data.uint64_value);
+#define S_RETURN_SIZE    (return_data.size_value);
 #define S_RETURN_ERROR   (return_data.error_value);
 #define S_RETURN_CSTRING (return_data.cstring_value);
 
@@ -142,81 +145,55 @@ bool storage_file_close(File* file) {
     return S_RETURN_BOOL;
 }
 
-static uint16_t storage_file_read_underlying(File* file, void* buff, uint16_t bytes_to_read) {
-    if(bytes_to_read == 0) {
-        return 0;
-    }
-
+static size_t storage_file_vector(
+    File* file,
+    const StorageIoVec* vector,
+    size_t vector_count,
+    StorageCommand command) {
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
 
     SAData data = {
-        .fread = {
+        .fvector = {
             .file = file,
-            .buff = buff,
-            .bytes_to_read = bytes_to_read,
+            .vector = vector,
+            .vector_count = vector_count,
         }};
 
-    S_API_MESSAGE(StorageCommandFileRead);
+    S_API_MESSAGE(command);
     S_API_EPILOGUE;
-    return S_RETURN_UINT16;
+    return S_RETURN_SIZE;
 }
 
-static uint16_t
-    storage_file_write_underlying(File* file, const void* buff, uint16_t bytes_to_write) {
-    if(bytes_to_write == 0) {
-        return 0;
-    }
-
-    S_FILE_API_PROLOGUE;
-    S_API_PROLOGUE;
-
-    SAData data = {
-        .fwrite = {
-            .file = file,
-            .buff = buff,
-            .bytes_to_write = bytes_to_write,
-        }};
+size_t storage_file_read_vector(File* file, const StorageIoVec* vector, size_t vector_count) {
+    furi_check(vector || !vector_count);
+    return storage_file_vector(file, vector, vector_count, StorageCommandFileReadVector);
+}
 
-    S_API_MESSAGE(StorageCommandFileWrite);
-    S_API_EPILOGUE;
-    return S_RETURN_UINT16;
+size_t storage_file_write_vector(File* file, const StorageIoVec* vector, size_t vector_count) {
+    furi_check(vector || !vector_count);
+    return storage_file_vector(file, vector, vector_count, StorageCommandFileWriteVector);
 }
 
 size_t storage_file_read(File* file, void* buff, size_t to_read) {
-    size_t total = 0;
-
-    const size_t max_chunk = UINT16_MAX;
-    do {
-        const size_t chunk = MIN((to_read - total), max_chunk);
-        size_t read = storage_file_read_underlying(file, buff + total, chunk);
-        total += read;
-
-        if(storage_file_get_error(file) != FSE_OK || read != chunk) {
-            break;
-        }
-    } while(total != to_read);
+    if(to_read == 0) {
+        return 0;
+    }
 
-    return total;
+    StorageIoVec vector = {.buff = buff, .size = to_read};
+    return storage_file_read_vector(file, &vector, 1);
 }
 
 size_t storage_file_write(File* file, const void* buff, size_t to_write) {
     furi_check(file);
 
-    size_t total = 0;
-
-    const size_t max_chunk = UINT16_MAX;
-    do {
-        const size_t chunk = MIN((to_write - total), max_chunk);
-        size_t written = storage_file_write_underlying(file, buff + total, chunk);
-        total += written;
-
-        if(storage_file_get_error(file) != FSE_OK || written != chunk) {
-            break;
-        }
-    } while(total != to_write);
+    if(to_write == 0) {
+        return 0;
+    }
 
-    return total;
+    // Buffer is only read by writes
+    StorageIoVec vector = {.buff = (void*)buff, .size = to_write};
+    return storage_file_write_vector(file, &vector, 1);
 }
 
 bool storage_file_seek(File* file, uint32_t offset, bool from_start) {
@@ -388,20 +365,38 @@ bool storage_dir_close(File* file) {
 }
 
 bool storage_dir_read(File* file, FileInfo* fileinfo, char* name, uint16_t name_length) {
+    StorageDirEntry entry;
+    size_t count = storage_dir_read_batch(file, &entry, 1, name, name_length);
+
+    if(count && fileinfo) {
+        *fileinfo = entry.fileinfo;
+    }
+
+    return count;
+}
+
+size_t storage_dir_read_batch(
+    File* file,
+    StorageDirEntry* entries,
+    size_t entries_count,
+    char* names,
+    size_t names_size) {
     S_FILE_API_PROLOGUE;
+    furi_check(entries || !entries_count);
     S_API_PROLOGUE;
 
     SAData data = {
-        .dread = {
+        .dreadbatch = {
             .file = file,
-            .fileinfo = fileinfo,
-            .name = name,
-            .name_length = name_length,
+            .entries = entries,
+            .entries_count = entries_count,
+            .names = names,
+            .names_size = names_size,
         }};
 
-    S_API_MESSAGE(StorageCommandDirRead);
+    S_API_MESSAGE(StorageCommandDirReadBatch);
     S_API_EPILOGUE;
-    return S_RETURN_BOOL;
+    return S_RETURN_SIZE;
 }
 
 bool storage_dir_rewind(File* file) {
@@ -444,6 +439,22 @@ FS_Error storage_common_timestamp(Storage* storage, const char* path, uint32_t*
     return S_RETURN_ERROR;
 }
 
+FS_Error storage_common_change_count(Storage* storage, const char* path, uint32_t* count) {
+    furi_check(storage);
+    S_API_PROLOGUE;
+
+    SAData data = {
+        .cchangecount = {
+            .path = path,
+            .count = count,
+            .thread_id = furi_thread_get_current_id(),
+        }};
+
+    S_API_MESSAGE(StorageCommandCommonChangeCount);
+    S_API_EPILOGUE;
+    return S_RETURN_ERROR;
+}
+
 FS_Error storage_common_stat(Storage* storage, const char* path, FileInfo* fileinfo) {
     furi_check(storage);
 
@@ -460,6 +471,30 @@ FS_Error storage_common_stat(Storage* storage, const char* path, FileInfo* filei
     return S_RETURN_ERROR;
 }
 
+size_t storage_common_stat_batch(
+    Storage* storage,
+    const char* const* paths,
+    FileInfo* fileinfos,
+    FS_Error* errors,
+    size_t count) {
+    furi_check(storage);
+    furi_check((paths && errors) || !count);
+
+    S_API_PROLOGUE;
+    SAData data = {
+        .cstatbatch = {
+            .paths = paths,
+            .fileinfos = fileinfos,
+            .errors = errors,
+            .count = count,
+            .thread_id = furi_thread_get_current_id(),
+        }};
+
+    S_API_MESSAGE(StorageCommandCommonStatBatch);
+    S_API_EPILOGUE;
+    return S_RETURN_SIZE;
+}
+
 FS_Error storage_common_remove(Storage* storage, const char* path) {
     furi_check(storage);
 
@@ -847,6 +882,52 @@ bool storage_common_is_subdir(Storage* storage, const char* parent, const char*
     return storage_internal_equivalent_path(storage, parent, child, true);
 }
 
+static bool storage_md5_cache_request(
+    Storage* storage,
+    StorageCommand command,
+    const char* path,
+    uint8_t* md5,
+    uint32_t* generation) {
+    bool cached = false;
+
+    S_API_PROLOGUE;
+    SAData data = {
+        .cmd5 = {
+            .path = path,
+            .md5 = md5,
+            .generation = generation,
+            .cached = &cached,
+            .thread_id = furi_thread_get_current_id(),
+        }};
+
+    S_API_MESSAGE(command);
+    S_API_EPILOGUE;
+    return cached;
+}
+
+FS_Error storage_common_md5(Storage* storage, const char* path, uint8_t* md5) {
+    furi_check(storage);
+    furi_check(path);
+    furi_check(md5);
+
+    uint32_t generation;
+    if(storage_md5_cache_request(storage, StorageCommandCommonMd5Get, path, md5, &generation)) {
+        return FSE_OK;
+    }
+
+    // Calculated here, so the storage thread is not blocked for the whole file
+    File* file = storage_file_alloc(storage);
+    FS_Error error = FSE_INTERNAL;
+    if(md5_calc_file(file, path, md5, &error)) {
+        storage_md5_cache_request(storage, StorageCommandCommonMd5Set, path, md5, &generation);
+    } else if(error == FSE_OK) {
+        error = FSE_INTERNAL;
+    }
+    storage_file_free(file);
+
+    return error;
+}
+
 /****************** ERROR ******************/
 
 const char* storage_error_get_desc(FS_Error error_id) {
@@ -968,7 +1049,6 @@ FuriPubSub* storage_get_pubsub(Storage* storage) {
 bool storage_simply_remove_recursive(Storage* storage, const char* path) {
     furi_check(storage);
     furi_check(path);
-    FileInfo fileinfo;
     bool result = false;
     FuriString* fullname;
     FuriString* cur_dir;
@@ -977,7 +1057,8 @@ bool storage_simply_remove_recursive(Storage* storage, const char* path) {
         return true;
     }
 
-    char* name = malloc(MAX_NAME_LENGTH + 1); //-V799
+    StorageDirEntry* entries = malloc(sizeof(StorageDirEntry) * DIR_BATCH_SIZE);
+    char* names = malloc(DIR_BATCH_NAMES_SIZE);
     File* dir = storage_file_alloc(storage);
     cur_dir = furi_string_alloc_set(path);
     bool go_deeper = false;
@@ -988,17 +1069,23 @@ bool storage_simply_remove_recursive(Storage* storage, const char* path) {
             break;
         }
 
-        while(storage_dir_read(dir, &fileinfo, name, MAX_NAME_LENGTH)) {
-            if(file_info_is_dir(&fileinfo)) {
-                furi_string_cat_printf(cur_dir, "/%s", name); //-V576
-                go_deeper = true;
-                break;
-            }
+        size_t count;
+        while(!go_deeper &&
+              (count = storage_dir_read_batch(
+                   dir, entries, DIR_BATCH_SIZE, names, DIR_BATCH_NAMES_SIZE))) {
+            for(size_t i = 0; i < count; i++) {
+                if(file_info_is_dir(&entries[i].fileinfo)) {
+                    furi_string_cat_printf(cur_dir, "/%s", entries[i].name); //-V576
+                    go_deeper = true;
+                    break;
+                }
 
-            fullname = furi_string_alloc_printf("%s/%s", furi_string_get_cstr(cur_dir), name);
-            FS_Error error = storage_common_remove(storage, furi_string_get_cstr(fullname));
-            furi_check(error == FSE_OK);
-            furi_string_free(fullname);
+                fullname = furi_string_alloc_printf(
+                    "%s/%s", furi_string_get_cstr(cur_dir), entries[i].name);
+                FS_Error error = storage_common_remove(storage, furi_string_get_cstr(fullname));
+                furi_check(error == FSE_OK);
+                furi_string_free(fullname);
+            }
         }
         storage_dir_close(dir);
 
@@ -1022,7 +1109,8 @@ bool storage_simply_remove_recursive(Storage* storage, const char* path) {
 
     storage_file_free(dir);
     furi_string_free(cur_dir);
-    free(name);
+    free(names);
+    free(entries);
     return result;
 } //-V773
 
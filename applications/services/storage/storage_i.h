@@ -4,6 +4,7 @@
 #include <gui/gui.h>
 #include "storage_glue.h"
 #include "storage_sd_api.h"
+#include "storage_md5_cache.h"
 #include "filesystem_api_internal.h"
 
 #ifdef __cplusplus
@@ -25,6 +26,7 @@ struct Storage {
     StorageData storage[STORAGE_COUNT];
     StorageSDGui sd_gui;
     FuriPubSub* pubsub;
+    StorageMd5Cache* md5_cache;
 };
 
 #ifdef __cplusplus
@@ -0,0 +1,388 @@
+#include "storage_md5_cache.h"
+
+#include "storage.h"
+
+#include <ctype.h>
+
+#define TAG "StorageMd5Cache"
+
+#define STORAGE_MD5_CACHE_DIR            EXT_PATH(".md5")
+#define STORAGE_MD5_CACHE_TABLE_CAPACITY (1024u)
+#define STORAGE_MD5_CACHE_TABLE_GROW     (64u)
+#define STORAGE_MD5_CACHE_PENDING_SIZE   (64u)
+#define STORAGE_MD5_CACHE_MAGIC          (0x4D443543UL)
+#define STORAGE_MD5_CACHE_VERSION        (2u)
+
+#define STORAGE_MD5_CACHE_FNV_BASIS (0xCBF29CE484222325ULL)
+#define STORAGE_MD5_CACHE_FNV_PRIME (0x100000001B3ULL)
+
+typedef struct {
+    uint64_t key;
+    uint32_t size;
+    uint32_t mtime;
+    uint8_t md5[STORAGE_MD5_CACHE_DIGEST_SIZE];
+} StorageMd5CacheEntry;
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint64_t dir_key;
+} StorageMd5CacheHeader;
+
+typedef struct {
+    uint64_t dir_key;
+    uint64_t key;
+} StorageMd5CachePending;
+
+struct StorageMd5Cache {
+    // Table of one directory, sorted by key
+    StorageMd5CacheEntry* entries;
+    size_t count;
+    size_t capacity;
+    uint64_t dir_key;
+    bool selected;
+    bool dirty;
+
+    // Invalidations of files in directories whose table is not in memory
+    StorageMd5CachePending pending[STORAGE_MD5_CACHE_PENDING_SIZE];
+    size_t pending_count;
+
+    uint32_t generation;
+};
+
+// FAT is case insensitive, so are the keys
+static uint64_t storage_md5_cache_key(const char* path, size_t length) {
+    uint64_t hash = STORAGE_MD5_CACHE_FNV_BASIS;
+    for(size_t i = 0; i < length; i++) {
+        hash = (hash ^ (uint8_t)tolower((uint8_t)path[i])) * STORAGE_MD5_CACHE_FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint64_t storage_md5_cache_dir_key(const char* path) {
+    const char* separator = strrchr(path, '/');
+    return storage_md5_cache_key(path, separator ? (size_t)(separator - path) : 0);
+}
+
+static bool storage_md5_cache_is_cached(const char* path) {
+    const size_t prefix_length = strlen(STORAGE_EXT_PATH_PREFIX "/");
+    const size_t dir_length = strlen(STORAGE_MD5_CACHE_DIR "/");
+
+    // Digests of the tables themselves would be outdated on every save
+    return strncmp(path, STORAGE_EXT_PATH_PREFIX "/", prefix_length) == 0 &&
+           strncasecmp(path, STORAGE_MD5_CACHE_DIR "/", dir_length) != 0;
+}
+
+// Index of the entry with the key, or of the place to insert it at
+static size_t storage_md5_cache_search(StorageMd5Cache* cache, uint64_t key) {
+    size_t low = 0;
+    size_t high = cache->count;
+
+    while(low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if(cache->entries[middle].key < key) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+static StorageMd5CacheEntry* storage_md5_cache_find(StorageMd5Cache* cache, uint64_t key) {
+    const size_t index = storage_md5_cache_search(cache, key);
+    if(index < cache->count && cache->entries[index].key == key) return &cache->entries[index];
+    return NULL;
+}
+
+static void storage_md5_cache_remove(StorageMd5Cache* cache, uint64_t key) {
+    const size_t index = storage_md5_cache_search(cache, key);
+    if(index < cache->count && cache->entries[index].key == key) {
+        cache->count--;
+        memmove(
+            &cache->entries[index],
+            &cache->entries[index + 1],
+            sizeof(StorageMd5CacheEntry) * (cache->count - index));
+        cache->dirty = true;
+    }
+}
+
+static void storage_md5_cache_release(StorageMd5Cache* cache) {
+    free(cache->entries);
+    cache->entries = NULL;
+    cache->count = 0;
+    cache->capacity = 0;
+    cache->selected = false;
+    cache->dirty = false;
+}
+
+StorageMd5Cache* storage_md5_cache_alloc(void) {
+    StorageMd5Cache* cache = malloc(sizeof(StorageMd5Cache));
+    return cache;
+}
+
+void storage_md5_cache_free(StorageMd5Cache* cache) {
+    furi_assert(cache);
+    storage_md5_cache_release(cache);
+    free(cache);
+}
+
+/****************** Persistence ******************/
+
+// The service can not call its own API, the file is accessed through the filesystem directly
+static bool storage_md5_cache_file_open(
+    StorageData* storage,
+    File* file,
+    FuriString* path,
+    FS_AccessMode access_mode,
+    FS_OpenMode open_mode) {
+    if(storage_path_already_open(path, storage)) return false;
+
+    storage_push_storage_file(file, path, storage);
+    const char* path_no_vfs = furi_string_get_cstr(path) + strlen(STORAGE_EXT_PATH_PREFIX);
+    if(storage->fs_api->file.open(storage, file, path_no_vfs, access_mode, open_mode)) {
+        return true;
+    }
+
+    storage->fs_api->file.close(storage, file);
+    storage_pop_storage_file(file, storage);
+    return false;
+}
+
+static bool storage_md5_cache_file_close(StorageData* storage, File* file) {
+    const bool result = storage->fs_api->file.close(storage, file);
+    storage_pop_storage_file(file, storage);
+    return result;
+}
+
+static FuriString* storage_md5_cache_table_path(uint64_t dir_key) {
+    return furi_string_alloc_printf(
+        STORAGE_MD5_CACHE_DIR "/%08lX%08lX", (uint32_t)(dir_key >> 32), (uint32_t)dir_key);
+}
+
+static void storage_md5_cache_table_load(StorageMd5Cache* cache, StorageData* storage) {
+    File file = {.type = FileTypeOpenFile};
+    FuriString* path = storage_md5_cache_table_path(cache->dir_key);
+
+    if(storage_md5_cache_file_open(storage, &file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        StorageMd5CacheHeader header;
+        const uint16_t header_size = sizeof(header);
+
+        if(storage->fs_api->file.read(storage, &file, &header, header_size) == header_size &&
+           header.magic == STORAGE_MD5_CACHE_MAGIC &&
+           header.version == STORAGE_MD5_CACHE_VERSION && header.dir_key == cache->dir_key &&
+           header.count && header.count <= STORAGE_MD5_CACHE_TABLE_CAPACITY) {
+            cache->capacity = header.count;
+            cache->entries = malloc(sizeof(StorageMd5CacheEntry) * cache->capacity);
+
+            const uint16_t entries_size = sizeof(StorageMd5CacheEntry) * header.count;
+            if(storage->fs_api->file.read(storage, &file, cache->entries, entries_size) ==
+               entries_size) {
+                cache->count = header.count;
+            }
+        }
+
+        storage_md5_cache_file_close(storage, &file);
+        FURI_LOG_D(TAG, "Loaded %zu digests", cache->count);
+    }
+
+    furi_string_free(path);
+}
+
+static void storage_md5_cache_table_save(StorageMd5Cache* cache, StorageData* storage) {
+    if(!cache->selected || !cache->dirty) return;
+    // Not retried till the next change, the card may be write protected
+    cache->dirty = false;
+
+    FuriString* path = storage_md5_cache_table_path(cache->dir_key);
+    const char* path_no_vfs = furi_string_get_cstr(path) + strlen(STORAGE_EXT_PATH_PREFIX);
+
+    if(cache->count) {
+        File file = {.type = FileTypeOpenFile};
+        storage->fs_api->common.mkdir(
+            storage, STORAGE_MD5_CACHE_DIR + strlen(STORAGE_EXT_PATH_PREFIX));
+
+        bool result = false;
+        if(storage_md5_cache_file_open(storage, &file, path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+            StorageMd5CacheHeader header = {
+                .magic = STORAGE_MD5_CACHE_MAGIC,
+                .version = STORAGE_MD5_CACHE_VERSION,
+                .count = cache->count,
+                .dir_key = cache->dir_key,
+            };
+            const uint16_t header_size = sizeof(header);
+            const uint16_t entries_size = sizeof(StorageMd5CacheEntry) * cache->count;
+
+            result = storage->fs_api->file.write(storage, &file, &header, header_size) ==
+                         header_size &&
+                     storage->fs_api->file.write(storage, &file, cache->entries, entries_size) ==
+                         entries_size;
+            result = storage_md5_cache_file_close(storage, &file) && result;
+        }
+
+        if(result) {
+            FURI_LOG_D(TAG, "Saved %zu digests", cache->count);
+        } else {
+            FURI_LOG_E(TAG, "Failed to save digests");
+        }
+    } else {
+        storage->fs_api->common.remove(storage, path_no_vfs);
+    }
+
+    furi_string_free(path);
+}
+
+// Make the table of the directory current, the previous one is saved
+static void
+    storage_md5_cache_select(StorageMd5Cache* cache, StorageData* storage, uint64_t dir_key) {
+    if(cache->selected && cache->dir_key == dir_key) return;
+
+    storage_md5_cache_table_save(cache, storage);
+    storage_md5_cache_release(cache);
+
+    cache->dir_key = dir_key;
+    cache->selected = true;
+    storage_md5_cache_table_load(cache, storage);
+
+    // Files changed while the table was on the card
+    size_t kept = 0;
+    for(size_t i = 0; i < cache->pending_count; i++) {
+        if(cache->pending[i].dir_key == dir_key) {
+            storage_md5_cache_remove(cache, cache->pending[i].key);
+        } else {
+            cache->pending[kept++] = cache->pending[i];
+        }
+    }
+    cache->pending_count = kept;
+}
+
+static void storage_md5_cache_flush(StorageMd5Cache* cache, StorageData* storage) {
+    // Every select drops at least one pending invalidation
+    while(cache->pending_count) {
+        storage_md5_cache_select(cache, storage, cache->pending[0].dir_key);
+    }
+}
+
+/****************** Public ******************/
+
+bool storage_md5_cache_get(
+    StorageMd5Cache* cache,
+    StorageData* storage,
+    const char* path,
+    uint64_t size,
+    uint32_t mtime,
+    uint8_t* md5) {
+    furi_assert(cache);
+    furi_assert(storage);
+    furi_assert(path);
+    furi_assert(md5);
+
+    if(!storage_md5_cache_is_cached(path)) return false;
+
+    storage_md5_cache_select(cache, storage, storage_md5_cache_dir_key(path));
+
+    StorageMd5CacheEntry* entry =
+        storage_md5_cache_find(cache, storage_md5_cache_key(path, strlen(path)));
+    if(!entry || entry->size != size || entry->mtime != mtime) return false;
+
+    memcpy(md5, entry->md5, STORAGE_MD5_CACHE_DIGEST_SIZE);
+    return true;
+}
+
+void storage_md5_cache_set(
+    StorageMd5Cache* cache,
+    StorageData* storage,
+    const char* path,
+    uint64_t size,
+    uint32_t mtime,
+    const uint8_t* md5) {
+    furi_assert(cache);
+    furi_assert(storage);
+    furi_assert(path);
+    furi_assert(md5);
+
+    if(size > UINT32_MAX || !storage_md5_cache_is_cached(path)) return;
+
+    storage_md5_cache_select(cache, storage, storage_md5_cache_dir_key(path));
+
+    const uint64_t key = storage_md5_cache_key(path, strlen(path));
+    const size_t index = storage_md5_cache_search(cache, key);
+    StorageMd5CacheEntry* entry = NULL;
+
+    if(index < cache->count && cache->entries[index].key == key) {
+        entry = &cache->entries[index];
+    } else {
+        // Full table keeps its entries, replacing them would make a sync miss every file
+        if(cache->count == STORAGE_MD5_CACHE_TABLE_CAPACITY) return;
+
+        if(cache->count == cache->capacity) {
+            cache->capacity = MIN(
+                cache->capacity + STORAGE_MD5_CACHE_TABLE_GROW, STORAGE_MD5_CACHE_TABLE_CAPACITY);
+            cache->entries = realloc( //-V701
+                cache->entries,
+                sizeof(StorageMd5CacheEntry) * cache->capacity);
+        }
+
+        memmove(
+            &cache->entries[index + 1],
+            &cache->entries[index],
+            sizeof(StorageMd5CacheEntry) * (cache->count - index));
+        cache->count++;
+        entry = &cache->entries[index];
+    }
+
+    entry->key = key;
+    entry->size = size;
+    entry->mtime = mtime;
+    memcpy(entry->md5, md5, STORAGE_MD5_CACHE_DIGEST_SIZE);
+    cache->dirty = true;
+}
+
+void storage_md5_cache_invalidate(StorageMd5Cache* cache, StorageData* storage, const char* path) {
+    furi_assert(cache);
+    furi_assert(storage);
+    furi_assert(path);
+
+    cache->generation++;
+
+    if(!storage_md5_cache_is_cached(path)) return;
+
+    const uint64_t dir_key = storage_md5_cache_dir_key(path);
+    const uint64_t key = storage_md5_cache_key(path, strlen(path));
+
+    if(cache->selected && cache->dir_key == dir_key) {
+        storage_md5_cache_remove(cache, key);
+    } else {
+        if(cache->pending_count == STORAGE_MD5_CACHE_PENDING_SIZE) {
+            storage_md5_cache_flush(cache, storage);
+        }
+        cache->pending[cache->pending_count++] = (StorageMd5CachePending){
+            .dir_key = dir_key,
+            .key = key,
+        };
+    }
+}
+
+void storage_md5_cache_reset(StorageMd5Cache* cache) {
+    furi_assert(cache);
+
+    cache->generation++;
+    cache->pending_count = 0;
+    storage_md5_cache_release(cache);
+}
+
+uint32_t storage_md5_cache_get_generation(const StorageMd5Cache* cache) {
+    furi_assert(cache);
+    return cache->generation;
+}
+
+void storage_md5_cache_save(StorageMd5Cache* cache, StorageData* storage) {
+    furi_assert(cache);
+    furi_assert(storage);
+
+    storage_md5_cache_flush(cache, storage);
+    storage_md5_cache_table_save(cache, storage);
+    storage_md5_cache_release(cache);
+}
@@ -0,0 +1,112 @@
+/**
+ * @file storage_md5_cache.h
+ * Storage: MD5 digest cache
+ *
+ * Keeps MD5 digests of files on the SD card, so directory listings with digests
+ * and repeated md5sum requests do not read the same files again. Entries are
+ * keyed by a hash of the resolved path and are valid only while the file size and
+ * modification time match.
+ *
+ * Digests are kept in one table per directory, up to 1024 files each, under
+ * /ext/.md5. Only the table of the directory in use is kept in memory, it is
+ * written back when another directory is used or the storage gets idle. Any
+ * write, removal, format or card change goes through the storage service, which
+ * invalidates the affected entries and bumps the generation: a digest calculated
+ * while the file was being changed is never stored. Invalidations of files whose
+ * table is on the card are kept until that table is loaded.
+ */
+#pragma once
+
+#include "storage_glue.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STORAGE_MD5_CACHE_DIGEST_SIZE (16u)
+
+typedef struct StorageMd5Cache StorageMd5Cache;
+
+/** Allocate StorageMd5Cache
+ *
+ * @return     StorageMd5Cache instance
+ */
+StorageMd5Cache* storage_md5_cache_alloc(void);
+
+/** Free StorageMd5Cache
+ *
+ * @param      cache  StorageMd5Cache instance
+ */
+void storage_md5_cache_free(StorageMd5Cache* cache);
+
+/** Look up the digest of a file
+ *
+ * @param      cache    StorageMd5Cache instance
+ * @param      storage  SD card storage, must be ready
+ * @param      path     resolved file path
+ * @param      size     current file size
+ * @param      mtime    current file modification time
+ * @param      md5      digest, filled on hit
+ *
+ * @return     true if the digest was found
+ */
+bool storage_md5_cache_get(
+    StorageMd5Cache* cache,
+    StorageData* storage,
+    const char* path,
+    uint64_t size,
+    uint32_t mtime,
+    uint8_t* md5);
+
+/** Store the digest of a file
+ *
+ * @param      cache    StorageMd5Cache instance
+ * @param      storage  SD card storage, must be ready
+ * @param      path     resolved file path
+ * @param      size     file size
+ * @param      mtime    file modification time
+ * @param      md5      digest
+ */
+void storage_md5_cache_set(
+    StorageMd5Cache* cache,
+    StorageData* storage,
+    const char* path,
+    uint64_t size,
+    uint32_t mtime,
+    const uint8_t* md5);
+
+/** Drop the digest of a file, bumps the generation
+ *
+ * @param      cache    StorageMd5Cache instance
+ * @param      storage  SD card storage
+ * @param      path     resolved file path
+ */
+void storage_md5_cache_invalidate(StorageMd5Cache* cache, StorageData* storage, const char* path);
+
+/** Drop all digests, bumps the generation
+ *
+ * Persisted digests are loaded again on the next use. Pending invalidations are
+ * dropped, so it is only for a card that is gone or formatted.
+ *
+ * @param      cache  StorageMd5Cache instance
+ */
+void storage_md5_cache_reset(StorageMd5Cache* cache);
+
+/** Get the generation, changed on every invalidation
+ *
+ * @param      cache  StorageMd5Cache instance
+ *
+ * @return     generation
+ */
+uint32_t storage_md5_cache_get_generation(const StorageMd5Cache* cache);
+
+/** Apply pending invalidations, persist digests and release memory
+ *
+ * @param      cache    StorageMd5Cache instance
+ * @param      storage  SD card storage, must be ready
+ */
+void storage_md5_cache_save(StorageMd5Cache* cache, StorageData* storage);
+
+#ifdef __cplusplus
+}
+#endif
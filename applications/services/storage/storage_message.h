@@ -16,15 +16,9 @@ typedef struct {
 
 typedef struct {
     File* file;
-    void* buff;
-    uint16_t bytes_to_read;
-} SADataFRead;
-
-typedef struct {
-    File* file;
-    const void* buff;
-    uint16_t bytes_to_write;
-} SADataFWrite;
+    const StorageIoVec* vector;
+    size_t vector_count;
+} SADataFVector;
 
 typedef struct {
     File* file;
@@ -40,10 +34,11 @@ typedef struct {
 
 typedef struct {
     File* file;
-    FileInfo* fileinfo;
-    char* name;
-    uint16_t name_length;
-} SADataDRead;
+    StorageDirEntry* entries;
+    size_t entries_count;
+    char* names;
+    size_t names_size;
+} SADataDReadBatch;
 
 typedef struct {
     const char* path;
@@ -51,12 +46,26 @@ typedef struct {
     FuriThreadId thread_id;
 } SADataCTimestamp;
 
+typedef struct {
+    const char* path;
+    uint32_t* count;
+    FuriThreadId thread_id;
+} SADataCChangeCount;
+
 typedef struct {
     const char* path;
     FileInfo* fileinfo;
     FuriThreadId thread_id;
 } SADataCStat;
 
+typedef struct {
+    const char* const* paths;
+    FileInfo* fileinfos;
+    FS_Error* errors;
+    size_t count;
+    FuriThreadId thread_id;
+} SADataCStatBatch;
+
 typedef struct {
     const char* fs_path;
     uint64_t* total_space;
@@ -76,6 +85,14 @@ typedef struct {
     FuriThreadId thread_id;
 } SADataCEquivPath;
 
+typedef struct {
+    const char* path;
+    uint8_t* md5;
+    uint32_t* generation;
+    bool* cached;
+    FuriThreadId thread_id;
+} SADataCMd5;
+
 typedef struct {
     uint32_t id;
 } SADataError;
@@ -95,18 +112,20 @@ typedef struct {
 
 typedef union {
     SADataFOpen fopen;
-    SADataFRead fread;
-    SADataFWrite fwrite;
+    SADataFVector fvector;
     SADataFSeek fseek;
 
     SADataDOpen dopen;
-    SADataDRead dread;
+    SADataDReadBatch dreadbatch;
 
     SADataCTimestamp ctimestamp;
+    SADataCChangeCount cchangecount;
     SADataCStat cstat;
+    SADataCStatBatch cstatbatch;
     SADataCFSInfo cfsinfo;
     SADataCResolvePath cresolvepath;
     SADataCEquivPath cequivpath;
+    SADataCMd5 cmd5;
 
     SADataError error;
 
@@ -120,6 +139,7 @@ typedef union {
     bool bool_value;
     uint16_t uint16_value;
     uint64_t uint64_value;
+    size_t size_value;
     FS_Error error_value;
     const char* cstring_value;
 } SAReturn;
@@ -127,8 +147,8 @@ typedef union {
 typedef enum {
     StorageCommandFileOpen,
     StorageCommandFileClose,
-    StorageCommandFileRead,
-    StorageCommandFileWrite,
+    StorageCommandFileReadVector,
+    StorageCommandFileWriteVector,
     StorageCommandFileSeek,
     StorageCommandFileTell,
     StorageCommandFileTruncate,
@@ -137,7 +157,7 @@ typedef enum {
     StorageCommandFileEof,
     StorageCommandDirOpen,
     StorageCommandDirClose,
-    StorageCommandDirRead,
+    StorageCommandDirReadBatch,
     StorageCommandDirRewind,
     StorageCommandCommonTimestamp,
     StorageCommandCommonStat,
@@ -151,6 +171,10 @@ typedef enum {
     StorageCommandCommonResolvePath,
     StorageCommandSDMount,
     StorageCommandCommonEquivalentPath,
+    StorageCommandCommonMd5Get,
+    StorageCommandCommonMd5Set,
+    StorageCommandCommonStatBatch,
+    StorageCommandCommonChangeCount,
 } StorageCommand;
 
 typedef struct {
@@ -117,6 +117,8 @@ bool storage_process_file_open(
         } else {
             if(access_mode & FSAM_WRITE) {
                 storage_data_timestamp(storage);
+                storage_md5_cache_invalidate(
+                    app->md5_cache, &app->storage[ST_EXT], furi_string_get_cstr(path));
             }
             storage_push_storage_file(file, path, storage);
 
@@ -177,6 +179,37 @@ static uint16_t storage_process_file_write(
     return ret;
 }
 
+// Chunks are limited by the filesystem API, the first short one ends the transfer
+static size_t storage_process_file_vector(
+    Storage* app,
+    File* file,
+    const StorageIoVec* vector,
+    size_t vector_count,
+    bool write) {
+    size_t total = 0;
+
+    for(size_t i = 0; i < vector_count; i++) {
+        uint8_t* buff = vector[i].buff;
+        size_t done = 0;
+
+        while(done < vector[i].size) {
+            const uint16_t chunk = MIN(vector[i].size - done, (size_t)UINT16_MAX);
+            const uint16_t result =
+                write ? storage_process_file_write(app, file, buff + done, chunk) :
+                        storage_process_file_read(app, file, buff + done, chunk);
+            done += result;
+
+            if(file->error_id != FSE_OK || result != chunk) {
+                return total + done;
+            }
+        }
+
+        total += done;
+    }
+
+    return total;
+}
+
 static bool storage_process_file_seek(
     Storage* app,
     File* file,
@@ -315,6 +348,48 @@ bool storage_process_dir_read(
     return ret;
 }
 
+static size_t storage_process_dir_read_batch(
+    Storage* app,
+    File* file,
+    StorageDirEntry* entries,
+    size_t entries_count,
+    char* names,
+    size_t names_size) {
+    size_t count = 0;
+
+    if(names_size == 0) {
+        names = NULL;
+    }
+
+    while(count < entries_count) {
+        // Only the first name may be truncated
+        if(count > 0 && names && names_size < STORAGE_DIR_BATCH_NAME_SIZE) {
+            break;
+        }
+
+        StorageDirEntry* entry = &entries[count];
+        const uint16_t name_length = MIN(names_size, (size_t)UINT16_MAX);
+        if(!storage_process_dir_read(app, file, &entry->fileinfo, names, name_length)) {
+            break;
+        }
+
+        entry->name = names;
+        if(names) {
+            const size_t name_size = strlen(names) + 1;
+            names += name_size;
+            names_size -= name_size;
+        }
+        count++;
+    }
+
+    // The end of the directory is reported by the next batch
+    if(count > 0) {
+        file->error_id = FSE_OK;
+    }
+
+    return count;
+}
+
 bool storage_process_dir_rewind(Storage* app, File* file) {
     bool ret = false;
     StorageData* storage = get_storage_by_file(file, app->storage);
@@ -342,6 +417,18 @@ static FS_Error
     return ret;
 }
 
+static FS_Error
+    storage_process_common_change_count(Storage* app, FuriString* path, uint32_t* count) {
+    StorageData* storage;
+    FS_Error ret = storage_get_data(app, path, &storage);
+
+    if(ret == FSE_OK) {
+        *count = storage_data_get_change_count(storage);
+    }
+
+    return ret;
+}
+
 static FS_Error storage_process_common_stat(Storage* app, FuriString* path, FileInfo* fileinfo) {
     StorageData* storage;
     FS_Error ret = storage_get_data(app, path, &storage);
@@ -366,6 +453,8 @@ static FS_Error storage_process_common_remove(Storage* app, FuriString* path) {
         }
 
         storage_data_timestamp(storage);
+        storage_md5_cache_invalidate(
+            app->md5_cache, &app->storage[ST_EXT], furi_string_get_cstr(path));
         FS_CALL(storage, common.remove(storage, cstr_path_without_vfs_prefix(path)));
     } while(false);
 
@@ -426,6 +515,77 @@ static bool
     return ret;
 }
 
+/****************** MD5 digest cache ******************/
+
+static FS_Error storage_process_common_md5_stat(
+    StorageData* storage,
+    FuriString* path,
+    uint64_t* size,
+    uint32_t* mtime) {
+    FS_Error ret;
+    FileInfo fileinfo;
+
+    do {
+        FS_CALL(storage, common.stat(storage, cstr_path_without_vfs_prefix(path), &fileinfo));
+        if(ret != FSE_OK) break;
+
+        if(file_info_is_dir(&fileinfo)) {
+            ret = FSE_INVALID_PARAMETER;
+            break;
+        }
+
+        // File being written may change any moment
+        if(storage_path_already_open(path, storage)) {
+            ret = FSE_ALREADY_OPEN;
+            break;
+        }
+
+        *size = fileinfo.size;
+        FS_CALL(storage, common.mtime(storage, cstr_path_without_vfs_prefix(path), mtime));
+    } while(false);
+
+    return ret;
+}
+
+static bool storage_process_common_md5_get(
+    Storage* app,
+    FuriString* path,
+    uint8_t* md5,
+    uint32_t* generation) {
+    bool ret = false;
+    StorageData* storage;
+    uint64_t size;
+    uint32_t mtime;
+
+    *generation = storage_md5_cache_get_generation(app->md5_cache);
+
+    if(storage_get_data(app, path, &storage) == FSE_OK &&
+       storage_process_common_md5_stat(storage, path, &size, &mtime) == FSE_OK) {
+        ret = storage_md5_cache_get(
+            app->md5_cache, storage, furi_string_get_cstr(path), size, mtime, md5);
+    }
+
+    return ret;
+}
+
+static void storage_process_common_md5_set(
+    Storage* app,
+    FuriString* path,
+    const uint8_t* md5,
+    uint32_t generation) {
+    StorageData* storage;
+    uint64_t size;
+    uint32_t mtime;
+
+    // Digest is dropped if anything was changed while it was calculated
+    if(generation == storage_md5_cache_get_generation(app->md5_cache) &&
+       storage_get_data(app, path, &storage) == FSE_OK &&
+       storage_process_common_md5_stat(storage, path, &size, &mtime) == FSE_OK) {
+        storage_md5_cache_set(
+            app->md5_cache, storage, furi_string_get_cstr(path), size, mtime, md5);
+    }
+}
+
 /****************** Raw SD API ******************/
 // TODO FL-3521: think about implementing a custom storage API to split that kind of api linkage
 #include "storages/storage_ext.h"
@@ -438,6 +598,7 @@ static FS_Error storage_process_sd_format(Storage* app) {
     } else {
         ret = sd_format_card(&app->storage[ST_EXT]);
         storage_data_timestamp(&app->storage[ST_EXT]);
+        storage_md5_cache_reset(app->md5_cache);
     }
 
     return ret;
@@ -458,8 +619,10 @@ static FS_Error storage_process_sd_unmount(Storage* app) {
             break;
         }
 
+        storage_md5_cache_save(app->md5_cache, storage);
         sd_unmount_card(storage);
         storage_data_timestamp(storage);
+        storage_md5_cache_reset(app->md5_cache);
     } while(false);
 
     return ret;
@@ -477,6 +640,7 @@ static FS_Error storage_process_sd_mount(Storage* app) {
 
         ret = sd_mount_card(storage, true);
         storage_data_timestamp(storage);
+        storage_md5_cache_reset(app->md5_cache);
     } while(false);
 
     return ret;
@@ -569,6 +733,25 @@ void storage_process_alias(
 
 /****************** API calls processing ******************/
 
+static size_t storage_process_common_stat_batch(Storage* app, SADataCStatBatch* data) {
+    FuriString* path = furi_string_alloc();
+    size_t count = 0;
+
+    for(size_t i = 0; i < data->count; i++) {
+        furi_string_set(path, data->paths[i]);
+        storage_process_alias(app, path, data->thread_id, false);
+
+        FileInfo* fileinfo = data->fileinfos ? &data->fileinfos[i] : NULL;
+        data->errors[i] = storage_process_common_stat(app, path, fileinfo);
+        if(data->errors[i] == FSE_OK) {
+            count++;
+        }
+    }
+
+    furi_string_free(path);
+    return count;
+}
+
 void storage_process_message_internal(Storage* app, StorageMessage* message) {
     FuriString* path = NULL;
 
@@ -588,19 +771,21 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
         message->return_data->bool_value =
             storage_process_file_close(app, message->data->fopen.file);
         break;
-    case StorageCommandFileRead:
-        message->return_data->uint16_value = storage_process_file_read(
+    case StorageCommandFileReadVector:
+        message->return_data->size_value = storage_process_file_vector(
             app,
-            message->data->fread.file,
-            message->data->fread.buff,
-            message->data->fread.bytes_to_read);
+            message->data->fvector.file,
+            message->data->fvector.vector,
+            message->data->fvector.vector_count,
+            false);
         break;
-    case StorageCommandFileWrite:
-        message->return_data->uint16_value = storage_process_file_write(
+    case StorageCommandFileWriteVector:
+        message->return_data->size_value = storage_process_file_vector(
             app,
-            message->data->fwrite.file,
-            message->data->fwrite.buff,
-            message->data->fwrite.bytes_to_write);
+            message->data->fvector.file,
+            message->data->fvector.vector,
+            message->data->fvector.vector_count,
+            true);
         break;
     case StorageCommandFileSeek:
         message->return_data->bool_value = storage_process_file_seek(
@@ -640,13 +825,14 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
         message->return_data->bool_value =
             storage_process_dir_close(app, message->data->file.file);
         break;
-    case StorageCommandDirRead:
-        message->return_data->bool_value = storage_process_dir_read(
+    case StorageCommandDirReadBatch:
+        message->return_data->size_value = storage_process_dir_read_batch(
             app,
-            message->data->dread.file,
-            message->data->dread.fileinfo,
-            message->data->dread.name,
-            message->data->dread.name_length);
+            message->data->dreadbatch.file,
+            message->data->dreadbatch.entries,
+            message->data->dreadbatch.entries_count,
+            message->data->dreadbatch.names,
+            message->data->dreadbatch.names_size);
         break;
     case StorageCommandDirRewind:
         message->return_data->bool_value =
@@ -660,12 +846,22 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
         message->return_data->error_value =
             storage_process_common_timestamp(app, path, message->data->ctimestamp.timestamp);
         break;
+    case StorageCommandCommonChangeCount:
+        path = furi_string_alloc_set(message->data->cchangecount.path);
+        storage_process_alias(app, path, message->data->cchangecount.thread_id, false);
+        message->return_data->error_value =
+            storage_process_common_change_count(app, path, message->data->cchangecount.count);
+        break;
     case StorageCommandCommonStat:
         path = furi_string_alloc_set(message->data->cstat.path);
         storage_process_alias(app, path, message->data->cstat.thread_id, false);
         message->return_data->error_value =
             storage_process_common_stat(app, path, message->data->cstat.fileinfo);
         break;
+    case StorageCommandCommonStatBatch:
+        message->return_data->size_value =
+            storage_process_common_stat_batch(app, &message->data->cstatbatch);
+        break;
     case StorageCommandCommonRemove:
         path = furi_string_alloc_set(message->data->path.path);
         storage_process_alias(app, path, message->data->path.thread_id, false);
@@ -720,6 +916,19 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
         break;
     }
 
+    case StorageCommandCommonMd5Get:
+        path = furi_string_alloc_set(message->data->cmd5.path);
+        storage_process_alias(app, path, message->data->cmd5.thread_id, false);
+        *message->data->cmd5.cached = storage_process_common_md5_get(
+            app, path, message->data->cmd5.md5, message->data->cmd5.generation);
+        break;
+    case StorageCommandCommonMd5Set:
+        path = furi_string_alloc_set(message->data->cmd5.path);
+        storage_process_alias(app, path, message->data->cmd5.thread_id, false);
+        storage_process_common_md5_set(
+            app, path, message->data->cmd5.md5, *message->data->cmd5.generation);
+        break;
+
     // SD operations
     case StorageCommandSDFormat:
         message->return_data->error_value = storage_process_sd_format(app);
@@ -605,6 +605,18 @@ static FS_Error storage_ext_common_stat(void* ctx, const char* path, FileInfo* f
     return storage_ext_parse_error(result);
 }
 
+static FS_Error storage_ext_common_mtime(void* ctx, const char* path, uint32_t* mtime) {
+    UNUSED(ctx);
+    SDFileInfo _fileinfo;
+    SDError result = f_stat(path, &_fileinfo);
+
+    if(result == FR_OK) {
+        *mtime = ((uint32_t)_fileinfo.fdate << 16) | _fileinfo.ftime;
+    }
+
+    return storage_ext_parse_error(result);
+}
+
 static FS_Error storage_ext_common_remove(void* ctx, const char* path) {
     UNUSED(ctx);
 #ifdef FURI_RAM_EXEC
@@ -703,6 +715,7 @@ static const FS_Api fs_api = {
     .common =
         {
             .stat = storage_ext_common_stat,
+            .mtime = storage_ext_common_mtime,
             .mkdir = storage_ext_common_mkdir,
             .remove = storage_ext_common_remove,
             .fs_info = storage_ext_common_fs_info,
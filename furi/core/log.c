@@ -1,6 +1,8 @@
 #include "log.h"
 #include "check.h"
 #include "mutex.h"
+#include "thread.h"
+#include "memmgr.h"
 #include <furi_hal.h>
 #include <m-list.h>
 
@@ -8,10 +10,34 @@ LIST_DEF(FuriLogHandlersList, FuriLogHandler, M_POD_OPLIST)
 
 #define FURI_LOG_LEVEL_DEFAULT FuriLogLevelInfo
 
+/* Deferred records, power of 2 */
+#define FURI_LOG_DEFERRED_RECORDS    64U
+#define FURI_LOG_DEFERRED_STACK_SIZE 1024U
+#define FURI_LOG_DEFERRED_FLAG_WAKE  (1UL << 0)
+#define FURI_LOG_DEFERRED_FLAG_STOP  (1UL << 1)
+
+typedef struct {
+    volatile uint32_t sequence; /* index + 1 once the record is complete */
+    FuriLogBinaryRecord data;
+} FuriLogRecord;
+
+typedef struct {
+    FuriLogRecord* records;
+    FuriThread* thread;
+    FuriLogHandler handler; /* receives binary frames */
+    volatile uint32_t writers; /* records reserved, but not published yet */
+    volatile uint32_t head; /* next record to reserve */
+    volatile uint32_t tail; /* next record to drain */
+    volatile uint32_t dropped;
+    volatile bool idle;
+    volatile bool enabled;
+} FuriLogDeferred;
+
 typedef struct {
     FuriLogLevel log_level;
     FuriMutex* mutex;
     FuriLogHandlersList_t tx_handlers;
+    FuriLogDeferred deferred;
 } FuriLogParams;
 
 static FuriLogParams furi_log = {0};
@@ -107,7 +133,199 @@ void furi_log_puts(const char* data) {
     furi_log_tx((const uint8_t*)data, strlen(data));
 }
 
+static bool furi_log_is_static(const void* ptr) {
+    /* Host decoder resolves strings from the firmware image only */
+    return ((uint32_t)ptr >= FLASH_BASE) && ((uint32_t)ptr < (FLASH_BASE + FLASH_SIZE));
+}
+
+static bool
+    furi_log_defer(FuriLogLevel level, const char* tag, const char* format, va_list args) {
+    FuriLogDeferred* deferred = &furi_log.deferred;
+
+    if((tag && !furi_log_is_static(tag)) || !furi_log_is_static(format)) {
+        return false;
+    }
+
+    uint32_t index = 0;
+    bool reserved = false;
+    FURI_CRITICAL_ENTER();
+    const bool enabled = deferred->enabled;
+    if(!enabled) {
+        /* Stopped since the caller checked */
+    } else if(deferred->head - deferred->tail < FURI_LOG_DEFERRED_RECORDS) {
+        index = deferred->head++;
+        deferred->writers++;
+        reserved = true;
+    } else {
+        deferred->dropped++;
+    }
+    FURI_CRITICAL_EXIT();
+
+    if(!enabled) return false;
+
+    if(reserved) {
+        FuriLogRecord* record = &deferred->records[index & (FURI_LOG_DEFERRED_RECORDS - 1)];
+        record->data.tick = furi_get_tick();
+        record->data.tag = tag;
+        record->data.format = format;
+        record->data.level = level;
+
+        size_t args_size = 0;
+        va_list args_copy;
+        va_copy(args_copy, args);
+        record->data.flags =
+            furi_log_pack_args(record->data.args, &args_size, format, args_copy) ?
+                0 :
+                FURI_LOG_BINARY_FLAG_TRUNCATED;
+        va_end(args_copy);
+        record->data.args_size = args_size;
+
+        __DMB();
+        record->sequence = index + 1;
+
+        if(deferred->idle) {
+            deferred->idle = false;
+            furi_thread_flags_set(
+                furi_thread_get_id(deferred->thread), FURI_LOG_DEFERRED_FLAG_WAKE);
+        }
+
+        /* Ring and thread are not freed until the last writer leaves */
+        FURI_CRITICAL_ENTER();
+        deferred->writers--;
+        FURI_CRITICAL_EXIT();
+    }
+
+    /* Dropped records are accounted too, keep the caller off the slow path */
+    return true;
+}
+
+static bool furi_log_deferred_drain(void) {
+    FuriLogDeferred* deferred = &furi_log.deferred;
+    uint8_t frame[FURI_LOG_BINARY_FRAME_SIZE];
+    bool drained = false;
+
+    while(deferred->tail != deferred->head) {
+        const uint32_t index = deferred->tail;
+        FuriLogRecord* record = &deferred->records[index & (FURI_LOG_DEFERRED_RECORDS - 1)];
+        /* Reserved, but its writer is preempted */
+        if(record->sequence != index + 1) break;
+        __DMB();
+
+        uint32_t dropped;
+        FURI_CRITICAL_ENTER();
+        dropped = deferred->dropped;
+        deferred->dropped = 0;
+        FURI_CRITICAL_EXIT();
+
+        const size_t size =
+            furi_log_binary_frame(&record->data, MIN(dropped, (uint32_t)UINT16_MAX), frame);
+        __DMB();
+        deferred->tail = index + 1;
+
+        /* Binary frames are for the session handler only, text consoles can't show them */
+        deferred->handler.callback(frame, size, deferred->handler.context);
+        drained = true;
+    }
+
+    return drained;
+}
+
+static int32_t furi_log_deferred_thread(void* context) {
+    UNUSED(context);
+    FuriLogDeferred* deferred = &furi_log.deferred;
+    uint32_t flags = 0;
+
+    while((flags & FuriFlagError) || !(flags & FURI_LOG_DEFERRED_FLAG_STOP)) {
+        furi_log_deferred_drain();
+
+        deferred->idle = true;
+        /* Record completed before idle was set would not wake us */
+        if(furi_log_deferred_drain()) {
+            deferred->idle = false;
+            continue;
+        }
+        /* Preempted writers complete their records later, poll for them */
+        const uint32_t timeout = (deferred->tail != deferred->head) ? 1 : FuriWaitForever;
+        flags = furi_thread_flags_wait(
+            FURI_LOG_DEFERRED_FLAG_WAKE | FURI_LOG_DEFERRED_FLAG_STOP, FuriFlagWaitAny, timeout);
+    }
+
+    return 0;
+}
+
+bool furi_log_deferred_start(FuriLogHandler handler) {
+    furi_check(handler.callback);
+    FuriLogDeferred* deferred = &furi_log.deferred;
+
+    furi_check(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk);
+
+    const bool started = !deferred->thread;
+    if(started) {
+        deferred->records = malloc(sizeof(FuriLogRecord) * FURI_LOG_DEFERRED_RECORDS);
+        deferred->handler = handler;
+        deferred->writers = 0;
+        deferred->head = 0;
+        deferred->tail = 0;
+        deferred->dropped = 0;
+        deferred->idle = false;
+
+        deferred->thread = furi_thread_alloc_service(
+            "LogDeferred", FURI_LOG_DEFERRED_STACK_SIZE, furi_log_deferred_thread, NULL);
+        furi_thread_set_priority(deferred->thread, FuriThreadPriorityLowest);
+        furi_thread_start(deferred->thread);
+
+        deferred->enabled = true;
+    }
+
+    furi_mutex_release(furi_log.mutex);
+
+    return started;
+}
+
+void furi_log_deferred_stop(void) {
+    FuriLogDeferred* deferred = &furi_log.deferred;
+
+    furi_check(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk);
+
+    if(deferred->thread) {
+        FURI_CRITICAL_ENTER();
+        deferred->enabled = false;
+        FURI_CRITICAL_EXIT();
+
+        /* Let preempted writers publish their records */
+        while(deferred->writers) {
+            furi_delay_tick(1);
+        }
+
+        furi_thread_flags_set(furi_thread_get_id(deferred->thread), FURI_LOG_DEFERRED_FLAG_STOP);
+        furi_thread_join(deferred->thread);
+        furi_thread_free(deferred->thread);
+        deferred->thread = NULL;
+
+        /* Whatever is left goes to the session handler before it is removed */
+        furi_log_deferred_drain();
+
+        free(deferred->records);
+        deferred->records = NULL;
+        deferred->handler = (FuriLogHandler){0};
+    }
+
+    furi_mutex_release(furi_log.mutex);
+}
+
+bool furi_log_is_deferred(void) {
+    return furi_log.deferred.enabled;
+}
+
 void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
+    if(level <= furi_log.log_level && furi_log.deferred.enabled) {
+        va_list args;
+        va_start(args, format);
+        const bool deferred = furi_log_defer(level, tag, format, args);
+        va_end(args);
+        if(deferred) return;
+    }
+
     if(level <= furi_log.log_level &&
        furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
         FuriString* string;
@@ -161,6 +379,14 @@ void furi_log_print_format(FuriLogLevel level, const char* tag, const char* form
 }
 
 void furi_log_print_raw_format(FuriLogLevel level, const char* format, ...) {
+    if(level <= furi_log.log_level && furi_log.deferred.enabled) {
+        va_list args;
+        va_start(args, format);
+        const bool deferred = furi_log_defer(level, NULL, format, args);
+        va_end(args);
+        if(deferred) return;
+    }
+
     if(level <= furi_log.log_level &&
        furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
         FuriString* string;
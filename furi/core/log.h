@@ -97,6 +97,83 @@ void furi_log_print_format(FuriLogLevel level, const char* tag, const char* form
 void furi_log_print_raw_format(FuriLogLevel level, const char* format, ...)
     _ATTRIBUTE((__format__(__printf__, 2, 3)));
 
+/** Start deferred logging
+ *
+ * Deferred records keep tag and format addresses with packed arguments and
+ * are sent as binary frames by a low priority thread, so logging call costs
+ * no formatting or transmission. Records with tag or format outside of the
+ * firmware image (applications) are printed as usual. Frames are decoded on
+ * the host with scripts/logdecode.py and the firmware ELF.
+ *
+ * Binary frames go to the given handler only. While the session is active,
+ * deferred records are not printed, so other handlers only get the records
+ * that can't be deferred and furi_log_tx() output. Only one deferred session
+ * can be active at a time.
+ *
+ * @param[in]  handler  The handler that receives binary frames
+ *
+ * @return     true on success, false if deferred logging is already started
+ */
+bool furi_log_deferred_start(FuriLogHandler handler);
+
+/** Stop deferred logging
+ *
+ * Pending records are sent to the session handler, then the thread and the
+ * record ring are freed. Call it before removing the session handler.
+ */
+void furi_log_deferred_stop(void);
+
+/** Check if deferred logging is enabled
+ *
+ * @return     true if log records are deferred
+ */
+bool furi_log_is_deferred(void);
+
+/** Maximum size of packed arguments of a binary record */
+#define FURI_LOG_BINARY_ARGS_SIZE 32U
+
+/** Maximum size of a binary frame */
+#define FURI_LOG_BINARY_FRAME_SIZE (2U + 1U + 16U + FURI_LOG_BINARY_ARGS_SIZE + 1U)
+
+/** Binary record arguments were truncated */
+#define FURI_LOG_BINARY_FLAG_TRUNCATED (1U << 0)
+
+/** Deferred log record, the frame keeps tag and format addresses only */
+typedef struct {
+    uint32_t tick;
+    const char* tag; /**< NULL for raw records */
+    const char* format;
+    uint8_t level;
+    uint8_t flags;
+    uint8_t args_size;
+    uint8_t args[FURI_LOG_BINARY_ARGS_SIZE];
+} FuriLogBinaryRecord;
+
+/** Pack printf arguments of a binary record
+ *
+ * Arguments are stored in format order: 32-bit values, 64-bit integers and
+ * doubles, strings with terminating zero. Packing stops at the first argument
+ * that doesn't fit, a string is cut to the remaining space.
+ *
+ * @param[out]     out     FURI_LOG_BINARY_ARGS_SIZE bytes buffer
+ * @param[in,out]  size    packed size
+ * @param[in]      format  printf format
+ * @param[in]      args    format arguments
+ *
+ * @return     true if all arguments were packed, false if truncated
+ */
+bool furi_log_pack_args(uint8_t* out, size_t* size, const char* format, va_list args);
+
+/** Build a binary frame
+ *
+ * @param[in]   record   The record
+ * @param[in]   dropped  Records dropped before this one
+ * @param[out]  frame    FURI_LOG_BINARY_FRAME_SIZE bytes buffer
+ *
+ * @return     frame size
+ */
+size_t furi_log_binary_frame(const FuriLogBinaryRecord* record, uint16_t dropped, uint8_t* frame);
+
 /** Set log level
  *
  * @param[in]  level  The level
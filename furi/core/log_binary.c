@@ -0,0 +1,125 @@
+#include "log.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/* Binary frame: magic, payload size, payload, sum of payload bytes.
+ * 0xFF never appears in UTF-8 text, so frames can be mixed with text output.
+ * Payload (little endian): u32 tick, u8 level, u8 flags, u16 dropped records,
+ * u32 tag address (0 for raw records), u32 format address, packed arguments.
+ * Keep in sync with scripts/logdecode.py */
+#define FURI_LOG_BINARY_MAGIC_0     0xFFU
+#define FURI_LOG_BINARY_MAGIC_1     0xF1U
+#define FURI_LOG_BINARY_HEADER_SIZE 16U
+
+_Static_assert(
+    FURI_LOG_BINARY_FRAME_SIZE ==
+        2 + 1 + FURI_LOG_BINARY_HEADER_SIZE + FURI_LOG_BINARY_ARGS_SIZE + 1,
+    "Frame size mismatch");
+
+static bool furi_log_pack(uint8_t* out, size_t* size, const void* value, size_t value_size) {
+    if(*size + value_size > FURI_LOG_BINARY_ARGS_SIZE) return false;
+    memcpy(out + *size, value, value_size);
+    *size += value_size;
+    return true;
+}
+
+/* Store arguments in format order: 32-bit values, 64-bit integers and doubles,
+ * strings are copied with terminating zero */
+bool furi_log_pack_args(uint8_t* out, size_t* size, const char* format, va_list args) {
+    bool success = true;
+
+    for(const char* p = format; success && *p; p++) {
+        if(*p != '%') continue;
+        p++;
+        if(*p == '%') continue;
+
+        while(*p && strchr("-+ #0", *p)) p++;
+        for(uint8_t i = 0; i < 2; i++) {
+            if(*p == '*') {
+                int value = va_arg(args, int);
+                success &= furi_log_pack(out, size, &value, sizeof(value));
+                p++;
+            } else {
+                while(*p >= '0' && *p <= '9') p++;
+            }
+            if(i == 0 && *p == '.') {
+                p++;
+            } else {
+                break;
+            }
+        }
+
+        bool wide = false;
+        while(*p && strchr("hlLqjzt", *p)) {
+            if((*p == 'l' && p[1] == 'l') || *p == 'q' || *p == 'j') wide = true;
+            p++;
+        }
+
+        if(!success || !*p) break;
+
+        if(strchr("diouxXc", *p)) {
+            if(wide) {
+                uint64_t value = va_arg(args, uint64_t);
+                success = furi_log_pack(out, size, &value, sizeof(value));
+            } else {
+                uint32_t value = va_arg(args, uint32_t);
+                success = furi_log_pack(out, size, &value, sizeof(value));
+            }
+        } else if(strchr("fFeEgGaA", *p)) {
+            double value = va_arg(args, double);
+            success = furi_log_pack(out, size, &value, sizeof(value));
+        } else if(*p == 's') {
+            const char* value = va_arg(args, const char*);
+            if(!value) value = "(null)";
+            const size_t length = strlen(value);
+            const size_t space = FURI_LOG_BINARY_ARGS_SIZE - *size;
+            if(length < space) {
+                success = furi_log_pack(out, size, value, length + 1);
+            } else if(space) {
+                memcpy(out + *size, value, space - 1);
+                out[FURI_LOG_BINARY_ARGS_SIZE - 1] = '\0';
+                *size = FURI_LOG_BINARY_ARGS_SIZE;
+                success = false;
+            } else {
+                success = false;
+            }
+        } else if(*p == 'p') {
+            uint32_t value = (uintptr_t)va_arg(args, void*);
+            success = furi_log_pack(out, size, &value, sizeof(value));
+        } else if(*p == 'n') {
+            (void)va_arg(args, void*);
+        } else {
+            success = false;
+        }
+    }
+
+    return success;
+}
+
+size_t furi_log_binary_frame(const FuriLogBinaryRecord* record, uint16_t dropped, uint8_t* frame) {
+    const size_t payload_size = FURI_LOG_BINARY_HEADER_SIZE + record->args_size;
+    uint8_t* payload = &frame[2 + 1];
+
+    frame[0] = FURI_LOG_BINARY_MAGIC_0;
+    frame[1] = FURI_LOG_BINARY_MAGIC_1;
+    frame[2] = payload_size;
+
+    const uint32_t tag = (uintptr_t)record->tag;
+    const uint32_t format = (uintptr_t)record->format;
+    memcpy(&payload[0], &record->tick, sizeof(uint32_t));
+    payload[4] = record->level;
+    payload[5] = record->flags;
+    memcpy(&payload[6], &dropped, sizeof(uint16_t));
+    memcpy(&payload[8], &tag, sizeof(uint32_t));
+    memcpy(&payload[12], &format, sizeof(uint32_t));
+    memcpy(&payload[16], record->args, record->args_size);
+
+    uint8_t sum = 0;
+    for(size_t i = 0; i < payload_size; i++) {
+        sum += payload[i];
+    }
+    payload[payload_size] = sum;
+
+    return 2 + 1 + payload_size + 1;
+}
@@ -89,6 +89,17 @@ static void prvInsertBlockIntoFreeList(BlockLink_t* pxBlockToInsert);
  */
 static void prvHeapInit(void);
 
+/*
+ * Takes a block of xWantedSize bytes, header included, out of the list of
+ * free blocks.  Returns NULL if there is no block of adequate size.
+ */
+static BlockLink_t* prvHeapAllocateBlock(size_t xWantedSize);
+
+/*
+ * Returns an allocated block back into the list of free blocks.
+ */
+static void prvHeapFreeBlock(BlockLink_t* pxLink);
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -127,6 +138,47 @@ DICT_DEF2( //-V1048
 static MemmgrHeapThreadDict_t memmgr_heap_thread_dict = {0};
 static volatile uint32_t memmgr_heap_thread_trace_depth = 0;
 
+/* Small allocation pools
+ *
+ * Requests up to the biggest pool block size are served from slabs: heap
+ * blocks cut into equal blocks of one size class. Each pool block keeps a
+ * BlockLink_t header, so freeing and thread tracing work the same way as for
+ * the heap blocks. Header size field of a pool block holds the allocated bit,
+ * the pool bit and the offset of the block from its slab. Slabs are returned
+ * to the heap once empty, except for the last one with free blocks in a pool.
+ */
+#define MEMMGR_HEAP_POOL_BIT         ((size_t)1 << ((sizeof(size_t) * heapBITS_PER_BYTE) - 2))
+#define MEMMGR_HEAP_POOL_OFFSET_MASK ((size_t)0xFFFF)
+
+typedef struct MemmgrHeapSlab {
+    struct MemmgrHeapSlab* next;
+    struct MemmgrHeapSlab* prev;
+    BlockLink_t* free_blocks;
+    uint16_t used;
+    uint16_t pool;
+} MemmgrHeapSlab;
+
+typedef struct {
+    const size_t block_size;
+    const size_t blocks_per_slab;
+    /* Slabs with free blocks */
+    MemmgrHeapSlab* slabs;
+    size_t slab_count;
+    size_t used_blocks;
+    size_t peak_used_blocks;
+    size_t alloc_count;
+} MemmgrHeapPool;
+
+static MemmgrHeapPool memmgr_heap_pools[] = {
+    {.block_size = 16, .blocks_per_slab = 16},
+    {.block_size = 32, .blocks_per_slab = 12},
+    {.block_size = 64, .blocks_per_slab = 8},
+    {.block_size = 128, .blocks_per_slab = 6},
+};
+
+/* Bytes in free pool blocks, headers included, counted as free heap */
+static size_t memmgr_heap_pool_free_bytes = 0;
+
 /* Initialize tracing storage on start */
 void memmgr_heap_init(void) {
     MemmgrHeapThreadDict_init(memmgr_heap_thread_dict);
@@ -219,6 +271,171 @@ static inline void traceFREE(void* pointer, size_t size) {
     }
 }
 
+static inline size_t memmgr_heap_pool_block_full_size(const MemmgrHeapPool* pool) {
+    return pool->block_size + xHeapStructSize;
+}
+
+static void memmgr_heap_update_minimum_ever_free(void) {
+    size_t free_bytes = xFreeBytesRemaining + memmgr_heap_pool_free_bytes;
+    if(free_bytes < xMinimumEverFreeBytesRemaining) {
+        xMinimumEverFreeBytesRemaining = free_bytes;
+    }
+}
+
+static inline void memmgr_heap_pool_link_slab(MemmgrHeapPool* pool, MemmgrHeapSlab* slab) {
+    slab->prev = NULL;
+    slab->next = pool->slabs;
+    if(pool->slabs) pool->slabs->prev = slab;
+    pool->slabs = slab;
+}
+
+static inline void memmgr_heap_pool_unlink_slab(MemmgrHeapPool* pool, MemmgrHeapSlab* slab) {
+    if(slab->prev) {
+        slab->prev->next = slab->next;
+    } else {
+        pool->slabs = slab->next;
+    }
+    if(slab->next) slab->next->prev = slab->prev;
+    slab->next = NULL;
+    slab->prev = NULL;
+}
+
+static MemmgrHeapSlab* memmgr_heap_pool_add_slab(MemmgrHeapPool* pool, uint16_t pool_index) {
+    const size_t block_full_size = memmgr_heap_pool_block_full_size(pool);
+    size_t slab_size = xHeapStructSize + sizeof(MemmgrHeapSlab) +
+                       block_full_size * pool->blocks_per_slab;
+    slab_size = (slab_size + portBYTE_ALIGNMENT_MASK) & ~((size_t)portBYTE_ALIGNMENT_MASK);
+
+    BlockLink_t* pxBlock = prvHeapAllocateBlock(slab_size);
+    if(pxBlock == NULL) return NULL;
+
+    MemmgrHeapSlab* slab = (void*)(((uint8_t*)pxBlock) + xHeapStructSize);
+    slab->used = 0;
+    slab->pool = pool_index;
+    slab->free_blocks = NULL;
+
+    /* Blocks follow the slab header, the first one ends up on top of the list */
+    uint8_t* block = ((uint8_t*)slab) + sizeof(MemmgrHeapSlab);
+    block += block_full_size * pool->blocks_per_slab;
+    for(size_t i = 0; i < pool->blocks_per_slab; i++) {
+        block -= block_full_size;
+        BlockLink_t* pxLink = (void*)block;
+        pxLink->xBlockSize = MEMMGR_HEAP_POOL_BIT | (size_t)(block - (uint8_t*)slab);
+        pxLink->pxNextFreeBlock = slab->free_blocks;
+        slab->free_blocks = pxLink;
+    }
+
+    /* Whole slab, overhead included, is still free memory */
+    pool->slab_count++;
+    memmgr_heap_pool_free_bytes += pxBlock->xBlockSize & ~xBlockAllocatedBit;
+    memmgr_heap_pool_link_slab(pool, slab);
+
+    return slab;
+}
+
+static void memmgr_heap_pool_remove_slab(MemmgrHeapPool* pool, MemmgrHeapSlab* slab) {
+    BlockLink_t* pxBlock = (void*)(((uint8_t*)slab) - xHeapStructSize);
+
+    memmgr_heap_pool_unlink_slab(pool, slab);
+    pool->slab_count--;
+    memmgr_heap_pool_free_bytes -= pxBlock->xBlockSize & ~xBlockAllocatedBit;
+    prvHeapFreeBlock(pxBlock);
+}
+
+/* Must be called with scheduler suspended. Returns NULL if the size is not
+ * served by pools or there is no memory for a new slab, otherwise updates
+ * size to the size of the block with its header. */
+static void* memmgr_heap_pool_alloc(size_t* size) {
+    if(*size == 0) return NULL;
+
+    uint16_t pool_index = 0;
+    while(pool_index < COUNT_OF(memmgr_heap_pools) &&
+          memmgr_heap_pools[pool_index].block_size < *size) {
+        pool_index++;
+    }
+    if(pool_index == COUNT_OF(memmgr_heap_pools)) return NULL;
+
+    MemmgrHeapPool* pool = &memmgr_heap_pools[pool_index];
+    MemmgrHeapSlab* slab = pool->slabs;
+    if(slab == NULL) {
+        slab = memmgr_heap_pool_add_slab(pool, pool_index);
+        if(slab == NULL) return NULL;
+    }
+
+    BlockLink_t* pxLink = slab->free_blocks;
+    slab->free_blocks = pxLink->pxNextFreeBlock;
+    slab->used++;
+    if(slab->free_blocks == NULL) {
+        memmgr_heap_pool_unlink_slab(pool, slab);
+    }
+
+    pxLink->xBlockSize |= xBlockAllocatedBit;
+    pxLink->pxNextFreeBlock = NULL;
+
+    pool->used_blocks++;
+    pool->alloc_count++;
+    if(pool->used_blocks > pool->peak_used_blocks) {
+        pool->peak_used_blocks = pool->used_blocks;
+    }
+    *size = memmgr_heap_pool_block_full_size(pool);
+    memmgr_heap_pool_free_bytes -= *size;
+    memmgr_heap_update_minimum_ever_free();
+
+    return ((uint8_t*)pxLink) + xHeapStructSize;
+}
+
+/* Must be called with scheduler suspended, allocated bit already cleared */
+static void memmgr_heap_pool_free(BlockLink_t* pxLink, void* pv) {
+    const size_t offset = pxLink->xBlockSize & MEMMGR_HEAP_POOL_OFFSET_MASK;
+    MemmgrHeapSlab* slab = (void*)(((uint8_t*)pxLink) - offset);
+    furi_check(slab->pool < COUNT_OF(memmgr_heap_pools));
+    furi_check(slab->used > 0);
+
+    MemmgrHeapPool* pool = &memmgr_heap_pools[slab->pool];
+    furi_assert(pool->used_blocks > 0);
+
+    traceFREE(pv, memmgr_heap_pool_block_full_size(pool));
+    memset(pv, 0, pool->block_size);
+
+    const bool was_full = (slab->free_blocks == NULL);
+    pxLink->pxNextFreeBlock = slab->free_blocks;
+    slab->free_blocks = pxLink;
+    slab->used--;
+
+    pool->used_blocks--;
+    memmgr_heap_pool_free_bytes += memmgr_heap_pool_block_full_size(pool);
+
+    if(was_full) {
+        memmgr_heap_pool_link_slab(pool, slab);
+    }
+
+    /* Keep the only slab with free blocks to avoid slab churn */
+    if(slab->used == 0 && (slab->prev || slab->next)) {
+        memmgr_heap_pool_remove_slab(pool, slab);
+    }
+}
+
+size_t memmgr_heap_get_pool_count(void) {
+    return COUNT_OF(memmgr_heap_pools);
+}
+
+void memmgr_heap_get_pool_stats(size_t index, MemmgrHeapPoolStats* stats) {
+    furi_check(index < COUNT_OF(memmgr_heap_pools));
+    furi_check(stats);
+
+    vTaskSuspendAll();
+    {
+        const MemmgrHeapPool* pool = &memmgr_heap_pools[index];
+        stats->block_size = pool->block_size;
+        stats->slab_count = pool->slab_count;
+        stats->block_count = pool->slab_count * pool->blocks_per_slab;
+        stats->used_block_count = pool->used_blocks;
+        stats->peak_used_block_count = pool->peak_used_blocks;
+        stats->alloc_count = pool->alloc_count;
+    }
+    (void)xTaskResumeAll();
+}
+
 size_t memmgr_heap_get_max_free_block(void) {
     size_t max_free_size = 0;
     BlockLink_t* pxBlock;
@@ -337,7 +554,7 @@ static void print_heap_free(void* ptr) {
 /*-----------------------------------------------------------*/
 
 void* pvPortMalloc(size_t xWantedSize) {
-    BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
+    BlockLink_t* pxBlock;
     void* pvReturn = NULL;
     size_t to_wipe = xWantedSize;
 
@@ -373,6 +590,13 @@ void* pvPortMalloc(size_t xWantedSize) {
         is used to determine who owns the block - the application or the
         kernel, so it must be free. */
         if((xWantedSize & xBlockAllocatedBit) == 0) {
+            /* Small requests are served by pools, heap is a fallback. */
+            pvReturn = memmgr_heap_pool_alloc(&xWantedSize);
+        } else {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if((pvReturn == NULL) && ((xWantedSize & xBlockAllocatedBit) == 0)) {
             /* The wanted size is increased so it can contain a BlockLink_t
             structure in addition to the requested amount of bytes. */
             if(xWantedSize > 0) {
@@ -391,68 +615,15 @@ void* pvPortMalloc(size_t xWantedSize) {
                 mtCOVERAGE_TEST_MARKER();
             }
 
-            if((xWantedSize > 0) && (xWantedSize <= xFreeBytesRemaining)) {
-                /* Traverse the list from the start (lowest address) block until
-                one of adequate size is found. */
-                pxPreviousBlock = &xStart;
-                pxBlock = xStart.pxNextFreeBlock;
-                while((pxBlock->xBlockSize < xWantedSize) && (pxBlock->pxNextFreeBlock != NULL)) {
-                    pxPreviousBlock = pxBlock;
-                    pxBlock = pxBlock->pxNextFreeBlock;
-                }
-
-                /* If the end marker was reached then a block of adequate size
-                was not found. */
-                if(pxBlock != pxEnd) {
-                    /* Return the memory space pointed to - jumping over the
-                    BlockLink_t structure at its start. */
-                    pvReturn =
-                        (void*)(((uint8_t*)pxPreviousBlock->pxNextFreeBlock) + xHeapStructSize);
-
-                    /* This block is being returned for use so must be taken out
-                    of the list of free blocks. */
-                    pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
-
-                    /* If the block is larger than required it can be split into
-                    two. */
-                    if((pxBlock->xBlockSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE) {
-                        /* This block is to be split into two.  Create a new
-                        block following the number of bytes requested. The void
-                        cast is used to prevent byte alignment warnings from the
-                        compiler. */
-                        pxNewBlockLink = (void*)(((uint8_t*)pxBlock) + xWantedSize);
-                        configASSERT((((size_t)pxNewBlockLink) & portBYTE_ALIGNMENT_MASK) == 0);
-
-                        /* Calculate the sizes of two blocks split from the
-                        single block. */
-                        pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
-                        pxBlock->xBlockSize = xWantedSize;
-
-                        /* Insert the new block into the list of free blocks. */
-                        prvInsertBlockIntoFreeList(pxNewBlockLink);
-                    } else {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-
-                    xFreeBytesRemaining -= pxBlock->xBlockSize;
-
-                    if(xFreeBytesRemaining < xMinimumEverFreeBytesRemaining) {
-                        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
-                    } else {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-
-                    /* The block is being returned - it is allocated and owned
-                    by the application and has no "next" block. */
-                    pxBlock->xBlockSize |= xBlockAllocatedBit;
-                    pxBlock->pxNextFreeBlock = NULL;
+            pxBlock = prvHeapAllocateBlock(xWantedSize);
+            if(pxBlock != NULL) {
+                /* Return the memory space pointed to - jumping over the
+                BlockLink_t structure at its start. */
+                pvReturn = (void*)(((uint8_t*)pxBlock) + xHeapStructSize);
 
 #ifdef HEAP_PRINT_DEBUG
-                    print_heap_block = pxBlock;
+                print_heap_block = pxBlock;
 #endif
-                } else {
-                    mtCOVERAGE_TEST_MARKER();
-                }
             } else {
                 mtCOVERAGE_TEST_MARKER();
             }
@@ -465,7 +636,7 @@ void* pvPortMalloc(size_t xWantedSize) {
     (void)xTaskResumeAll();
 
 #ifdef HEAP_PRINT_DEBUG
-    print_heap_malloc(print_heap_block, print_heap_block->xBlockSize & ~xBlockAllocatedBit);
+    print_heap_malloc(print_heap_block ? (void*)print_heap_block : pvReturn, xWantedSize);
 #endif
 
 #if(configUSE_MALLOC_FAILED_HOOK == 1)
@@ -521,14 +692,19 @@ void vPortFree(void* pv) {
                 {
                     furi_assert((size_t)pv >= SRAM_BASE);
                     furi_assert((size_t)pv < SRAM_BASE + 1024 * 256);
-                    furi_assert(pxLink->xBlockSize >= xHeapStructSize);
-                    furi_assert((pxLink->xBlockSize - xHeapStructSize) < 1024 * 256);
-
-                    /* Add this block to the list of free blocks. */
-                    xFreeBytesRemaining += pxLink->xBlockSize;
-                    traceFREE(pv, pxLink->xBlockSize);
-                    memset(pv, 0, pxLink->xBlockSize - xHeapStructSize);
-                    prvInsertBlockIntoFreeList((BlockLink_t*)pxLink);
+
+                    if(pxLink->xBlockSize & MEMMGR_HEAP_POOL_BIT) {
+                        /* Pool block goes back to its slab. */
+                        memmgr_heap_pool_free(pxLink, pv);
+                    } else {
+                        furi_assert(pxLink->xBlockSize >= xHeapStructSize);
+                        furi_assert((pxLink->xBlockSize - xHeapStructSize) < 1024 * 256);
+
+                        /* Add this block to the list of free blocks. */
+                        traceFREE(pv, pxLink->xBlockSize);
+                        memset(pv, 0, pxLink->xBlockSize - xHeapStructSize);
+                        prvHeapFreeBlock(pxLink);
+                    }
                 }
                 (void)xTaskResumeAll();
             } else {
@@ -551,7 +727,7 @@ size_t xPortGetTotalHeapSize(void) {
 /*-----------------------------------------------------------*/
 
 size_t xPortGetFreeHeapSize(void) {
-    return xFreeBytesRemaining;
+    return xFreeBytesRemaining + memmgr_heap_pool_free_bytes;
 }
 /*-----------------------------------------------------------*/
 
@@ -611,6 +787,72 @@ static void prvHeapInit(void) {
 }
 /*-----------------------------------------------------------*/
 
+static BlockLink_t* prvHeapAllocateBlock(size_t xWantedSize) {
+    BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
+
+    if((xWantedSize == 0) || (xWantedSize > xFreeBytesRemaining)) {
+        return NULL;
+    }
+
+    /* Traverse the list from the start (lowest address) block until
+    one of adequate size is found. */
+    pxPreviousBlock = &xStart;
+    pxBlock = xStart.pxNextFreeBlock;
+    while((pxBlock->xBlockSize < xWantedSize) && (pxBlock->pxNextFreeBlock != NULL)) {
+        pxPreviousBlock = pxBlock;
+        pxBlock = pxBlock->pxNextFreeBlock;
+    }
+
+    /* If the end marker was reached then a block of adequate size
+    was not found. */
+    if(pxBlock == pxEnd) {
+        return NULL;
+    }
+
+    /* This block is being returned for use so must be taken out
+    of the list of free blocks. */
+    pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+
+    /* If the block is larger than required it can be split into
+    two. */
+    if((pxBlock->xBlockSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE) {
+        /* This block is to be split into two.  Create a new
+        block following the number of bytes requested. The void
+        cast is used to prevent byte alignment warnings from the
+        compiler. */
+        pxNewBlockLink = (void*)(((uint8_t*)pxBlock) + xWantedSize);
+        configASSERT((((size_t)pxNewBlockLink) & portBYTE_ALIGNMENT_MASK) == 0);
+
+        /* Calculate the sizes of two blocks split from the
+        single block. */
+        pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+        pxBlock->xBlockSize = xWantedSize;
+
+        /* Insert the new block into the list of free blocks. */
+        prvInsertBlockIntoFreeList(pxNewBlockLink);
+    } else {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    xFreeBytesRemaining -= pxBlock->xBlockSize;
+    memmgr_heap_update_minimum_ever_free();
+
+    /* The block is being returned - it is allocated and owned
+    by the application and has no "next" block. */
+    pxBlock->xBlockSize |= xBlockAllocatedBit;
+    pxBlock->pxNextFreeBlock = NULL;
+
+    return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapFreeBlock(BlockLink_t* pxLink) {
+    pxLink->xBlockSize &= ~xBlockAllocatedBit;
+    xFreeBytesRemaining += pxLink->xBlockSize;
+    prvInsertBlockIntoFreeList(pxLink);
+}
+/*-----------------------------------------------------------*/
+
 static void prvInsertBlockIntoFreeList(BlockLink_t* pxBlockToInsert) {
     BlockLink_t* pxIterator;
     uint8_t* puc;
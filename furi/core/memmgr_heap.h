@@ -14,6 +14,16 @@ extern "C" {
 
 #define MEMMGR_HEAP_UNKNOWN 0xFFFFFFFF
 
+/** Small allocation pool statistics */
+typedef struct {
+    size_t block_size; /**< biggest allocation served by the pool, bytes */
+    size_t slab_count; /**< slabs taken from the heap right now */
+    size_t block_count; /**< blocks in all slabs */
+    size_t used_block_count; /**< blocks allocated right now */
+    size_t peak_used_block_count; /**< max blocks allocated at once */
+    size_t alloc_count; /**< allocations served since boot */
+} MemmgrHeapPoolStats;
+
 /** Memmgr heap enable thread allocation tracking
  *
  * @param      thread_id  - thread id to track
@@ -44,6 +54,19 @@ size_t memmgr_heap_get_max_free_block(void);
  */
 void memmgr_heap_printf_free_blocks(void);
 
+/** Memmgr heap get the number of small allocation pools
+ *
+ * @return     pool count
+ */
+size_t memmgr_heap_get_pool_count(void);
+
+/** Memmgr heap get small allocation pool statistics
+ *
+ * @param      index  - pool index, less than memmgr_heap_get_pool_count()
+ * @param      stats  - pointer to stats structure to fill
+ */
+void memmgr_heap_get_pool_stats(size_t index, MemmgrHeapPoolStats* stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -55,6 +55,37 @@ static void address_cache_put(AddressCache_t cache, int symEntry, Elf32_Addr sym
     AddressCache_set_at(cache, symEntry, symAddr);
 }
 
+static ELFSection* elf_section_of(ELFFile* elf, int index);
+
+static void elf_link_cache_store(
+    ELFFile* elf,
+    ELFSection* s,
+    int type,
+    Elf32_Addr offset,
+    uint16_t symbol_section,
+    Elf32_Addr symAddr) {
+    if(!elf->link_cache) return;
+
+    ElfLinkCacheRecord record = {
+        .type = type,
+        .section = s->sec_idx,
+        .symbol_section = symbol_section,
+        .value = symAddr,
+    };
+
+    // Local symbols move with their section on every load
+    if(symbol_section != SHN_UNDEF) {
+        ELFSection* symSec = elf_section_of(elf, symbol_section);
+        if(!symSec) {
+            elf_link_cache_write_end(elf->link_cache, false);
+            return;
+        }
+        record.value -= (Elf32_Addr)symSec->data;
+    }
+
+    elf_link_cache_write(elf->link_cache, &record, offset);
+}
+
 /**************************************************************************************************/
 /********************************************** ELF ***********************************************/
 /**************************************************************************************************/
@@ -405,6 +436,7 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
 
                 symAddr = elf_address_of(elf, &sym, furi_string_get_cstr(symbol_name));
                 address_cache_put(elf->relocation_cache, symEntry, symAddr);
+                address_cache_put(elf->symbol_section_cache, symEntry, sym.st_shndx);
             }
 
             if(symAddr != ELF_INVALID_ADDRESS) {
@@ -416,6 +448,10 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
                 if(!elf_relocate_symbol(elf, relAddr, relType, symAddr)) {
                     relocate_result = false;
                 }
+
+                Elf32_Addr symbol_section = SHN_UNDEF;
+                address_cache_get(elf->symbol_section_cache, symEntry, &symbol_section);
+                elf_link_cache_store(elf, s, relType, rel.r_offset, symbol_section, symAddr);
             } else {
                 FURI_LOG_E(TAG, "  No symbol address of %s", furi_string_get_cstr(symbol_name));
                 relocate_result = false;
@@ -448,9 +484,19 @@ static bool elf_load_debug_link(ELFFile* elf, Elf32_Shdr* section_header) {
     elf->debug_link_info.debug_link_size = section_header->sh_size;
     elf->debug_link_info.debug_link = malloc(section_header->sh_size);
 
-    return storage_file_seek(elf->fd, section_header->sh_offset, true) &&
-           storage_file_read(elf->fd, elf->debug_link_info.debug_link, section_header->sh_size) ==
-               section_header->sh_size;
+    if(!storage_file_seek(elf->fd, section_header->sh_offset, true) ||
+       storage_file_read(elf->fd, elf->debug_link_info.debug_link, section_header->sh_size) !=
+           section_header->sh_size) {
+        return false;
+    }
+
+    // Debug link holds CRC of the unstripped build
+    if(elf->link_cache) {
+        elf_link_cache_feed(
+            elf->link_cache, elf->debug_link_info.debug_link, section_header->sh_size);
+    }
+
+    return true;
 }
 
 static bool str_prefix(const char* str, const char* prefix) {
@@ -685,6 +731,14 @@ static bool elf_file_find_string_by_hash(ELFFile* elf, uint32_t hash, FuriString
     return result;
 }
 
+static void elf_free_fast_rel(ELFSection* s) {
+    if(s->fast_rel) {
+        aligned_free(s->fast_rel->data);
+        free(s->fast_rel);
+        s->fast_rel = NULL;
+    }
+}
+
 static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
     UNUSED(elf);
     const uint8_t* start = s->fast_rel->data;
@@ -708,6 +762,7 @@ static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
         uint32_t hash_or_section_index = *((uint32_t*)start);
         start += 4;
 
+        uint16_t symbol_section = SHN_UNDEF;
         uint32_t section_value = ELF_INVALID_ADDRESS;
         if(is_section) {
             section_value = *((uint32_t*)start);
@@ -729,6 +784,7 @@ static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
         Elf32_Addr address = 0;
         if(is_section) {
             ELFSection* symSec = elf_section_of(elf, hash_or_section_index);
+            symbol_section = hash_or_section_index;
             if(symSec) {
                 address = ((Elf32_Addr)symSec->data) + section_value;
             }
@@ -760,13 +816,12 @@ static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
                 start += 3;
                 Elf32_Addr relAddr = ((Elf32_Addr)s->data) + offset;
                 elf_relocate_symbol(elf, relAddr, type, address);
+                elf_link_cache_store(elf, s, type, offset, symbol_section, address);
             }
         }
     }
 
-    aligned_free(s->fast_rel->data);
-    free(s->fast_rel);
-    s->fast_rel = NULL;
+    elf_free_fast_rel(s);
 
     return no_errors;
 }
@@ -784,6 +839,57 @@ static bool elf_relocate_section(ELFFile* elf, ELFSection* section) {
     return true;
 }
 
+static bool elf_relocate_from_link_cache(ELFFile* elf) {
+    bool success = true;
+
+    // Direct index of loaded sections, records refer to them by number
+    ELFSection** sections = malloc(sizeof(ELFSection*) * elf->sections_count);
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
+        if(itref->value.sec_idx < elf->sections_count) {
+            sections[itref->value.sec_idx] = &itref->value;
+        }
+    }
+
+    ElfLinkCacheRecord record;
+    uint32_t offset;
+    while(elf_link_cache_read(elf->link_cache, &record, &offset)) {
+        ELFSection* section = record.section < elf->sections_count ? sections[record.section] :
+                                                                      NULL;
+        if(!section || !section->data || offset + sizeof(uint32_t) > section->size) {
+            success = false;
+            break;
+        }
+
+        Elf32_Addr symAddr = record.value;
+        if(record.symbol_section != SHN_UNDEF) {
+            ELFSection* symSec = record.symbol_section < elf->sections_count ?
+                                     sections[record.symbol_section] :
+                                     NULL;
+            if(!symSec) {
+                success = false;
+                break;
+            }
+            symAddr += (Elf32_Addr)symSec->data;
+        }
+
+        if(!elf_relocate_symbol(elf, (Elf32_Addr)section->data + offset, record.type, symAddr)) {
+            success = false;
+            break;
+        }
+    }
+
+    free(sections);
+
+    // Relocation tables are not needed anymore
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        elf_free_fast_rel(&ELFSectionDict_ref(it)->value);
+    }
+
+    return elf_link_cache_read_end(elf->link_cache) && success;
+}
+
 static void elf_file_call_section_list(ELFSection* section, bool reverse_order) {
     if(section && section->size) {
         const uint32_t* start = section->data;
@@ -813,6 +919,10 @@ ELFFile* elf_file_alloc(Storage* storage, const ElfApiInterface* api_interface)
     elf->api_interface = api_interface;
     ELFSectionDict_init(elf->sections);
     AddressCache_init(elf->trampoline_cache);
+    // Plugin host APIs move on every launch, only firmware imports are stable
+    if(elf_link_cache_is_supported(api_interface)) {
+        elf->link_cache = elf_link_cache_alloc(storage);
+    }
     elf->init_array_called = false;
     return elf;
 }
@@ -833,10 +943,7 @@ void elf_file_free(ELFFile* elf) {
             if(itref->value.data) {
                 aligned_free(itref->value.data);
             }
-            if(itref->value.fast_rel) {
-                aligned_free(itref->value.fast_rel->data);
-                free(itref->value.fast_rel);
-            }
+            elf_free_fast_rel(&itref->value);
             free((void*)itref->key);
         }
 
@@ -859,6 +966,10 @@ void elf_file_free(ELFFile* elf) {
         free(elf->debug_link_info.debug_link);
     }
 
+    if(elf->link_cache) {
+        elf_link_cache_free(elf->link_cache);
+    }
+
     elf_file_maybe_release_fd(elf);
     free(elf);
 }
@@ -875,6 +986,15 @@ bool elf_file_open(ELFFile* elf, const char* path) {
         return false;
     }
 
+    if(elf->link_cache) {
+        elf_link_cache_begin(
+            elf->link_cache,
+            path,
+            elf->api_interface->api_version_major,
+            elf->api_interface->api_version_minor);
+        elf_link_cache_feed(elf->link_cache, &h, sizeof(h));
+    }
+
     elf->entry = h.e_entry;
     elf->sections_count = h.e_shnum;
     elf->section_table = h.e_shoff;
@@ -898,6 +1018,10 @@ ElfLoadSectionTableResult elf_file_load_section_table(ELFFile* elf) {
             break;
         }
 
+        if(elf->link_cache) {
+            elf_link_cache_feed(elf->link_cache, &section_header, sizeof(section_header));
+        }
+
         FURI_LOG_D(
             TAG, "Preloading data for section #%d %s", section_idx, furi_string_get_cstr(name));
         SectionTypeInfo section_type_info =
@@ -976,13 +1100,33 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     ELFSectionDict_it_t it;
 
     AddressCache_init(elf->relocation_cache);
+    AddressCache_init(elf->symbol_section_cache);
+
+    bool linked = false;
+    if(elf->link_cache) {
+        if(elf_link_cache_read_begin(elf->link_cache)) {
+            FURI_LOG_D(TAG, "Relocating from link cache");
+            linked = true;
+            if(!elf_relocate_from_link_cache(elf)) {
+                // Sections are partially relocated at this point, only reload can help
+                FURI_LOG_E(TAG, "Broken link cache");
+                elf_link_cache_remove(elf->link_cache);
+                status = ELFFileLoadStatusUnspecifiedError;
+            }
+        } else {
+            elf_link_cache_write_begin(elf->link_cache);
+        }
+    }
 
-    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
-        ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
-        FURI_LOG_D(TAG, "Relocating section '%s'", itref->key);
-        if(!elf_relocate_section(elf, &itref->value)) {
-            FURI_LOG_E(TAG, "Error relocating section '%s'", itref->key);
-            status = ELFFileLoadStatusMissingImports;
+    if(!linked) {
+        for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it);
+            ELFSectionDict_next(it)) {
+            ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
+            FURI_LOG_D(TAG, "Relocating section '%s'", itref->key);
+            if(!elf_relocate_section(elf, &itref->value)) {
+                FURI_LOG_E(TAG, "Error relocating section '%s'", itref->key);
+                status = ELFFileLoadStatusMissingImports;
+            }
         }
     }
 
@@ -1001,6 +1145,13 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     FURI_LOG_D(TAG, "Relocation cache size: %u", AddressCache_size(elf->relocation_cache));
     FURI_LOG_D(TAG, "Trampoline cache size: %u", AddressCache_size(elf->trampoline_cache));
     AddressCache_clear(elf->relocation_cache);
+    AddressCache_clear(elf->symbol_section_cache);
+
+    if(elf->link_cache) {
+        elf_link_cache_write_end(elf->link_cache, status == ELFFileLoadStatusSuccess);
+        elf_link_cache_free(elf->link_cache);
+        elf->link_cache = NULL;
+    }
 
     {
         size_t total_size = 0;
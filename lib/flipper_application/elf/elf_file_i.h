@@ -1,5 +1,6 @@
 #pragma once
 #include "elf_file.h"
+#include "elf_link_cache.h"
 #include <m-dict.h>
 
 #ifdef __cplusplus
@@ -40,7 +41,9 @@ struct ELFFile {
     ELFSectionDict_t sections;
 
     AddressCache_t relocation_cache;
+    AddressCache_t symbol_section_cache;
     AddressCache_t trampoline_cache;
+    ElfLinkCache* link_cache;
 
     File* fd;
     const ElfApiInterface* api_interface;
@@ -0,0 +1,448 @@
+#include "elf_link_cache.h"
+
+#include <furi.h>
+#include <toolbox/stream/buffered_file_stream.h>
+
+#include <m-array.h>
+
+#define TAG "ElfLinkCache"
+
+#define ELF_LINK_CACHE_MAGIC        (0x4B4E4C46) // "FLNK"
+#define ELF_LINK_CACHE_VERSION      (3)
+#define ELF_LINK_CACHE_OFFSETS_MAX  (64)
+#define ELF_LINK_CACHE_OFFSET_SIZE  (3)
+#define ELF_LINK_CACHE_FAP_PATH_MAX (UINT8_MAX)
+#define ELF_LINK_CACHE_EXTENSION    ".lnk"
+
+#define ELF_LINK_CACHE_FNV_BASIS (0x811C9DC5)
+#define ELF_LINK_CACHE_FNV_PRIME (0x01000193)
+
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t api_version_major;
+    uint16_t api_version_minor;
+    uint32_t firmware_fingerprint;
+    uint32_t fap_fingerprint;
+    uint32_t records_count;
+} FURI_PACKED ElfLinkCacheHeader;
+
+typedef struct {
+    uint8_t type;
+    uint16_t section;
+    uint16_t symbol_section;
+    uint32_t value;
+    uint8_t offsets_count;
+} FURI_PACKED ElfLinkCacheRecordHeader;
+
+ARRAY_DEF(ElfLinkCachePathArray, FuriString*, FURI_STRING_OPLIST) // NOLINT
+#define M_OPL_ElfLinkCachePathArray_t() ARRAY_OPLIST(ElfLinkCachePathArray, FURI_STRING_OPLIST)
+
+struct ElfLinkCache {
+    Storage* storage;
+    Stream* stream;
+    FuriString* path;
+    FuriString* fap_path;
+    ElfLinkCacheHeader header;
+
+    bool identified;
+    bool disabled;
+    bool writing;
+    bool error;
+    uint32_t records_left;
+
+    // Record being read or written, relocations sharing a target are grouped
+    ElfLinkCacheRecord record;
+    uint32_t offsets[ELF_LINK_CACHE_OFFSETS_MAX];
+    size_t offsets_count;
+    size_t offsets_position;
+};
+
+// Interface whose imports can be cached, set once by the loader
+static const ElfApiInterface* elf_link_cache_api_interface = NULL;
+static uint32_t elf_link_cache_api_fingerprint = 0;
+// Stale entries are removed by the first cache write after boot
+static bool elf_link_cache_pruned = false;
+
+static uint32_t elf_link_cache_hash(uint32_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = data;
+    for(size_t i = 0; i < size; i++) {
+        hash = (hash ^ bytes[i]) * ELF_LINK_CACHE_FNV_PRIME;
+    }
+    return hash;
+}
+
+void elf_link_cache_set_api(const ElfApiInterface* api_interface, uint32_t fingerprint) {
+    furi_check(api_interface);
+    elf_link_cache_api_interface = api_interface;
+    elf_link_cache_api_fingerprint = fingerprint;
+}
+
+bool elf_link_cache_is_supported(const ElfApiInterface* api_interface) {
+    return api_interface && api_interface == elf_link_cache_api_interface;
+}
+
+ElfLinkCache* elf_link_cache_alloc(Storage* storage) {
+    ElfLinkCache* cache = malloc(sizeof(ElfLinkCache));
+    cache->storage = storage;
+    cache->stream = buffered_file_stream_alloc(storage);
+    cache->path = furi_string_alloc();
+    cache->fap_path = furi_string_alloc();
+    return cache;
+}
+
+void elf_link_cache_free(ElfLinkCache* cache) {
+    furi_assert(cache);
+    if(cache->writing) {
+        elf_link_cache_write_end(cache, false);
+    }
+    furi_string_free(cache->path);
+    furi_string_free(cache->fap_path);
+    stream_free(cache->stream);
+    free(cache);
+}
+
+void elf_link_cache_begin(
+    ElfLinkCache* cache,
+    const char* path,
+    uint16_t api_version_major,
+    uint16_t api_version_minor) {
+    furi_assert(cache);
+    furi_assert(path);
+
+    const uint32_t path_hash = elf_link_cache_hash(ELF_LINK_CACHE_FNV_BASIS, path, strlen(path));
+    furi_string_printf(
+        cache->path, "%s/%08lX" ELF_LINK_CACHE_EXTENSION, ELF_LINK_CACHE_PATH, path_hash);
+
+    cache->header = (ElfLinkCacheHeader){
+        .magic = ELF_LINK_CACHE_MAGIC,
+        .version = ELF_LINK_CACHE_VERSION,
+        .api_version_major = api_version_major,
+        .api_version_minor = api_version_minor,
+        .fap_fingerprint = ELF_LINK_CACHE_FNV_BASIS,
+    };
+    furi_string_set(cache->fap_path, path);
+    cache->identified = false;
+    cache->disabled = furi_string_size(cache->fap_path) > ELF_LINK_CACHE_FAP_PATH_MAX;
+}
+
+void elf_link_cache_feed(ElfLinkCache* cache, const void* data, size_t size) {
+    furi_assert(cache);
+    cache->header.fap_fingerprint = elf_link_cache_hash(cache->header.fap_fingerprint, data, size);
+}
+
+// Done only when the cache is actually used, not for every manifest preload
+static bool elf_link_cache_identify(ElfLinkCache* cache) {
+    if(cache->identified || cache->disabled) return !cache->disabled;
+    cache->identified = true;
+
+    cache->header.firmware_fingerprint = elf_link_cache_api_fingerprint;
+
+    // Digest is cached by the storage service against file size and modification time
+    uint8_t md5[16];
+    const FS_Error error =
+        storage_common_md5(cache->storage, furi_string_get_cstr(cache->fap_path), md5);
+    if(error != FSE_OK) {
+        // Without the digest a changed FAP could be linked with stale relocations
+        FURI_LOG_W(
+            TAG,
+            "No digest of %s: %s",
+            furi_string_get_cstr(cache->fap_path),
+            filesystem_api_error_get_desc(error));
+        cache->disabled = true;
+        return false;
+    }
+
+    elf_link_cache_feed(cache, md5, sizeof(md5));
+    return true;
+}
+
+// FAP path follows the header, it tells which FAP an entry belongs to when pruning
+static bool elf_link_cache_read_fap_path(Stream* stream, FuriString* fap_path) {
+    uint8_t size;
+    char path[ELF_LINK_CACHE_FAP_PATH_MAX + 1];
+    if(stream_read(stream, &size, sizeof(size)) != sizeof(size) ||
+       stream_read(stream, (uint8_t*)path, size) != size) {
+        return false;
+    }
+    path[size] = '\0';
+    furi_string_set(fap_path, path);
+    return true;
+}
+
+static bool elf_link_cache_write_fap_path(Stream* stream, FuriString* fap_path) {
+    const uint8_t size = furi_string_size(fap_path);
+    return stream_write(stream, &size, sizeof(size)) == sizeof(size) &&
+           stream_write(stream, (const uint8_t*)furi_string_get_cstr(fap_path), size) == size;
+}
+
+static bool elf_link_cache_entry_is_live(Storage* storage, Stream* stream, const char* path) {
+    ElfLinkCacheHeader header;
+    FuriString* fap_path = furi_string_alloc();
+    bool live = false;
+
+    if(buffered_file_stream_open(stream, path, FSAM_READ, FSOM_OPEN_EXISTING) &&
+       stream_read(stream, (uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+       elf_link_cache_read_fap_path(stream, fap_path)) {
+        live = header.magic == ELF_LINK_CACHE_MAGIC && header.version == ELF_LINK_CACHE_VERSION &&
+               header.firmware_fingerprint == elf_link_cache_api_fingerprint &&
+               storage_file_exists(storage, furi_string_get_cstr(fap_path));
+    }
+
+    buffered_file_stream_close(stream);
+    furi_string_free(fap_path);
+    return live;
+}
+
+void elf_link_cache_prune(Storage* storage) {
+    furi_check(storage);
+
+    File* dir = storage_file_alloc(storage);
+    Stream* stream = buffered_file_stream_alloc(storage);
+    FuriString* path = furi_string_alloc();
+    ElfLinkCachePathArray_t stale;
+    ElfLinkCachePathArray_init(stale);
+
+    // Entries of removed FAPs, other firmware builds and interrupted writes
+    if(storage_dir_open(dir, ELF_LINK_CACHE_PATH)) {
+        FileInfo info;
+        char name[32];
+        while(storage_dir_read(dir, &info, name, sizeof(name))) {
+            furi_string_printf(path, "%s/%s", ELF_LINK_CACHE_PATH, name);
+            if(file_info_is_dir(&info) ||
+               !furi_string_end_with_str(path, ELF_LINK_CACHE_EXTENSION)) {
+                continue;
+            }
+            if(!elf_link_cache_entry_is_live(storage, stream, furi_string_get_cstr(path))) {
+                ElfLinkCachePathArray_push_back(stale, path);
+            }
+        }
+    }
+    storage_dir_close(dir);
+
+    // Removed after the listing, the folder is not modified while it is read
+    for
+        M_EACH(stale_path, stale, ElfLinkCachePathArray_t) {
+            storage_simply_remove(storage, furi_string_get_cstr(*stale_path));
+        }
+    FURI_LOG_D(TAG, "Pruned %zu entries", ElfLinkCachePathArray_size(stale));
+
+    ElfLinkCachePathArray_clear(stale);
+    furi_string_free(path);
+    stream_free(stream);
+    storage_file_free(dir);
+}
+
+bool elf_link_cache_read_begin(ElfLinkCache* cache) {
+    furi_assert(cache);
+    furi_assert(!cache->writing);
+    if(!elf_link_cache_identify(cache)) return false;
+
+    FuriString* fap_path = furi_string_alloc();
+    bool valid = false;
+    do {
+        if(!buffered_file_stream_open(
+               cache->stream, furi_string_get_cstr(cache->path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+            break;
+        }
+
+        ElfLinkCacheHeader header;
+        if(stream_read(cache->stream, (uint8_t*)&header, sizeof(header)) != sizeof(header)) {
+            break;
+        }
+
+        cache->header.records_count = header.records_count;
+        if(memcmp(&header, &cache->header, sizeof(header)) != 0) {
+            FURI_LOG_D(TAG, "Stale cache %s", furi_string_get_cstr(cache->path));
+            break;
+        }
+
+        // Entry of another FAP whose path has the same hash
+        if(!elf_link_cache_read_fap_path(cache->stream, fap_path) ||
+           !furi_string_equal(fap_path, cache->fap_path)) {
+            break;
+        }
+
+        cache->records_left = header.records_count;
+        cache->offsets_count = 0;
+        cache->offsets_position = 0;
+        cache->error = false;
+        valid = true;
+    } while(false);
+
+    if(!valid) {
+        buffered_file_stream_close(cache->stream);
+    }
+    furi_string_free(fap_path);
+
+    return valid;
+}
+
+static bool elf_link_cache_read_record(ElfLinkCache* cache) {
+    ElfLinkCacheRecordHeader header;
+    uint8_t offsets[ELF_LINK_CACHE_OFFSETS_MAX * ELF_LINK_CACHE_OFFSET_SIZE];
+
+    if(stream_read(cache->stream, (uint8_t*)&header, sizeof(header)) != sizeof(header)) {
+        return false;
+    }
+    if(header.offsets_count == 0 || header.offsets_count > ELF_LINK_CACHE_OFFSETS_MAX) {
+        return false;
+    }
+
+    const size_t offsets_size = header.offsets_count * ELF_LINK_CACHE_OFFSET_SIZE;
+    if(stream_read(cache->stream, offsets, offsets_size) != offsets_size) {
+        return false;
+    }
+
+    for(size_t i = 0; i < header.offsets_count; i++) {
+        const uint8_t* offset = &offsets[i * ELF_LINK_CACHE_OFFSET_SIZE];
+        cache->offsets[i] = offset[0] | (offset[1] << 8) | (offset[2] << 16);
+    }
+
+    cache->record.type = header.type;
+    cache->record.section = header.section;
+    cache->record.symbol_section = header.symbol_section;
+    cache->record.value = header.value;
+    cache->offsets_count = header.offsets_count;
+    cache->offsets_position = 0;
+    cache->records_left--;
+    return true;
+}
+
+bool elf_link_cache_read(ElfLinkCache* cache, ElfLinkCacheRecord* record, uint32_t* offset) {
+    furi_assert(cache);
+
+    if(cache->offsets_position == cache->offsets_count) {
+        if(cache->error || cache->records_left == 0) return false;
+        if(!elf_link_cache_read_record(cache)) {
+            cache->error = true;
+            return false;
+        }
+    }
+
+    *record = cache->record;
+    *offset = cache->offsets[cache->offsets_position++];
+    return true;
+}
+
+bool elf_link_cache_read_end(ElfLinkCache* cache) {
+    furi_assert(cache);
+    buffered_file_stream_close(cache->stream);
+    return !cache->error && cache->records_left == 0 &&
+           cache->offsets_position == cache->offsets_count;
+}
+
+bool elf_link_cache_write_begin(ElfLinkCache* cache) {
+    furi_assert(cache);
+    furi_assert(!cache->writing);
+    if(!elf_link_cache_identify(cache)) return false;
+
+    storage_simply_mkdir(cache->storage, EXT_PATH("apps_data"));
+    storage_simply_mkdir(cache->storage, ELF_LINK_CACHE_PATH);
+
+    if(!elf_link_cache_pruned) {
+        elf_link_cache_pruned = true;
+        elf_link_cache_prune(cache->storage);
+    }
+
+    // Header stays invalid until the cache is committed
+    ElfLinkCacheHeader header = {0};
+    if(!buffered_file_stream_open(
+           cache->stream, furi_string_get_cstr(cache->path), FSAM_WRITE, FSOM_CREATE_ALWAYS) ||
+       stream_write(cache->stream, (uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+       !elf_link_cache_write_fap_path(cache->stream, cache->fap_path)) {
+        buffered_file_stream_close(cache->stream);
+        return false;
+    }
+
+    cache->header.records_count = 0;
+    cache->offsets_count = 0;
+    cache->error = false;
+    cache->writing = true;
+    return true;
+}
+
+static void elf_link_cache_flush_record(ElfLinkCache* cache) {
+    if(cache->offsets_count == 0) return;
+
+    const ElfLinkCacheRecordHeader header = {
+        .type = cache->record.type,
+        .section = cache->record.section,
+        .symbol_section = cache->record.symbol_section,
+        .value = cache->record.value,
+        .offsets_count = cache->offsets_count,
+    };
+    uint8_t offsets[ELF_LINK_CACHE_OFFSETS_MAX * ELF_LINK_CACHE_OFFSET_SIZE];
+    for(size_t i = 0; i < cache->offsets_count; i++) {
+        uint8_t* offset = &offsets[i * ELF_LINK_CACHE_OFFSET_SIZE];
+        offset[0] = cache->offsets[i] & 0xFF;
+        offset[1] = (cache->offsets[i] >> 8) & 0xFF;
+        offset[2] = (cache->offsets[i] >> 16) & 0xFF;
+    }
+
+    const size_t offsets_size = cache->offsets_count * ELF_LINK_CACHE_OFFSET_SIZE;
+    if(stream_write(cache->stream, (const uint8_t*)&header, sizeof(header)) != sizeof(header) ||
+       stream_write(cache->stream, offsets, offsets_size) != offsets_size) {
+        cache->error = true;
+    }
+
+    cache->header.records_count++;
+    cache->offsets_count = 0;
+}
+
+void elf_link_cache_write(ElfLinkCache* cache, const ElfLinkCacheRecord* record, uint32_t offset) {
+    furi_assert(cache);
+    if(!cache->writing || cache->error) return;
+
+    // Offsets are stored in 24 bits, same as fast relocations
+    if(offset > 0xFFFFFF) {
+        cache->error = true;
+        return;
+    }
+
+    const bool same_target = cache->record.type == record->type &&
+                             cache->record.section == record->section &&
+                             cache->record.symbol_section == record->symbol_section &&
+                             cache->record.value == record->value;
+    if(!same_target || cache->offsets_count == ELF_LINK_CACHE_OFFSETS_MAX) {
+        elf_link_cache_flush_record(cache);
+        cache->record = *record;
+    }
+
+    cache->offsets[cache->offsets_count++] = offset;
+}
+
+void elf_link_cache_write_end(ElfLinkCache* cache, bool commit) {
+    furi_assert(cache);
+    if(!cache->writing) return;
+    cache->writing = false;
+
+    if(commit && !cache->error) {
+        elf_link_cache_flush_record(cache);
+    }
+
+    if(commit && !cache->error && stream_rewind(cache->stream) &&
+       stream_write(cache->stream, (uint8_t*)&cache->header, sizeof(cache->header)) ==
+           sizeof(cache->header)) {
+        buffered_file_stream_close(cache->stream);
+        FURI_LOG_I(
+            TAG,
+            "Stored %lu records to %s",
+            cache->header.records_count,
+            furi_string_get_cstr(cache->path));
+    } else {
+        buffered_file_stream_close(cache->stream);
+        elf_link_cache_remove(cache);
+    }
+}
+
+const char* elf_link_cache_get_path(ElfLinkCache* cache) {
+    furi_assert(cache);
+    return furi_string_get_cstr(cache->path);
+}
+
+void elf_link_cache_remove(ElfLinkCache* cache) {
+    furi_assert(cache);
+    storage_simply_remove(cache->storage, furi_string_get_cstr(cache->path));
+}
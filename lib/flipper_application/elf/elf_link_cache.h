@@ -0,0 +1,150 @@
+/**
+ * @file elf_link_cache.h
+ * Persistent cache of resolved relocations for FAP loading
+ *
+ * After the first successful load every applied relocation is stored with its
+ * target already resolved: an absolute address for imported symbols or
+ * a section index and offset for local ones. Subsequent loads apply the cache
+ * in one pass without reading symbols or resolving names.
+ *
+ * Cache file is keyed by FAP identity (headers, debug link and file MD5),
+ * firmware API version and firmware API fingerprint, so it is rebuilt when
+ * either the application or the firmware changes. Entries of removed FAPs and
+ * other firmware builds are pruned by the first cache write after boot.
+ */
+#pragma once
+#include "elf_api_interface.h"
+#include <storage/storage.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ELF_LINK_CACHE_PATH EXT_PATH("apps_data/.cache")
+
+typedef struct ElfLinkCache ElfLinkCache;
+
+typedef struct {
+    uint8_t type; /**< relocation type */
+    uint16_t section; /**< index of the relocated section */
+    uint16_t symbol_section; /**< index of the symbol section, 0 for imports */
+    uint32_t value; /**< import address or offset in the symbol section */
+} ElfLinkCacheRecord;
+
+/**
+ * @brief Set API interface whose imports can be cached
+ * Caching is disabled until it is set. Fingerprint must change whenever any
+ * address resolved by the interface changes.
+ * @param api_interface API interface, usually the firmware one
+ * @param fingerprint API fingerprint
+ */
+void elf_link_cache_set_api(const ElfApiInterface* api_interface, uint32_t fingerprint);
+
+/**
+ * @brief Check if imports of an API interface can be cached
+ * @param api_interface API interface
+ * @return true if the interface was set with elf_link_cache_set_api
+ */
+bool elf_link_cache_is_supported(const ElfApiInterface* api_interface);
+
+/**
+ * @brief Allocate ElfLinkCache instance
+ * @param storage Storage instance
+ * @return ElfLinkCache*
+ */
+ElfLinkCache* elf_link_cache_alloc(Storage* storage);
+
+/**
+ * @brief Free ElfLinkCache instance
+ * @param cache
+ */
+void elf_link_cache_free(ElfLinkCache* cache);
+
+/**
+ * @brief Start identifying a FAP
+ * @param cache
+ * @param path FAP path
+ * @param api_version_major API version the FAP is linked against
+ * @param api_version_minor API version the FAP is linked against
+ */
+void elf_link_cache_begin(
+    ElfLinkCache* cache,
+    const char* path,
+    uint16_t api_version_major,
+    uint16_t api_version_minor);
+
+/**
+ * @brief Add FAP data to its identity
+ * @param cache
+ * @param data
+ * @param size
+ */
+void elf_link_cache_feed(ElfLinkCache* cache, const void* data, size_t size);
+
+/**
+ * @brief Open cache for reading
+ * @param cache
+ * @return true if a valid cache for the FAP exists
+ */
+bool elf_link_cache_read_begin(ElfLinkCache* cache);
+
+/**
+ * @brief Read next relocation
+ * @param cache
+ * @param record relocation target
+ * @param offset relocation offset in the section
+ * @return true if a relocation was read, false at the end or on error
+ */
+bool elf_link_cache_read(ElfLinkCache* cache, ElfLinkCacheRecord* record, uint32_t* offset);
+
+/**
+ * @brief Close cache after reading
+ * @param cache
+ * @return true if all relocations were read
+ */
+bool elf_link_cache_read_end(ElfLinkCache* cache);
+
+/**
+ * @brief Open cache for writing
+ * @param cache
+ * @return true on success
+ */
+bool elf_link_cache_write_begin(ElfLinkCache* cache);
+
+/**
+ * @brief Store applied relocation, does nothing if writing is not started
+ * @param cache
+ * @param record relocation target
+ * @param offset relocation offset in the section
+ */
+void elf_link_cache_write(ElfLinkCache* cache, const ElfLinkCacheRecord* record, uint32_t offset);
+
+/**
+ * @brief Close cache after writing
+ * @param cache
+ * @param commit true to make the cache valid, false to drop it
+ */
+void elf_link_cache_write_end(ElfLinkCache* cache, bool commit);
+
+/**
+ * @brief Get cache file path of the FAP
+ * @param cache
+ * @return path, valid until the next elf_link_cache_begin
+ */
+const char* elf_link_cache_get_path(ElfLinkCache* cache);
+
+/**
+ * @brief Remove cache file of the FAP
+ * @param cache
+ */
+void elf_link_cache_remove(ElfLinkCache* cache);
+
+/**
+ * @brief Remove cache files of missing FAPs, other firmware and broken writes
+ * @param storage Storage instance
+ */
+void elf_link_cache_prune(Storage* storage);
+
+#ifdef __cplusplus
+}
+#endif
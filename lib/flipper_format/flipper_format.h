@@ -208,6 +208,22 @@ void flipper_format_free(FlipperFormat* flipper_format);
  */
 void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_mode);
 
+/** Enable key index.
+ *
+ * Index maps every key to its offset in the file and is built lazily on the
+ * first non-strict read, so reads seek directly to the key instead of
+ * rescanning the file. Results are the same as without the index. Index is
+ * dropped on every write, update, delete, open and close. Useful for files
+ * with many keys, like MIFARE Classic dumps.
+ *
+ * Index takes 8 bytes of RAM per key line in the file and is not limited, so
+ * it doesn't pay off for large files read sequentially, like RAW .sub files.
+ *
+ * @param      flipper_format  Pointer to a FlipperFormat instance
+ * @param      key_index       True enables the index. False by default.
+ */
+void flipper_format_set_key_index(FlipperFormat* flipper_format, bool key_index);
+
 /** Rewind the RW pointer.
  *
  * @param      flipper_format  Pointer to a FlipperFormat instance
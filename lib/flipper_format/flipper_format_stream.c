@@ -122,6 +122,157 @@ bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool str
     return found;
 }
 
+typedef struct {
+    uint32_t hash;
+    uint32_t offset;
+} FlipperStreamKeyIndexEntry;
+
+struct FlipperStreamKeyIndex {
+    FlipperStreamKeyIndexEntry* entries;
+    size_t count;
+    size_t capacity;
+    size_t stream_size;
+    bool built;
+};
+
+static uint32_t flipper_format_stream_key_hash(const char* key, size_t key_size) {
+    // FNV-1a
+    uint32_t hash = 2166136261UL;
+    for(size_t i = 0; i < key_size; i++) {
+        hash ^= (uint8_t)key[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+static int flipper_format_stream_key_index_entry_cmp(const void* a, const void* b) {
+    const FlipperStreamKeyIndexEntry* entry_a = a;
+    const FlipperStreamKeyIndexEntry* entry_b = b;
+    if(entry_a->hash != entry_b->hash) {
+        return (entry_a->hash > entry_b->hash) ? 1 : -1;
+    }
+    return (entry_a->offset > entry_b->offset) - (entry_a->offset < entry_b->offset);
+}
+
+FlipperStreamKeyIndex* flipper_format_stream_key_index_alloc(void) {
+    FlipperStreamKeyIndex* key_index = malloc(sizeof(FlipperStreamKeyIndex));
+    return key_index;
+}
+
+void flipper_format_stream_key_index_free(FlipperStreamKeyIndex* key_index) {
+    free(key_index->entries);
+    free(key_index);
+}
+
+void flipper_format_stream_key_index_reset(FlipperStreamKeyIndex* key_index) {
+    key_index->count = 0;
+    key_index->built = false;
+}
+
+static void
+    flipper_format_stream_key_index_build(FlipperStreamKeyIndex* key_index, Stream* stream) {
+    FuriString* read_key = furi_string_alloc();
+
+    key_index->count = 0;
+    stream_rewind(stream);
+
+    // Single pass over the stream with the same key parser as the linear search
+    while(!stream_eof(stream)) {
+        if(!flipper_format_stream_read_valid_key(stream, read_key)) continue;
+
+        if(key_index->count == key_index->capacity) {
+            key_index->capacity = key_index->capacity ? key_index->capacity * 2 : 16;
+            key_index->entries = realloc( //-V701
+                key_index->entries,
+                key_index->capacity * sizeof(FlipperStreamKeyIndexEntry));
+        }
+
+        // Stream is at the delimiter, key starts right before it
+        FlipperStreamKeyIndexEntry* entry = &key_index->entries[key_index->count++];
+        entry->hash = flipper_format_stream_key_hash(
+            furi_string_get_cstr(read_key), furi_string_size(read_key));
+        entry->offset = stream_tell(stream) - furi_string_size(read_key);
+    }
+
+    if(key_index->count) {
+        qsort(
+            key_index->entries,
+            key_index->count,
+            sizeof(FlipperStreamKeyIndexEntry),
+            flipper_format_stream_key_index_entry_cmp);
+    }
+
+    key_index->stream_size = stream_size(stream);
+    key_index->built = true;
+
+    furi_string_free(read_key);
+}
+
+static bool flipper_format_stream_key_index_check_key(
+    Stream* stream,
+    size_t offset,
+    const char* key,
+    size_t key_size) {
+    const size_t buffer_size = 32;
+    uint8_t buffer[buffer_size];
+
+    if(!stream_seek(stream, offset, StreamOffsetFromStart)) return false;
+
+    // Compare the key together with the delimiter, hash collisions are resolved here
+    size_t compared = 0;
+    while(compared <= key_size) {
+        size_t to_read = MIN(buffer_size, key_size + 1 - compared);
+        if(stream_read(stream, buffer, to_read) != to_read) return false;
+        for(size_t i = 0; i < to_read; i++) {
+            char expected = (compared + i < key_size) ? key[compared + i] :
+                                                        flipper_format_delimiter;
+            if(buffer[i] != (uint8_t)expected) return false;
+        }
+        compared += to_read;
+    }
+
+    return true;
+}
+
+bool flipper_format_stream_key_index_find(
+    FlipperStreamKeyIndex* key_index,
+    Stream* stream,
+    const char* key) {
+    // Stream size is a cheap guard against modifications behind the index
+    if(!key_index->built || key_index->stream_size != stream_size(stream)) {
+        size_t position = stream_tell(stream);
+        flipper_format_stream_key_index_build(key_index, stream);
+        stream_seek(stream, position, StreamOffsetFromStart);
+    }
+
+    size_t position = stream_tell(stream);
+    size_t key_size = strlen(key);
+    uint32_t hash = flipper_format_stream_key_hash(key, key_size);
+
+    // First entry with the same hash at or after the current position
+    size_t low = 0;
+    size_t high = key_index->count;
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        const FlipperStreamKeyIndexEntry* entry = &key_index->entries[middle];
+        if(entry->hash < hash || (entry->hash == hash && entry->offset < position)) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    for(size_t i = low; i < key_index->count && key_index->entries[i].hash == hash; i++) {
+        size_t offset = key_index->entries[i].offset;
+        if(flipper_format_stream_key_index_check_key(stream, offset, key, key_size)) {
+            return stream_seek(stream, offset, StreamOffsetFromStart);
+        }
+    }
+
+    stream_seek(stream, 0, StreamOffsetFromEnd);
+    return false;
+}
+
 static bool flipper_format_stream_read_value(Stream* stream, FuriString* value, bool* last) {
     enum {
         LeadingSpace,
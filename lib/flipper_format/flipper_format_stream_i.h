@@ -29,6 +29,44 @@ bool flipper_format_stream_write_eol(Stream* stream);
  */
 bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool strict_mode);
 
+typedef struct FlipperStreamKeyIndex FlipperStreamKeyIndex;
+
+/**
+ * Allocate an empty key index.
+ * Index is built lazily on the first lookup.
+ * @return FlipperStreamKeyIndex* 
+ */
+FlipperStreamKeyIndex* flipper_format_stream_key_index_alloc(void);
+
+/**
+ * Free the key index.
+ * @param key_index 
+ */
+void flipper_format_stream_key_index_free(FlipperStreamKeyIndex* key_index);
+
+/**
+ * Drop the key index contents, it will be rebuilt on the next lookup.
+ * Must be called after every modification of the indexed stream.
+ * @param key_index 
+ */
+void flipper_format_stream_key_index_reset(FlipperStreamKeyIndex* key_index);
+
+/**
+ * Find the key from the current position of the stream using the key index.
+ * Gives the same result as a non-strict flipper_format_stream_seek_to_key(), but position
+ * will be at the beginning of the key line, so the value can be read in strict mode.
+ * Position will be at the end of the stream if the key is not found.
+ * @param key_index 
+ * @param stream 
+ * @param key 
+ * @return true key is found
+ * @return false key is not found
+ */
+bool flipper_format_stream_key_index_find(
+    FlipperStreamKeyIndex* key_index,
+    Stream* stream,
+    const char* key);
+
 #ifdef __cplusplus
 }
 #endif
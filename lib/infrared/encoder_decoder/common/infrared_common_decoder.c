@@ -1,6 +1,7 @@
 #include "infrared_common_i.h"
 
 #include <stdlib.h>
+#include <string.h>
 #include <core/check.h>
 #include <core/common_defines.h>
 
@@ -275,7 +276,7 @@ InfraredMessage*
     return message;
 }
 
-void* infrared_common_decoder_alloc(const InfraredCommonProtocolSpec* protocol) {
+size_t infrared_common_decoder_get_size(const InfraredCommonProtocolSpec* protocol) {
     furi_assert(protocol);
 
     /* protocol->databit_len[0] has to contain biggest value of bits that can be decoded */
@@ -283,17 +284,51 @@ void* infrared_common_decoder_alloc(const InfraredCommonProtocolSpec* protocol)
         furi_assert(protocol->databit_len[i] <= protocol->databit_len[0]);
     }
 
-    uint32_t alloc_size = sizeof(InfraredCommonDecoder) + protocol->databit_len[0] / 8 +
-                          !!(protocol->databit_len[0] % 8);
-    InfraredCommonDecoder* decoder = malloc(alloc_size);
+    return sizeof(InfraredCommonDecoder) + protocol->databit_len[0] / 8 +
+           !!(protocol->databit_len[0] % 8);
+}
+
+void infrared_common_decoder_init(
+    InfraredCommonDecoder* decoder,
+    const InfraredCommonProtocolSpec* protocol,
+    void* context) {
+    furi_assert(decoder);
+    furi_assert(protocol);
+
+    memset(decoder, 0, infrared_common_decoder_get_size(protocol));
     decoder->protocol = protocol;
+    decoder->context = context;
     decoder->level = true;
-    return decoder;
 }
 
-void infrared_common_decoder_free(InfraredCommonDecoder* decoder) {
+bool infrared_common_decoder_is_waiting_preamble(const InfraredCommonDecoder* decoder) {
+    furi_assert(decoder);
+
+    return (decoder->state == InfraredCommonDecoderStateWaitPreamble) &&
+           (decoder->protocol->timings.preamble_mark != 0);
+}
+
+bool infrared_common_decoder_feed_preamble(
+    InfraredCommonDecoder* decoder,
+    uint32_t mark,
+    uint32_t space) {
     furi_assert(decoder);
-    free(decoder);
+    furi_assert(infrared_common_decoder_is_waiting_preamble(decoder));
+
+    const InfraredTimings* timings = &decoder->protocol->timings;
+    bool result = MATCH_TIMING(mark, timings->preamble_mark, timings->preamble_tolerance) &&
+                  MATCH_TIMING(space, timings->preamble_space, timings->preamble_tolerance);
+
+    /* same state infrared_common_decode() leaves after this mark/space pair */
+    decoder->timings_cnt = 0;
+    decoder->level = false;
+    if(result) {
+        decoder->state = InfraredCommonDecoderStateDecode;
+        decoder->databit_cnt = 0;
+        decoder->switch_detect = false;
+    }
+
+    return result;
 }
 
 void infrared_common_decoder_reset_state(InfraredCommonDecoder* decoder) {
@@ -24,6 +24,7 @@ typedef struct {
     InfraredCommonInterpret interpret;
     InfraredCommonEncode encode;
     InfraredCommonEncode encode_repeat;
+    size_t decoder_context_size; /* protocol state kept in InfraredCommonDecoder.context */
 } InfraredCommonProtocolSpec;
 
 typedef enum {
@@ -70,8 +71,16 @@ InfraredStatus
     infrared_common_decode_pdwm(InfraredCommonDecoder* decoder, bool level, uint32_t timing);
 InfraredStatus
     infrared_common_decode_manchester(InfraredCommonDecoder* decoder, bool level, uint32_t timing);
-void* infrared_common_decoder_alloc(const InfraredCommonProtocolSpec* protocol);
-void infrared_common_decoder_free(InfraredCommonDecoder* decoder);
+size_t infrared_common_decoder_get_size(const InfraredCommonProtocolSpec* protocol);
+void infrared_common_decoder_init(
+    InfraredCommonDecoder* decoder,
+    const InfraredCommonProtocolSpec* protocol,
+    void* context);
+bool infrared_common_decoder_is_waiting_preamble(const InfraredCommonDecoder* decoder);
+bool infrared_common_decoder_feed_preamble(
+    InfraredCommonDecoder* decoder,
+    uint32_t mark,
+    uint32_t space);
 void infrared_common_decoder_reset(InfraredCommonDecoder* decoder);
 InfraredMessage* infrared_common_decoder_check_ready(InfraredCommonDecoder* decoder);
 
@@ -6,21 +6,21 @@
 #include <core/common_defines.h>
 
 #include "nec/infrared_protocol_nec.h"
+#include "nec/infrared_protocol_nec_i.h"
 #include "samsung/infrared_protocol_samsung.h"
+#include "samsung/infrared_protocol_samsung_i.h"
 #include "rc5/infrared_protocol_rc5.h"
+#include "rc5/infrared_protocol_rc5_i.h"
 #include "rc6/infrared_protocol_rc6.h"
+#include "rc6/infrared_protocol_rc6_i.h"
 #include "sirc/infrared_protocol_sirc.h"
+#include "sirc/infrared_protocol_sirc_i.h"
 #include "kaseikyo/infrared_protocol_kaseikyo.h"
+#include "kaseikyo/infrared_protocol_kaseikyo_i.h"
 #include "rca/infrared_protocol_rca.h"
+#include "rca/infrared_protocol_rca_i.h"
 #include "pioneer/infrared_protocol_pioneer.h"
-
-typedef struct {
-    InfraredAlloc alloc;
-    InfraredDecode decode;
-    InfraredDecoderReset reset;
-    InfraredFree free;
-    InfraredDecoderCheckReady check_ready;
-} InfraredDecoders;
+#include "pioneer/infrared_protocol_pioneer_i.h"
 
 typedef struct {
     InfraredAlloc alloc;
@@ -29,10 +29,6 @@ typedef struct {
     InfraredFree free;
 } InfraredEncoders;
 
-struct InfraredDecoderHandler {
-    void** ctx;
-};
-
 struct InfraredEncoderHandler {
     void* handler;
     const InfraredEncoders* encoder;
@@ -40,18 +36,13 @@ struct InfraredEncoderHandler {
 
 typedef struct {
     InfraredEncoders encoder;
-    InfraredDecoders decoder;
+    const InfraredCommonProtocolSpec* decoder;
     InfraredGetProtocolVariant get_protocol_variant;
 } InfraredEncoderDecoder;
 
 static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
     {
-        .decoder =
-            {.alloc = infrared_decoder_nec_alloc,
-             .decode = infrared_decoder_nec_decode,
-             .reset = infrared_decoder_nec_reset,
-             .check_ready = infrared_decoder_nec_check_ready,
-             .free = infrared_decoder_nec_free},
+        .decoder = &infrared_protocol_nec,
         .encoder =
             {.alloc = infrared_encoder_nec_alloc,
              .encode = infrared_encoder_nec_encode,
@@ -60,12 +51,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
         .get_protocol_variant = infrared_protocol_nec_get_variant,
     },
     {
-        .decoder =
-            {.alloc = infrared_decoder_samsung32_alloc,
-             .decode = infrared_decoder_samsung32_decode,
-             .reset = infrared_decoder_samsung32_reset,
-             .check_ready = infrared_decoder_samsung32_check_ready,
-             .free = infrared_decoder_samsung32_free},
+        .decoder = &infrared_protocol_samsung32,
         .encoder =
             {.alloc = infrared_encoder_samsung32_alloc,
              .encode = infrared_encoder_samsung32_encode,
@@ -74,12 +60,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
         .get_protocol_variant = infrared_protocol_samsung32_get_variant,
     },
     {
-        .decoder =
-            {.alloc = infrared_decoder_rc5_alloc,
-             .decode = infrared_decoder_rc5_decode,
-             .reset = infrared_decoder_rc5_reset,
-             .check_ready = infrared_decoder_rc5_check_ready,
-             .free = infrared_decoder_rc5_free},
+        .decoder = &infrared_protocol_rc5,
         .encoder =
             {.alloc = infrared_encoder_rc5_alloc,
              .encode = infrared_encoder_rc5_encode,
@@ -88,12 +69,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
         .get_protocol_variant = infrared_protocol_rc5_get_variant,
     },
     {
-        .decoder =
-            {.alloc = infrared_decoder_rc6_alloc,
-             .decode = infrared_decoder_rc6_decode,
-             .reset = infrared_decoder_rc6_reset,
-             .check_ready = infrared_decoder_rc6_check_ready,
-             .free = infrared_decoder_rc6_free},
+        .decoder = &infrared_protocol_rc6,
         .encoder =
             {.alloc = infrared_encoder_rc6_alloc,
              .encode = infrared_encoder_rc6_encode,
@@ -102,12 +78,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
         .get_protocol_variant = infrared_protocol_rc6_get_variant,
     },
     {
-        .decoder =
-            {.alloc = infrared_decoder_sirc_alloc,
-             .decode = infrared_decoder_sirc_decode,
-             .reset = infrared_decoder_sirc_reset,
-             .check_ready = infrared_decoder_sirc_check_ready,
-             .free = infrared_decoder_sirc_free},
+        .decoder = &infrared_protocol_sirc,
         .encoder =
             {.alloc = infrared_encoder_sirc_alloc,
              .encode = infrared_encoder_sirc_encode,
@@ -116,12 +87,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
         .get_protocol_variant = infrared_protocol_sirc_get_variant,
     },
     {
-        .decoder =
-            {.alloc = infrared_decoder_pioneer_alloc,
-             .decode = infrared_decoder_pioneer_decode,
-             .reset = infrared_decoder_pioneer_reset,
-             .check_ready = infrared_decoder_pioneer_check_ready,
-             .free = infrared_decoder_pioneer_free},
+        .decoder = &infrared_protocol_pioneer,
         .encoder =
             {.alloc = infrared_encoder_pioneer_alloc,
              .encode = infrared_encoder_pioneer_encode,
@@ -130,12 +96,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
         .get_protocol_variant = infrared_protocol_pioneer_get_variant,
     },
     {
-        .decoder =
-            {.alloc = infrared_decoder_kaseikyo_alloc,
-             .decode = infrared_decoder_kaseikyo_decode,
-             .reset = infrared_decoder_kaseikyo_reset,
-             .check_ready = infrared_decoder_kaseikyo_check_ready,
-             .free = infrared_decoder_kaseikyo_free},
+        .decoder = &infrared_protocol_kaseikyo,
         .encoder =
             {.alloc = infrared_encoder_kaseikyo_alloc,
              .encode = infrared_encoder_kaseikyo_encode,
@@ -144,12 +105,7 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
         .get_protocol_variant = infrared_protocol_kaseikyo_get_variant,
     },
     {
-        .decoder =
-            {.alloc = infrared_decoder_rca_alloc,
-             .decode = infrared_decoder_rca_decode,
-             .reset = infrared_decoder_rca_reset,
-             .check_ready = infrared_decoder_rca_check_ready,
-             .free = infrared_decoder_rca_free},
+        .decoder = &infrared_protocol_rca,
         .encoder =
             {.alloc = infrared_encoder_rca_alloc,
              .encode = infrared_encoder_rca_encode,
@@ -159,6 +115,20 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
     },
 };
 
+#define INFRARED_DECODERS_COUNT COUNT_OF(infrared_encoder_decoder)
+
+/* Decoders and their contexts are 8-byte aligned inside of the handler arena */
+#define INFRARED_DECODER_ALIGN(x) (((x) + sizeof(uint64_t) - 1) & ~(sizeof(uint64_t) - 1))
+
+struct InfraredDecoderHandler {
+    InfraredCommonDecoder* decoders[INFRARED_DECODERS_COUNT];
+    uint8_t* arena;
+    /* previous timing, when it was a mark: preambles start with a mark/space pair */
+    uint32_t mark_duration;
+    bool mark_pending;
+    bool fused;
+};
+
 static int infrared_find_index_by_protocol(InfraredProtocol protocol);
 static const InfraredProtocolVariant* infrared_get_variant_by_protocol(InfraredProtocol protocol);
 
@@ -169,52 +139,90 @@ const InfraredMessage*
     InfraredMessage* message = NULL;
     InfraredMessage* result = NULL;
 
-    for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
-        if(infrared_encoder_decoder[i].decoder.decode) {
-            message = infrared_encoder_decoder[i].decoder.decode(handler->ctx[i], level, duration);
-            if(!result && message) {
-                result = message;
+    for(size_t i = 0; i < INFRARED_DECODERS_COUNT; ++i) {
+        InfraredCommonDecoder* decoder = handler->decoders[i];
+
+        /* Idle decoder can only leave its state on a matching preamble: classify the
+         * leading mark/space pair here instead of feeding each timing to every decoder */
+        if(handler->fused && infrared_common_decoder_is_waiting_preamble(decoder)) {
+            if(!level && handler->mark_pending) {
+                infrared_common_decoder_feed_preamble(decoder, handler->mark_duration, duration);
             }
+            continue;
+        }
+
+        message = infrared_common_decode(decoder, level, duration);
+        if(!result && message) {
+            result = message;
         }
     }
 
+    handler->mark_pending = level;
+    handler->mark_duration = duration;
+
     return result;
 }
 
 InfraredDecoderHandler* infrared_alloc_decoder(void) {
     InfraredDecoderHandler* handler = malloc(sizeof(InfraredDecoderHandler));
-    handler->ctx = malloc(sizeof(void*) * COUNT_OF(infrared_encoder_decoder));
 
-    for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
-        handler->ctx[i] = 0;
-        if(infrared_encoder_decoder[i].decoder.alloc)
-            handler->ctx[i] = infrared_encoder_decoder[i].decoder.alloc();
+    size_t arena_size = 0;
+    for(size_t i = 0; i < INFRARED_DECODERS_COUNT; ++i) {
+        const InfraredCommonProtocolSpec* protocol = infrared_encoder_decoder[i].decoder;
+        arena_size += INFRARED_DECODER_ALIGN(infrared_common_decoder_get_size(protocol));
+        arena_size += INFRARED_DECODER_ALIGN(protocol->decoder_context_size);
     }
 
+    /* All decoders live in one block: no allocations after this point */
+    handler->arena = malloc(arena_size);
+
+    uint8_t* arena = handler->arena;
+    for(size_t i = 0; i < INFRARED_DECODERS_COUNT; ++i) {
+        const InfraredCommonProtocolSpec* protocol = infrared_encoder_decoder[i].decoder;
+        InfraredCommonDecoder* decoder = (InfraredCommonDecoder*)arena;
+        arena += INFRARED_DECODER_ALIGN(infrared_common_decoder_get_size(protocol));
+
+        void* context = NULL;
+        if(protocol->decoder_context_size) {
+            context = arena;
+            memset(context, 0, protocol->decoder_context_size);
+            arena += INFRARED_DECODER_ALIGN(protocol->decoder_context_size);
+        }
+
+        infrared_common_decoder_init(decoder, protocol, context);
+        handler->decoders[i] = decoder;
+    }
+
+    handler->fused = true;
     infrared_reset_decoder(handler);
     return handler;
 }
 
 void infrared_free_decoder(InfraredDecoderHandler* handler) {
     furi_check(handler);
-    furi_check(handler->ctx);
-
-    for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
-        if(infrared_encoder_decoder[i].decoder.free)
-            infrared_encoder_decoder[i].decoder.free(handler->ctx[i]);
-    }
+    furi_check(handler->arena);
 
-    free(handler->ctx);
+    free(handler->arena);
     free(handler);
 }
 
 void infrared_reset_decoder(InfraredDecoderHandler* handler) {
     furi_check(handler);
 
-    for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
-        if(infrared_encoder_decoder[i].decoder.reset)
-            infrared_encoder_decoder[i].decoder.reset(handler->ctx[i]);
+    for(size_t i = 0; i < INFRARED_DECODERS_COUNT; ++i) {
+        infrared_common_decoder_reset(handler->decoders[i]);
     }
+
+    handler->mark_pending = false;
+    handler->mark_duration = 0;
+}
+
+void infrared_set_decoder_fused(InfraredDecoderHandler* handler, bool fused) {
+    furi_check(handler);
+
+    /* pending timings of skipped decoders are stale, start over */
+    infrared_reset_decoder(handler);
+    handler->fused = fused;
 }
 
 const InfraredMessage* infrared_check_decoder_ready(InfraredDecoderHandler* handler) {
@@ -223,12 +231,10 @@ const InfraredMessage* infrared_check_decoder_ready(InfraredDecoderHandler* hand
     InfraredMessage* message = NULL;
     InfraredMessage* result = NULL;
 
-    for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
-        if(infrared_encoder_decoder[i].decoder.check_ready) {
-            message = infrared_encoder_decoder[i].decoder.check_ready(handler->ctx[i]);
-            if(!result && message) {
-                result = message;
-            }
+    for(size_t i = 0; i < INFRARED_DECODERS_COUNT; ++i) {
+        message = infrared_common_decoder_check_ready(handler->decoders[i]);
+        if(!result && message) {
+            result = message;
         }
     }
 
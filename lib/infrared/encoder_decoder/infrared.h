@@ -106,6 +106,18 @@ void infrared_free_decoder(InfraredDecoderHandler* handler);
  */
 void infrared_reset_decoder(InfraredDecoderHandler* handler);
 
+/**
+ * Enable or disable fused decoding (enabled by default).
+ * In fused mode decoders waiting for a preamble are not fed every timing:
+ * the leading mark/space pair is matched once and only the decoders whose
+ * preamble matches start decoding. Decoding results are the same in both modes.
+ * Decoder is reset.
+ *
+ * \param[in]   handler     - handler to INFRARED decoders. Should be acquired with \c infrared_alloc_decoder().
+ * \param[in]   fused       - true to enable fused decoding, false to feed every decoder.
+ */
+void infrared_set_decoder_fused(InfraredDecoderHandler* handler, bool fused);
+
 /**
  * Get protocol name by protocol enum.
  *
@@ -30,10 +30,6 @@ typedef const InfraredProtocolVariant* (*InfraredGetProtocolVariant)(InfraredPro
 typedef void* (*InfraredAlloc)(void);
 typedef void (*InfraredFree)(void*);
 
-typedef void (*InfraredDecoderReset)(void*);
-typedef InfraredMessage* (*InfraredDecode)(void* ctx, bool level, uint32_t duration);
-typedef InfraredMessage* (*InfraredDecoderCheckReady)(void*);
-
 typedef void (*InfraredEncoderReset)(void* encoder, const InfraredMessage* message);
 typedef InfraredStatus (*InfraredEncode)(void* encoder, uint32_t* out, bool* polarity);
 
@@ -1,10 +1,6 @@
 #include "infrared_protocol_kaseikyo_i.h"
 #include <core/check.h>
 
-InfraredMessage* infrared_decoder_kaseikyo_check_ready(void* ctx) {
-    return infrared_common_decoder_check_ready(ctx);
-}
-
 bool infrared_decoder_kaseikyo_interpret(InfraredCommonDecoder* decoder) {
     furi_assert(decoder);
 
@@ -32,19 +28,3 @@ bool infrared_decoder_kaseikyo_interpret(InfraredCommonDecoder* decoder) {
 
     return result;
 }
-
-void* infrared_decoder_kaseikyo_alloc(void) {
-    return infrared_common_decoder_alloc(&infrared_protocol_kaseikyo);
-}
-
-InfraredMessage* infrared_decoder_kaseikyo_decode(void* decoder, bool level, uint32_t duration) {
-    return infrared_common_decode(decoder, level, duration);
-}
-
-void infrared_decoder_kaseikyo_free(void* decoder) {
-    infrared_common_decoder_free(decoder);
-}
-
-void infrared_decoder_kaseikyo_reset(void* decoder) {
-    infrared_common_decoder_reset(decoder);
-}
@@ -1,10 +1,6 @@
 #include "infrared_protocol_nec_i.h"
 #include <core/check.h>
 
-InfraredMessage* infrared_decoder_nec_check_ready(void* ctx) {
-    return infrared_common_decoder_check_ready(ctx);
-}
-
 bool infrared_decoder_nec_interpret(InfraredCommonDecoder* decoder) {
     furi_assert(decoder);
 
@@ -79,19 +75,3 @@ InfraredStatus infrared_decoder_nec_decode_repeat(InfraredCommonDecoder* decoder
 
     return status;
 }
-
-void* infrared_decoder_nec_alloc(void) {
-    return infrared_common_decoder_alloc(&infrared_protocol_nec);
-}
-
-InfraredMessage* infrared_decoder_nec_decode(void* decoder, bool level, uint32_t duration) {
-    return infrared_common_decode(decoder, level, duration);
-}
-
-void infrared_decoder_nec_free(void* decoder) {
-    infrared_common_decoder_free(decoder);
-}
-
-void infrared_decoder_nec_reset(void* decoder) {
-    infrared_common_decoder_reset(decoder);
-}
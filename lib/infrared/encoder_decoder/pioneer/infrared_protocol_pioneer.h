@@ -21,12 +21,6 @@
 *  - 1 stop bit
 ***************************************************************************************************/
 
-void* infrared_decoder_pioneer_alloc(void);
-void infrared_decoder_pioneer_reset(void* decoder);
-InfraredMessage* infrared_decoder_pioneer_check_ready(void* decoder);
-void infrared_decoder_pioneer_free(void* decoder);
-InfraredMessage* infrared_decoder_pioneer_decode(void* decoder, bool level, uint32_t duration);
-
 void* infrared_encoder_pioneer_alloc(void);
 void infrared_encoder_pioneer_reset(void* encoder_ptr, const InfraredMessage* message);
 void infrared_encoder_pioneer_free(void* decoder);
@@ -3,16 +3,6 @@
 #include <stdlib.h>
 #include <core/check.h>
 
-typedef struct {
-    InfraredCommonDecoder* common_decoder;
-    bool toggle;
-} InfraredRc5Decoder;
-
-InfraredMessage* infrared_decoder_rc5_check_ready(void* ctx) {
-    InfraredRc5Decoder* decoder = ctx;
-    return infrared_common_decoder_check_ready(decoder->common_decoder);
-}
-
 bool infrared_decoder_rc5_interpret(InfraredCommonDecoder* decoder) {
     furi_assert(decoder);
 
@@ -35,8 +25,8 @@ bool infrared_decoder_rc5_interpret(InfraredCommonDecoder* decoder) {
     if(start_bit1 == 1) {
         InfraredProtocol protocol = start_bit2 ? InfraredProtocolRC5 : InfraredProtocolRC5X;
         InfraredMessage* message = &decoder->message;
-        InfraredRc5Decoder* rc5_decoder = decoder->context;
-        bool* prev_toggle = &rc5_decoder->toggle;
+        InfraredRc5DecoderContext* rc5_context = decoder->context;
+        bool* prev_toggle = &rc5_context->toggle;
         if((message->address == address) && (message->command == command) &&
            (message->protocol == protocol)) {
             message->repeat = (toggle == *prev_toggle);
@@ -53,27 +43,3 @@ bool infrared_decoder_rc5_interpret(InfraredCommonDecoder* decoder) {
 
     return result;
 }
-
-void* infrared_decoder_rc5_alloc(void) {
-    InfraredRc5Decoder* decoder = malloc(sizeof(InfraredRc5Decoder));
-    decoder->toggle = false;
-    decoder->common_decoder = infrared_common_decoder_alloc(&infrared_protocol_rc5);
-    decoder->common_decoder->context = decoder;
-    return decoder;
-}
-
-InfraredMessage* infrared_decoder_rc5_decode(void* decoder, bool level, uint32_t duration) {
-    InfraredRc5Decoder* decoder_rc5 = decoder;
-    return infrared_common_decode(decoder_rc5->common_decoder, level, duration);
-}
-
-void infrared_decoder_rc5_free(void* decoder) {
-    InfraredRc5Decoder* decoder_rc5 = decoder;
-    infrared_common_decoder_free(decoder_rc5->common_decoder);
-    free(decoder_rc5);
-}
-
-void infrared_decoder_rc5_reset(void* decoder) {
-    InfraredRc5Decoder* decoder_rc5 = decoder;
-    infrared_common_decoder_reset(decoder_rc5->common_decoder);
-}
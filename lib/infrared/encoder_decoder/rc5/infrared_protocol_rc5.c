@@ -19,6 +19,7 @@ const InfraredCommonProtocolSpec infrared_protocol_rc5 = {
     .interpret = infrared_decoder_rc5_interpret,
     .decode_repeat = NULL,
     .encode_repeat = NULL,
+    .decoder_context_size = sizeof(InfraredRc5DecoderContext),
 };
 
 static const InfraredProtocolVariant infrared_protocol_variant_rc5 = {
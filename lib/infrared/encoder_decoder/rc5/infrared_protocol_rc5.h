@@ -24,12 +24,6 @@
 *    command - 6/7 bit
 ***************************************************************************************************/
 
-void* infrared_decoder_rc5_alloc(void);
-void infrared_decoder_rc5_reset(void* decoder);
-void infrared_decoder_rc5_free(void* decoder);
-InfraredMessage* infrared_decoder_rc5_check_ready(void* ctx);
-InfraredMessage* infrared_decoder_rc5_decode(void* decoder, bool level, uint32_t duration);
-
 void* infrared_encoder_rc5_alloc(void);
 void infrared_encoder_rc5_reset(void* encoder_ptr, const InfraredMessage* message);
 void infrared_encoder_rc5_free(void* decoder);
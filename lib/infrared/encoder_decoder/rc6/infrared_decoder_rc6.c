@@ -3,16 +3,6 @@
 #include <stdlib.h>
 #include <core/check.h>
 
-typedef struct {
-    InfraredCommonDecoder* common_decoder;
-    bool toggle;
-} InfraredRc6Decoder;
-
-InfraredMessage* infrared_decoder_rc6_check_ready(void* ctx) {
-    InfraredRc6Decoder* decoder_rc6 = ctx;
-    return infrared_common_decoder_check_ready(decoder_rc6->common_decoder);
-}
-
 bool infrared_decoder_rc6_interpret(InfraredCommonDecoder* decoder) {
     furi_assert(decoder);
 
@@ -27,8 +17,8 @@ bool infrared_decoder_rc6_interpret(InfraredCommonDecoder* decoder) {
 
     if((start_bit == 1) && (mode == 0)) {
         InfraredMessage* message = &decoder->message;
-        InfraredRc6Decoder* rc6_decoder = decoder->context;
-        bool* prev_toggle = &rc6_decoder->toggle;
+        InfraredRc6DecoderContext* rc6_context = decoder->context;
+        bool* prev_toggle = &rc6_context->toggle;
         if((message->address == address) && (message->command == command) &&
            (message->protocol == InfraredProtocolRC6)) {
             message->repeat = (toggle == *prev_toggle);
@@ -86,27 +76,3 @@ InfraredStatus infrared_decoder_rc6_decode_manchester(
 
     return status;
 }
-
-void* infrared_decoder_rc6_alloc(void) {
-    InfraredRc6Decoder* decoder = malloc(sizeof(InfraredRc6Decoder));
-    decoder->toggle = false;
-    decoder->common_decoder = infrared_common_decoder_alloc(&infrared_protocol_rc6);
-    decoder->common_decoder->context = decoder;
-    return decoder;
-}
-
-InfraredMessage* infrared_decoder_rc6_decode(void* decoder, bool level, uint32_t duration) {
-    InfraredRc6Decoder* decoder_rc6 = decoder;
-    return infrared_common_decode(decoder_rc6->common_decoder, level, duration);
-}
-
-void infrared_decoder_rc6_free(void* decoder) {
-    InfraredRc6Decoder* decoder_rc6 = decoder;
-    infrared_common_decoder_free(decoder_rc6->common_decoder);
-    free(decoder_rc6);
-}
-
-void infrared_decoder_rc6_reset(void* decoder) {
-    InfraredRc6Decoder* decoder_rc6 = decoder;
-    infrared_common_decoder_reset(decoder_rc6->common_decoder);
-}
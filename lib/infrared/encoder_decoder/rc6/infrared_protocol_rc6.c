@@ -20,6 +20,7 @@ const InfraredCommonProtocolSpec infrared_protocol_rc6 = {
     .interpret = infrared_decoder_rc6_interpret,
     .decode_repeat = NULL,
     .encode_repeat = NULL,
+    .decoder_context_size = sizeof(InfraredRc6DecoderContext),
 };
 
 static const InfraredProtocolVariant infrared_protocol_variant_rc6 = {
@@ -15,6 +15,11 @@
 #define INFRARED_RC6_MIN_SPLIT_TIME     2700
 #define INFRARED_RC6_REPEAT_COUNT_MIN   1
 
+/* Decoder state kept between messages */
+typedef struct {
+    bool toggle;
+} InfraredRc6DecoderContext;
+
 extern const InfraredCommonProtocolSpec infrared_protocol_rc6;
 
 bool infrared_decoder_rc6_interpret(InfraredCommonDecoder* decoder);
@@ -1,10 +1,6 @@
 #include "infrared_protocol_rca_i.h"
 #include <core/check.h>
 
-InfraredMessage* infrared_decoder_rca_check_ready(void* ctx) {
-    return infrared_common_decoder_check_ready(ctx);
-}
-
 bool infrared_decoder_rca_interpret(InfraredCommonDecoder* decoder) {
     furi_assert(decoder);
 
@@ -27,19 +23,3 @@ bool infrared_decoder_rca_interpret(InfraredCommonDecoder* decoder) {
 
     return false;
 }
-
-void* infrared_decoder_rca_alloc(void) {
-    return infrared_common_decoder_alloc(&infrared_protocol_rca);
-}
-
-InfraredMessage* infrared_decoder_rca_decode(void* decoder, bool level, uint32_t duration) {
-    return infrared_common_decode(decoder, level, duration);
-}
-
-void infrared_decoder_rca_free(void* decoder) {
-    infrared_common_decoder_free(decoder);
-}
-
-void infrared_decoder_rca_reset(void* decoder) {
-    infrared_common_decoder_reset(decoder);
-}
@@ -1,10 +1,6 @@
 #include "infrared_protocol_samsung_i.h"
 #include <core/check.h>
 
-InfraredMessage* infrared_decoder_samsung32_check_ready(void* ctx) {
-    return infrared_common_decoder_check_ready(ctx);
-}
-
 bool infrared_decoder_samsung32_interpret(InfraredCommonDecoder* decoder) {
     furi_assert(decoder);
 
@@ -51,19 +47,3 @@ InfraredStatus infrared_decoder_samsung32_decode_repeat(InfraredCommonDecoder* d
 
     return status;
 }
-
-void* infrared_decoder_samsung32_alloc(void) {
-    return infrared_common_decoder_alloc(&infrared_protocol_samsung32);
-}
-
-InfraredMessage* infrared_decoder_samsung32_decode(void* decoder, bool level, uint32_t duration) {
-    return infrared_common_decode(decoder, level, duration);
-}
-
-void infrared_decoder_samsung32_free(void* decoder) {
-    infrared_common_decoder_free(decoder);
-}
-
-void infrared_decoder_samsung32_reset(void* decoder) {
-    infrared_common_decoder_reset(decoder);
-}
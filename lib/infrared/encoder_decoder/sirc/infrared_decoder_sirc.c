@@ -1,10 +1,6 @@
 #include "infrared_protocol_sirc_i.h"
 #include <core/check.h>
 
-InfraredMessage* infrared_decoder_sirc_check_ready(void* ctx) {
-    return infrared_common_decoder_check_ready(ctx);
-}
-
 bool infrared_decoder_sirc_interpret(InfraredCommonDecoder* decoder) {
     furi_assert(decoder);
 
@@ -37,19 +33,3 @@ bool infrared_decoder_sirc_interpret(InfraredCommonDecoder* decoder) {
 
     return true;
 }
-
-void* infrared_decoder_sirc_alloc(void) {
-    return infrared_common_decoder_alloc(&infrared_protocol_sirc);
-}
-
-InfraredMessage* infrared_decoder_sirc_decode(void* decoder, bool level, uint32_t duration) {
-    return infrared_common_decode(decoder, level, duration);
-}
-
-void infrared_decoder_sirc_free(void* decoder) {
-    infrared_common_decoder_free(decoder);
-}
-
-void infrared_decoder_sirc_reset(void* decoder) {
-    infrared_common_decoder_reset(decoder);
-}
@@ -23,12 +23,6 @@
 * Assume 8 last extended bits for SIRC20 are address bits.
 ***************************************************************************************************/
 
-void* infrared_decoder_sirc_alloc(void);
-void infrared_decoder_sirc_reset(void* decoder);
-InfraredMessage* infrared_decoder_sirc_check_ready(void* decoder);
-void infrared_decoder_sirc_free(void* decoder);
-InfraredMessage* infrared_decoder_sirc_decode(void* decoder, bool level, uint32_t duration);
-
 void* infrared_encoder_sirc_alloc(void);
 void infrared_encoder_sirc_reset(void* encoder_ptr, const InfraredMessage* message);
 void infrared_encoder_sirc_free(void* decoder);
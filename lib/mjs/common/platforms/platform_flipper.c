@@ -29,6 +29,21 @@ char* cs_read_file(const char* path, size_t* size) {
     return data;
 }
 
+int cs_write_file(const char* path, const char* data, size_t size) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    Stream* stream = file_stream_alloc(storage);
+    int ret = -1;
+    if(file_stream_open(stream, path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        if(stream_write(stream, (const uint8_t*)data, size) == size) ret = 0;
+    }
+    file_stream_close(stream);
+    // Do not leave truncated file behind
+    if(ret != 0) storage_simply_remove(storage, path);
+    furi_record_close(RECORD_STORAGE);
+    stream_free(stream);
+    return ret;
+}
+
 char* json_fread(const char* path) {
     UNUSED(path);
     return NULL;
@@ -145,3 +145,90 @@ MJS_PRIVATE void mjs_bcode_commit(struct mjs* mjs) {
 
     mjs->bcode_len += bp.data.len;
 }
+
+MJS_PRIVATE uint32_t mjs_jsc_hash(const void* data, size_t len) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    uint32_t hash = 0x811C9DC5;
+    size_t i;
+    for(i = 0; i < len; i++) {
+        hash = (hash ^ bytes[i]) * 0x01000193;
+    }
+    return hash;
+}
+
+MJS_PRIVATE void
+    mjs_jsc_serialize(struct mjs* mjs, const char* src, size_t src_len, struct mbuf* out) {
+    struct mjs_bcode_part* bp = mjs_bcode_part_get(mjs, mjs_bcode_parts_cnt(mjs) - 1);
+    struct mjs_jsc_header header;
+
+    header.magic = MJS_JSC_MAGIC;
+    header.version = MJS_JSC_VERSION;
+    header.source_hash = mjs_jsc_hash(src, src_len);
+    header.source_size = src_len;
+    header.bcode_hash = mjs_jsc_hash(bp->data.p, bp->data.len);
+    header.bcode_size = bp->data.len;
+
+    mbuf_append(out, &header, sizeof(header));
+    mbuf_append(out, bp->data.p, bp->data.len);
+}
+
+MJS_PRIVATE int mjs_jsc_load(
+    struct mjs* mjs,
+    const char* path,
+    const char* jsc,
+    size_t jsc_size,
+    const char* src,
+    size_t src_len) {
+    const size_t items_size = sizeof(mjs_header_item_t) * MJS_HDR_ITEMS_CNT;
+    mjs_header_item_t items[MJS_HDR_ITEMS_CNT];
+    struct mjs_jsc_header header;
+    const char* bcode = jsc + sizeof(header);
+    const char* name;
+    size_t name_len, path_len;
+    int delta, i;
+
+    if(jsc_size < sizeof(header)) return 0;
+    memcpy(&header, jsc, sizeof(header));
+
+    if(header.magic != MJS_JSC_MAGIC || header.version != MJS_JSC_VERSION ||
+       header.source_size != src_len || header.bcode_size != jsc_size - sizeof(header) ||
+       header.source_hash != mjs_jsc_hash(src, src_len) ||
+       header.bcode_hash != mjs_jsc_hash(bcode, header.bcode_size)) {
+        return 0;
+    }
+
+    /* Header items are offsets from the byte after OP_BCODE_HEADER */
+    if(header.bcode_size < 1 + items_size || bcode[0] != OP_BCODE_HEADER) return 0;
+    memcpy(items, bcode + 1, items_size);
+    if(items[MJS_HDR_ITEM_TOTAL_SIZE] + 1 != header.bcode_size ||
+       items[MJS_HDR_ITEM_BCODE_OFFSET] <= items_size ||
+       items[MJS_HDR_ITEM_MAP_OFFSET] < items[MJS_HDR_ITEM_BCODE_OFFSET] ||
+       items[MJS_HDR_ITEM_MAP_OFFSET] >= items[MJS_HDR_ITEM_TOTAL_SIZE]) {
+        return 0;
+    }
+
+    name = bcode + 1 + items_size;
+    name_len = items[MJS_HDR_ITEM_BCODE_OFFSET] - items_size;
+    if(name[name_len - 1] != '\0') return 0;
+
+    /*
+     * All offsets inside the bcode are relative, so the file name can be
+     * resized as long as the header items are moved along with it
+     */
+    path_len = strlen(path) + 1;
+    delta = (int)path_len - (int)name_len;
+    for(i = 0; i < MJS_HDR_ITEMS_CNT; i++) {
+        items[i] += delta;
+    }
+
+    mbuf_append(&mjs->bcode_gen, bcode, 1);
+    mbuf_append(&mjs->bcode_gen, items, items_size);
+    mbuf_append(&mjs->bcode_gen, path, path_len);
+    mbuf_append(
+        &mjs->bcode_gen,
+        name + name_len,
+        header.bcode_size - (1 + items_size + name_len));
+    mjs_bcode_commit(mjs);
+
+    return 1;
+}
@@ -98,6 +98,50 @@ MJS_PRIVATE int mjs_bcode_parts_cnt(struct mjs* mjs);
  */
 MJS_PRIVATE void mjs_bcode_commit(struct mjs* mjs);
 
+/*
+ * Serialized bcode ("jsc"): the header below followed by a single bcode part,
+ * exactly as generated by the parser. MJS_JSC_VERSION must be bumped whenever
+ * the bcode generated for the same source may change: opcodes, parser or
+ * bcode header items.
+ */
+#define MJS_JSC_MAGIC 0x43534A4D /* "MJSC" */
+#define MJS_JSC_VERSION 2
+
+struct mjs_jsc_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t source_hash; /* FNV-1a of the source the bcode is compiled from */
+    uint32_t source_size;
+    uint32_t bcode_hash; /* FNV-1a of the bcode, catches corrupted files */
+    uint32_t bcode_size;
+};
+
+/*
+ * Returns hash of the data, as stored in the jsc header
+ */
+MJS_PRIVATE uint32_t mjs_jsc_hash(const void* data, size_t len);
+
+/*
+ * Appends the last committed bcode part, serialized, to `out`
+ */
+MJS_PRIVATE void
+    mjs_jsc_serialize(struct mjs* mjs, const char* src, size_t src_len, struct mbuf* out);
+
+/*
+ * Checks that `jsc` is compiled from `src` by this version of mJS and commits
+ * its bcode as a new part. The file name stored in the bcode is replaced with
+ * `path`, so jsc compiled elsewhere reports correct stack traces.
+ *
+ * Returns 1 on success, 0 if `jsc` is stale or corrupted.
+ */
+MJS_PRIVATE int mjs_jsc_load(
+    struct mjs* mjs,
+    const char* path,
+    const char* jsc,
+    size_t jsc_size,
+    const char* src,
+    size_t src_len);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -60,6 +60,25 @@ struct mjs_bcode_part {
     unsigned in_rom : 1;
 };
 
+/*
+ * Inline cache entry of an `obj.name` lookup, see mjs_get_cache_lookup()
+ */
+#define MJS_GET_CACHE_SIZE 32
+struct mjs_get_cache_entry {
+    size_t offset; /* Global bcode offset of OP_GET, 0 if the entry is empty */
+    struct mjs_object* obj;
+    struct mjs_property* prop;
+};
+
+/*
+ * Interned string literal, see mjs_mk_string_literal()
+ */
+#define MJS_LITERAL_CACHE_SIZE 32
+struct mjs_literal_cache_entry {
+    size_t offset; /* Global bcode offset of OP_PUSH_STR, 0 if the entry is empty */
+    mjs_val_t str;
+};
+
 struct mjs {
     struct mbuf bcode_gen;
     struct mbuf bcode_parts;
@@ -89,6 +108,9 @@ struct mjs {
     struct gc_arena property_arena;
     struct gc_arena ffi_sig_arena;
 
+    struct mjs_get_cache_entry get_cache[MJS_GET_CACHE_SIZE];
+    struct mjs_literal_cache_entry literal_cache[MJS_LITERAL_CACHE_SIZE];
+
     unsigned inhibit_gc : 1;
     unsigned need_gc : 1;
     unsigned generate_jsc : 1;
@@ -19,10 +19,6 @@
 #include "mjs_util.h"
 #include "mjs_array_buf.h"
 
-#if MJS_GENERATE_JSC && defined(CS_MMAP)
-#include <sys/mman.h>
-#endif
-
 /*
  * Pushes call stack frame. Offset is a global bcode offset. Retval_stack_idx
  * is an index in mjs->stack at which return value should be written later.
@@ -616,6 +612,8 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
     int scopes_len = mjs->scopes.len;
     int loop_addresses_len = mjs->loop_addresses.len;
     size_t start_off = off;
+    /* Offset of OP_GET which gets `obj.name`, set by OP_PUSH_STR */
+    size_t get_cache_offset = 0;
     const uint8_t* code;
 
     struct mjs_bcode_part bp = *mjs_bcode_part_get_by_offset(mjs, off);
@@ -743,7 +741,12 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
             mjs_val_t val = MJS_UNDEFINED;
 
             if(!getprop_builtin(mjs, obj, key, &val)) {
-                if(mjs_is_object(obj)) {
+                struct mjs_property* prop = NULL;
+                if(mjs_is_object(obj) && bp.start_idx + i == get_cache_offset &&
+                   (prop = mjs_get_own_property_v(mjs, obj, key)) != NULL) {
+                    mjs_get_cache_store(mjs, get_cache_offset, obj, prop);
+                    val = prop->value;
+                } else if(mjs_is_object(obj)) {
                     val = mjs_get_v_proto(mjs, obj, key);
                 } else if((mjs_is_data_view(obj) && (mjs_is_number(key)))) {
                     val = mjs_dataview_get_prop(mjs, obj, key);
@@ -784,7 +787,25 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
             break;
         case OP_PUSH_STR: {
             int llen, n = cs_varint_decode_unsafe(&code[i + 1], &llen);
-            mjs_push(mjs, mjs_mk_string(mjs, (char*)code + i + 1 + llen, n, 1));
+            size_t next = i + 1 + llen + n;
+            /*
+             * `obj.name` is OP_PUSH_STR, OP_SWAP, OP_GET: on an inline cache
+             * hit all three are done at once, without creating the name string
+             */
+            if(next + 1 < bp.data.len && code[next] == OP_SWAP && code[next + 1] == OP_GET) {
+                struct mjs_property* prop;
+                get_cache_offset = bp.start_idx + next + 1;
+                prop = mjs_get_cache_lookup(mjs, get_cache_offset, vtop(&mjs->stack));
+                if(prop != NULL) {
+                    mjs->vals.last_getprop_obj = mjs_pop(mjs);
+                    mjs_push(mjs, prop->value);
+                    opcode = OP_GET;
+                    i = next + 1;
+                    break;
+                }
+            }
+            mjs_push(
+                mjs, mjs_mk_string_literal(mjs, bp.start_idx + i, (char*)code + i + 1 + llen, n));
             i += llen + n;
             break;
         }
@@ -1059,6 +1080,61 @@ clean:
     return mjs->error;
 }
 
+#if MJS_GENERATE_JSC
+/*
+ * Returns allocated path of the .jsc counterpart of a .js file, or NULL if
+ * `path` has another extension
+ */
+static char* mjs_jsc_path(const char* path) {
+    const char* jsext = ".js";
+    int basename_len = (int)strlen(path) - strlen(jsext);
+    char* jsc_path = NULL;
+    if(basename_len > 0 && strcmp(path + basename_len, jsext) == 0) {
+        jsc_path = malloc(strlen(path) + 2);
+        strcpy(jsc_path, path);
+        strcat(jsc_path, "c");
+    }
+    return jsc_path;
+}
+
+/*
+ * Writes the last bcode part to the .jsc counterpart of `path`
+ */
+static void mjs_jsc_store(struct mjs* mjs, const char* path, const char* src) {
+    char* jsc_path = mjs_jsc_path(path);
+    struct mbuf jsc;
+    if(jsc_path == NULL) return;
+
+    mbuf_init(&jsc, 0);
+    mjs_jsc_serialize(mjs, src, strlen(src), &jsc);
+    if(cs_write_file(jsc_path, jsc.buf, jsc.len) != 0) {
+        LOG(LL_WARN, ("Failed to write %s", jsc_path));
+    }
+    mbuf_free(&jsc);
+    free(jsc_path);
+}
+
+/*
+ * Commits bcode from the .jsc counterpart of `path` if it is up to date
+ * with `src`. Returns 1 if the bcode is loaded and parsing can be skipped.
+ */
+static int mjs_jsc_restore(struct mjs* mjs, const char* path, const char* src) {
+    char* jsc_path = mjs_jsc_path(path);
+    char* jsc = NULL;
+    size_t jsc_size = 0;
+    int loaded = 0;
+    if(jsc_path == NULL) return 0;
+
+    jsc = cs_read_file(jsc_path, &jsc_size);
+    if(jsc != NULL) {
+        loaded = mjs_jsc_load(mjs, path, jsc, jsc_size, src, strlen(src));
+        free(jsc);
+    }
+    free(jsc_path);
+    return loaded;
+}
+#endif
+
 MJS_PRIVATE mjs_err_t mjs_exec_internal(
     struct mjs* mjs,
     const char* path,
@@ -1073,67 +1149,9 @@ MJS_PRIVATE mjs_err_t mjs_exec_internal(
 #endif
     if(generate_jsc == -1) generate_jsc = mjs->generate_jsc;
     if(mjs->error == MJS_OK) {
-#if MJS_GENERATE_JSC && defined(CS_MMAP)
+#if MJS_GENERATE_JSC
         if(generate_jsc && path != NULL) {
-            const char* jsext = ".js";
-            int basename_len = (int)strlen(path) - strlen(jsext);
-            if(basename_len > 0 && strcmp(path + basename_len, jsext) == 0) {
-                /* source file has a .js extension: create a .jsc counterpart */
-                int rewrite = 1;
-                int read_mmapped = 1;
-
-                /* construct .jsc filename */
-                const char* jscext = ".jsc";
-                char filename_jsc[basename_len + strlen(jscext) + 1 /* nul-term */];
-                memcpy(filename_jsc, path, basename_len);
-                strcpy(filename_jsc + basename_len, jscext);
-
-                /* get last bcode part */
-                struct mjs_bcode_part* bp = mjs_bcode_part_get(mjs, mjs_bcode_parts_cnt(mjs) - 1);
-
-                /*
-         * before writing .jsc file, check if it already exists and has the
-         * same contents
-         *
-         * TODO(dfrank): probably store crc32 before the bcode data, and only
-         * compare it.
-         */
-                {
-                    size_t size;
-                    char* data = cs_mmap_file(filename_jsc, &size);
-                    if(data != NULL) {
-                        if(size == bp->data.len) {
-                            if(memcmp(data, bp->data.p, size) == 0) {
-                                /* .jsc file is up to date, so don't rewrite it */
-                                rewrite = 0;
-                            }
-                        }
-                        munmap(data, size);
-                    }
-                }
-
-                /* try to open .jsc file for writing */
-                if(rewrite) {
-                    FILE* fp = fopen(filename_jsc, "wb");
-                    if(fp != NULL) {
-                        /* write last bcode part to .jsc */
-                        fwrite(bp->data.p, bp->data.len, 1, fp);
-                        fclose(fp);
-                    } else {
-                        LOG(LL_WARN, ("Failed to open %s for writing", filename_jsc));
-                        read_mmapped = 0;
-                    }
-                }
-
-                if(read_mmapped) {
-                    /* free RAM buffer with last bcode part */
-                    free((void*)bp->data.p);
-
-                    /* mmap .jsc file and set last bcode part buffer to it */
-                    bp->data.p = cs_mmap_file(filename_jsc, &bp->data.len);
-                    bp->in_rom = 1;
-                }
-            }
+            mjs_jsc_store(mjs, path, src);
         }
 #else
         (void)generate_jsc;
@@ -1162,6 +1180,18 @@ mjs_err_t mjs_exec_file(struct mjs* mjs, const char* path, mjs_val_t* res) {
     }
 
     r = MJS_UNDEFINED;
+#if MJS_GENERATE_JSC
+    if(mjs->generate_jsc) {
+        size_t off = mjs->bcode_len;
+        if(mjs_jsc_restore(mjs, path, source_code)) {
+            free(source_code);
+            /* Same state as after a successful parse, no error left from earlier calls */
+            mjs->error = MJS_OK;
+            error = mjs_execute(mjs, off, &r);
+            goto clean;
+        }
+    }
+#endif
     error = mjs_exec_internal(mjs, path, source_code, -1, &r);
     free(source_code);
 
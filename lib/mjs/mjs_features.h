@@ -15,19 +15,15 @@
 #endif
 
 /*
- * MJS_GENERATE_JSC: if enabled, and if mmapping is also enabled (CS_MMAP),
- * then execution of any .js file will result in creation of a .jsc file with
- * precompiled bcode, and this .jsc file will be mmapped, instead of keeping
- * bcode in RAM.
+ * MJS_GENERATE_JSC: if enabled, then execution of any .js file with
+ * mjs_set_generate_jsc() on will result in creation of a .jsc file with
+ * precompiled bcode. Next time the .jsc file is loaded instead of parsing
+ * the source, as long as the source is unchanged.
  *
- * By default it's enabled (provided that CS_MMAP is defined)
+ * By default it's enabled
  */
 #if !defined(MJS_GENERATE_JSC)
-#if defined(CS_MMAP)
 #define MJS_GENERATE_JSC 1
-#else
-#define MJS_GENERATE_JSC 0
-#endif
 #endif
 
 #endif /* MJS_FEATURES_H_ */
@@ -61,14 +61,17 @@ MJS_PRIVATE struct mjs_property*
 
     o = get_object_struct(obj);
 
+    if(len == (size_t)~0) len = strlen(name);
     if(len <= 5) {
         mjs_val_t ss = mjs_mk_string(mjs, name, len, 1);
         for(p = o->properties; p != NULL; p = p->next) {
             if(p->name == ss) return p;
         }
     } else {
+        /* Names are only compared when their hashes match */
+        uint32_t hash = mjs_property_name_hash(name, len);
         for(p = o->properties; p != NULL; p = p->next) {
-            if(mjs_strcmp(mjs, &p->name, name, len) == 0) return p;
+            if(p->name_hash == hash && mjs_strcmp(mjs, &p->name, name, len) == 0) return p;
         }
         return p;
     }
@@ -90,15 +93,54 @@ MJS_PRIVATE struct mjs_property*
     return p;
 }
 
+MJS_PRIVATE uint32_t mjs_property_name_hash(const char* name, size_t len) {
+    uint32_t hash = 0x811C9DC5;
+    size_t i;
+    for(i = 0; i < len; i++) {
+        hash = (hash ^ (uint8_t)name[i]) * 0x01000193;
+    }
+    return hash;
+}
+
 MJS_PRIVATE struct mjs_property*
     mjs_mk_property(struct mjs* mjs, mjs_val_t name, mjs_val_t value) {
     struct mjs_property* p = new_property(mjs);
+    size_t len;
+    const char* s = mjs_get_string(mjs, &name, &len);
     p->next = NULL;
+    p->name_hash = mjs_property_name_hash(s, len);
     p->name = name;
     p->value = value;
     return p;
 }
 
+static struct mjs_get_cache_entry* mjs_get_cache_entry(struct mjs* mjs, size_t offset) {
+    return &mjs->get_cache[(offset ^ (offset >> 5)) % MJS_GET_CACHE_SIZE];
+}
+
+MJS_PRIVATE struct mjs_property*
+    mjs_get_cache_lookup(struct mjs* mjs, size_t offset, mjs_val_t obj) {
+    struct mjs_get_cache_entry* e;
+    if((obj & MJS_TAG_MASK) != MJS_TAG_OBJECT) return NULL;
+    e = mjs_get_cache_entry(mjs, offset);
+    if(e->offset != offset || e->obj != get_object_struct(obj)) return NULL;
+    return e->prop;
+}
+
+MJS_PRIVATE void
+    mjs_get_cache_store(struct mjs* mjs, size_t offset, mjs_val_t obj, struct mjs_property* p) {
+    struct mjs_get_cache_entry* e;
+    if((obj & MJS_TAG_MASK) != MJS_TAG_OBJECT) return;
+    e = mjs_get_cache_entry(mjs, offset);
+    e->offset = offset;
+    e->obj = get_object_struct(obj);
+    e->prop = p;
+}
+
+MJS_PRIVATE void mjs_get_cache_flush(struct mjs* mjs) {
+    memset(mjs->get_cache, 0, sizeof(mjs->get_cache));
+}
+
 mjs_val_t mjs_get(struct mjs* mjs, mjs_val_t obj, const char* name, size_t name_len) {
     struct mjs_property* p;
 
@@ -238,6 +280,7 @@ int mjs_del(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
                 get_object_struct(obj)->properties = prop->next;
             }
             mjs_destroy_property(&prop);
+            mjs_get_cache_flush(mjs);
             return 0;
         }
     }
@@ -17,6 +17,7 @@ struct mjs;
 
 struct mjs_property {
     struct mjs_property* next; /* Linkage in struct mjs_object::properties */
+    uint32_t name_hash; /* Hash of the name, compared before the name itself */
     mjs_val_t name; /* Property name (a string) */
     mjs_val_t value; /* Property value */
 };
@@ -45,6 +46,23 @@ MJS_PRIVATE mjs_err_t mjs_set_internal(
     size_t name_len,
     mjs_val_t val);
 
+/*
+ * Returns hash of a property name, as stored in `mjs_property::name_hash`
+ */
+MJS_PRIVATE uint32_t mjs_property_name_hash(const char* name, size_t len);
+
+/*
+ * Inline cache of `obj.name` lookups, keyed by the global bcode offset of
+ * OP_GET. Only own properties of plain objects are cached. An entry stays
+ * valid while the property is linked to the object, so the whole cache is
+ * flushed when a property is deleted and on GC.
+ */
+MJS_PRIVATE struct mjs_property*
+    mjs_get_cache_lookup(struct mjs* mjs, size_t offset, mjs_val_t obj);
+MJS_PRIVATE void
+    mjs_get_cache_store(struct mjs* mjs, size_t offset, mjs_val_t obj, struct mjs_property* p);
+MJS_PRIVATE void mjs_get_cache_flush(struct mjs* mjs);
+
 /*
  * Implementation of `Object.create(proto)`
  */
@@ -132,6 +132,23 @@ mjs_val_t mjs_mk_string(struct mjs* mjs, const char* p, size_t len, int copy) {
     return (offset & ~MJS_TAG_MASK) | tag;
 }
 
+MJS_PRIVATE mjs_val_t
+    mjs_mk_string_literal(struct mjs* mjs, size_t offset, const char* p, size_t len) {
+    struct mjs_literal_cache_entry* e;
+    if(len <= 5) return mjs_mk_string(mjs, p, len, 1);
+
+    e = &mjs->literal_cache[offset % MJS_LITERAL_CACHE_SIZE];
+    if(e->offset != offset) {
+        e->offset = offset;
+        e->str = mjs_mk_string(mjs, p, len, 1);
+    }
+    return e->str;
+}
+
+MJS_PRIVATE void mjs_literal_cache_flush(struct mjs* mjs) {
+    memset(mjs->literal_cache, 0, sizeof(mjs->literal_cache));
+}
+
 /* Get a pointer to string and string length. */
 const char* mjs_get_string(struct mjs* mjs, mjs_val_t* v, size_t* sizep) {
     uint64_t tag = v[0] & MJS_TAG_MASK;
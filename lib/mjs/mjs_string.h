@@ -33,6 +33,15 @@ MJS_PRIVATE void embed_string(
 
 MJS_PRIVATE void mjs_mkstr(struct mjs* mjs);
 
+/*
+ * Makes a string of the literal pushed by OP_PUSH_STR at the given global
+ * bcode offset. Strings are immutable, so a literal too long to be inlined
+ * is interned: its owned string is reused until GC moves or frees it.
+ */
+MJS_PRIVATE mjs_val_t
+    mjs_mk_string_literal(struct mjs* mjs, size_t offset, const char* p, size_t len);
+MJS_PRIVATE void mjs_literal_cache_flush(struct mjs* mjs);
+
 MJS_PRIVATE void mjs_string_slice(struct mjs* mjs);
 MJS_PRIVATE void mjs_string_index_of(struct mjs* mjs);
 MJS_PRIVATE void mjs_string_char_code_at(struct mjs* mjs);
@@ -15,7 +15,6 @@
 #include "mjs_util.h"
 #include "mjs_tok.h"
 #include "mjs_array_buf.h"
-#include <furi.h>
 
 const char* mjs_typeof(mjs_val_t v) {
     return mjs_stringify_type(mjs_get_type(v));
@@ -154,7 +153,7 @@ MJS_PRIVATE size_t
     size_t llen;
     uint64_t n;
 
-    furi_assert(print_cb);
+    assert(print_cb);
 
     snprintf(buf, sizeof(buf), "%-3u\t%-8s", (unsigned)i, opcodetostr(code[i]));
 
@@ -13,6 +13,168 @@
 
 #define BEBIT(x, n) FURI_BIT(x, (n) ^ 24)
 
+// Filter function truth tables, same as packed nibble constants in crypto1_filter
+#define CRYPTO1_FILTER_A (0xF22C)
+#define CRYPTO1_FILTER_B (0xD938)
+#define CRYPTO1_FILTER_C (0xEC57E80A)
+
+#define CRYPTO1_BATCH_LANES_MASK (CRYPTO1_BATCH_LANES_SIZE - 1)
+
+/*
+ * Byte-at-a-time feedback tables.
+ * Without encrypted feed the LFSR feedback is linear, so 8 feedback bits produced by
+ * crypto1_byte can be computed as XOR of per-byte contributions of the odd and even
+ * registers and of the input byte. Bit N of table value is feedback bit of step N.
+ * Generated by clocking crypto1_bit with single non-zero byte in the state.
+ */
+static const uint8_t crypto1_feedback_odd[3][256] = {
+    {
+        0x00, 0x70, 0xDC, 0xAC, 0xB7, 0xC7, 0x6B, 0x1B, 0x25, 0x55, 0xF9, 0x89, 0x92, 0xE2, 0x4E,
+        0x3E, 0xF1, 0x81, 0x2D, 0x5D, 0x46, 0x36, 0x9A, 0xEA, 0xD4, 0xA4, 0x08, 0x78, 0x63, 0x13,
+        0xBF, 0xCF, 0x84, 0xF4, 0x58, 0x28, 0x33, 0x43, 0xEF, 0x9F, 0xA1, 0xD1, 0x7D, 0x0D, 0x16,
+        0x66, 0xCA, 0xBA, 0x75, 0x05, 0xA9, 0xD9, 0xC2, 0xB2, 0x1E, 0x6E, 0x50, 0x20, 0x8C, 0xFC,
+        0xE7, 0x97, 0x3B, 0x4B, 0xA1, 0xD1, 0x7D, 0x0D, 0x16, 0x66, 0xCA, 0xBA, 0x84, 0xF4, 0x58,
+        0x28, 0x33, 0x43, 0xEF, 0x9F, 0x50, 0x20, 0x8C, 0xFC, 0xE7, 0x97, 0x3B, 0x4B, 0x75, 0x05,
+        0xA9, 0xD9, 0xC2, 0xB2, 0x1E, 0x6E, 0x25, 0x55, 0xF9, 0x89, 0x92, 0xE2, 0x4E, 0x3E, 0x00,
+        0x70, 0xDC, 0xAC, 0xB7, 0xC7, 0x6B, 0x1B, 0xD4, 0xA4, 0x08, 0x78, 0x63, 0x13, 0xBF, 0xCF,
+        0xF1, 0x81, 0x2D, 0x5D, 0x46, 0x36, 0x9A, 0xEA, 0x50, 0x20, 0x8C, 0xFC, 0xE7, 0x97, 0x3B,
+        0x4B, 0x75, 0x05, 0xA9, 0xD9, 0xC2, 0xB2, 0x1E, 0x6E, 0xA1, 0xD1, 0x7D, 0x0D, 0x16, 0x66,
+        0xCA, 0xBA, 0x84, 0xF4, 0x58, 0x28, 0x33, 0x43, 0xEF, 0x9F, 0xD4, 0xA4, 0x08, 0x78, 0x63,
+        0x13, 0xBF, 0xCF, 0xF1, 0x81, 0x2D, 0x5D, 0x46, 0x36, 0x9A, 0xEA, 0x25, 0x55, 0xF9, 0x89,
+        0x92, 0xE2, 0x4E, 0x3E, 0x00, 0x70, 0xDC, 0xAC, 0xB7, 0xC7, 0x6B, 0x1B, 0xF1, 0x81, 0x2D,
+        0x5D, 0x46, 0x36, 0x9A, 0xEA, 0xD4, 0xA4, 0x08, 0x78, 0x63, 0x13, 0xBF, 0xCF, 0x00, 0x70,
+        0xDC, 0xAC, 0xB7, 0xC7, 0x6B, 0x1B, 0x25, 0x55, 0xF9, 0x89, 0x92, 0xE2, 0x4E, 0x3E, 0x75,
+        0x05, 0xA9, 0xD9, 0xC2, 0xB2, 0x1E, 0x6E, 0x50, 0x20, 0x8C, 0xFC, 0xE7, 0x97, 0x3B, 0x4B,
+        0x84, 0xF4, 0x58, 0x28, 0x33, 0x43, 0xEF, 0x9F, 0xA1, 0xD1, 0x7D, 0x0D, 0x16, 0x66, 0xCA,
+        0xBA},
+    {
+        0x00, 0x54, 0x55, 0x01, 0x6D, 0x39, 0x38, 0x6C, 0x63, 0x37, 0x36, 0x62, 0x0E, 0x5A, 0x5B,
+        0x0F, 0x50, 0x04, 0x05, 0x51, 0x3D, 0x69, 0x68, 0x3C, 0x33, 0x67, 0x66, 0x32, 0x5E, 0x0A,
+        0x0B, 0x5F, 0x54, 0x00, 0x01, 0x55, 0x39, 0x6D, 0x6C, 0x38, 0x37, 0x63, 0x62, 0x36, 0x5A,
+        0x0E, 0x0F, 0x5B, 0x04, 0x50, 0x51, 0x05, 0x69, 0x3D, 0x3C, 0x68, 0x67, 0x33, 0x32, 0x66,
+        0x0A, 0x5E, 0x5F, 0x0B, 0xD5, 0x81, 0x80, 0xD4, 0xB8, 0xEC, 0xED, 0xB9, 0xB6, 0xE2, 0xE3,
+        0xB7, 0xDB, 0x8F, 0x8E, 0xDA, 0x85, 0xD1, 0xD0, 0x84, 0xE8, 0xBC, 0xBD, 0xE9, 0xE6, 0xB2,
+        0xB3, 0xE7, 0x8B, 0xDF, 0xDE, 0x8A, 0x81, 0xD5, 0xD4, 0x80, 0xEC, 0xB8, 0xB9, 0xED, 0xE2,
+        0xB6, 0xB7, 0xE3, 0x8F, 0xDB, 0xDA, 0x8E, 0xD1, 0x85, 0x84, 0xD0, 0xBC, 0xE8, 0xE9, 0xBD,
+        0xB2, 0xE6, 0xE7, 0xB3, 0xDF, 0x8B, 0x8A, 0xDE, 0xCD, 0x99, 0x98, 0xCC, 0xA0, 0xF4, 0xF5,
+        0xA1, 0xAE, 0xFA, 0xFB, 0xAF, 0xC3, 0x97, 0x96, 0xC2, 0x9D, 0xC9, 0xC8, 0x9C, 0xF0, 0xA4,
+        0xA5, 0xF1, 0xFE, 0xAA, 0xAB, 0xFF, 0x93, 0xC7, 0xC6, 0x92, 0x99, 0xCD, 0xCC, 0x98, 0xF4,
+        0xA0, 0xA1, 0xF5, 0xFA, 0xAE, 0xAF, 0xFB, 0x97, 0xC3, 0xC2, 0x96, 0xC9, 0x9D, 0x9C, 0xC8,
+        0xA4, 0xF0, 0xF1, 0xA5, 0xAA, 0xFE, 0xFF, 0xAB, 0xC7, 0x93, 0x92, 0xC6, 0x18, 0x4C, 0x4D,
+        0x19, 0x75, 0x21, 0x20, 0x74, 0x7B, 0x2F, 0x2E, 0x7A, 0x16, 0x42, 0x43, 0x17, 0x48, 0x1C,
+        0x1D, 0x49, 0x25, 0x71, 0x70, 0x24, 0x2B, 0x7F, 0x7E, 0x2A, 0x46, 0x12, 0x13, 0x47, 0x4C,
+        0x18, 0x19, 0x4D, 0x21, 0x75, 0x74, 0x20, 0x2F, 0x7B, 0x7A, 0x2E, 0x42, 0x16, 0x17, 0x43,
+        0x1C, 0x48, 0x49, 0x1D, 0x71, 0x25, 0x24, 0x70, 0x7F, 0x2B, 0x2A, 0x7E, 0x12, 0x46, 0x47,
+        0x13},
+    {
+        0x00, 0x4B, 0xDA, 0x91, 0x06, 0x4D, 0xDC, 0x97, 0xF1, 0xBA, 0x2B, 0x60, 0xF7, 0xBC, 0x2D,
+        0x66, 0x04, 0x4F, 0xDE, 0x95, 0x02, 0x49, 0xD8, 0x93, 0xF5, 0xBE, 0x2F, 0x64, 0xF3, 0xB8,
+        0x29, 0x62, 0xC1, 0x8A, 0x1B, 0x50, 0xC7, 0x8C, 0x1D, 0x56, 0x30, 0x7B, 0xEA, 0xA1, 0x36,
+        0x7D, 0xEC, 0xA7, 0xC5, 0x8E, 0x1F, 0x54, 0xC3, 0x88, 0x19, 0x52, 0x34, 0x7F, 0xEE, 0xA5,
+        0x32, 0x79, 0xE8, 0xA3, 0x08, 0x43, 0xD2, 0x99, 0x0E, 0x45, 0xD4, 0x9F, 0xF9, 0xB2, 0x23,
+        0x68, 0xFF, 0xB4, 0x25, 0x6E, 0x0C, 0x47, 0xD6, 0x9D, 0x0A, 0x41, 0xD0, 0x9B, 0xFD, 0xB6,
+        0x27, 0x6C, 0xFB, 0xB0, 0x21, 0x6A, 0xC9, 0x82, 0x13, 0x58, 0xCF, 0x84, 0x15, 0x5E, 0x38,
+        0x73, 0xE2, 0xA9, 0x3E, 0x75, 0xE4, 0xAF, 0xCD, 0x86, 0x17, 0x5C, 0xCB, 0x80, 0x11, 0x5A,
+        0x3C, 0x77, 0xE6, 0xAD, 0x3A, 0x71, 0xE0, 0xAB, 0xC2, 0x89, 0x18, 0x53, 0xC4, 0x8F, 0x1E,
+        0x55, 0x33, 0x78, 0xE9, 0xA2, 0x35, 0x7E, 0xEF, 0xA4, 0xC6, 0x8D, 0x1C, 0x57, 0xC0, 0x8B,
+        0x1A, 0x51, 0x37, 0x7C, 0xED, 0xA6, 0x31, 0x7A, 0xEB, 0xA0, 0x03, 0x48, 0xD9, 0x92, 0x05,
+        0x4E, 0xDF, 0x94, 0xF2, 0xB9, 0x28, 0x63, 0xF4, 0xBF, 0x2E, 0x65, 0x07, 0x4C, 0xDD, 0x96,
+        0x01, 0x4A, 0xDB, 0x90, 0xF6, 0xBD, 0x2C, 0x67, 0xF0, 0xBB, 0x2A, 0x61, 0xCA, 0x81, 0x10,
+        0x5B, 0xCC, 0x87, 0x16, 0x5D, 0x3B, 0x70, 0xE1, 0xAA, 0x3D, 0x76, 0xE7, 0xAC, 0xCE, 0x85,
+        0x14, 0x5F, 0xC8, 0x83, 0x12, 0x59, 0x3F, 0x74, 0xE5, 0xAE, 0x39, 0x72, 0xE3, 0xA8, 0x0B,
+        0x40, 0xD1, 0x9A, 0x0D, 0x46, 0xD7, 0x9C, 0xFA, 0xB1, 0x20, 0x6B, 0xFC, 0xB7, 0x26, 0x6D,
+        0x0F, 0x44, 0xD5, 0x9E, 0x09, 0x42, 0xD3, 0x98, 0xFE, 0xB5, 0x24, 0x6F, 0xF8, 0xB3, 0x22,
+        0x69},
+};
+
+static const uint8_t crypto1_feedback_even[3][256] = {
+    {
+        0x00, 0xB8, 0x6E, 0xD6, 0xAB, 0x13, 0xC5, 0x7D, 0xE2, 0x5A, 0x8C, 0x34, 0x49, 0xF1, 0x27,
+        0x9F, 0x08, 0xB0, 0x66, 0xDE, 0xA3, 0x1B, 0xCD, 0x75, 0xEA, 0x52, 0x84, 0x3C, 0x41, 0xF9,
+        0x2F, 0x97, 0x42, 0xFA, 0x2C, 0x94, 0xE9, 0x51, 0x87, 0x3F, 0xA0, 0x18, 0xCE, 0x76, 0x0B,
+        0xB3, 0x65, 0xDD, 0x4A, 0xF2, 0x24, 0x9C, 0xE1, 0x59, 0x8F, 0x37, 0xA8, 0x10, 0xC6, 0x7E,
+        0x03, 0xBB, 0x6D, 0xD5, 0xA0, 0x18, 0xCE, 0x76, 0x0B, 0xB3, 0x65, 0xDD, 0x42, 0xFA, 0x2C,
+        0x94, 0xE9, 0x51, 0x87, 0x3F, 0xA8, 0x10, 0xC6, 0x7E, 0x03, 0xBB, 0x6D, 0xD5, 0x4A, 0xF2,
+        0x24, 0x9C, 0xE1, 0x59, 0x8F, 0x37, 0xE2, 0x5A, 0x8C, 0x34, 0x49, 0xF1, 0x27, 0x9F, 0x00,
+        0xB8, 0x6E, 0xD6, 0xAB, 0x13, 0xC5, 0x7D, 0xEA, 0x52, 0x84, 0x3C, 0x41, 0xF9, 0x2F, 0x97,
+        0x08, 0xB0, 0x66, 0xDE, 0xA3, 0x1B, 0xCD, 0x75, 0xA8, 0x10, 0xC6, 0x7E, 0x03, 0xBB, 0x6D,
+        0xD5, 0x4A, 0xF2, 0x24, 0x9C, 0xE1, 0x59, 0x8F, 0x37, 0xA0, 0x18, 0xCE, 0x76, 0x0B, 0xB3,
+        0x65, 0xDD, 0x42, 0xFA, 0x2C, 0x94, 0xE9, 0x51, 0x87, 0x3F, 0xEA, 0x52, 0x84, 0x3C, 0x41,
+        0xF9, 0x2F, 0x97, 0x08, 0xB0, 0x66, 0xDE, 0xA3, 0x1B, 0xCD, 0x75, 0xE2, 0x5A, 0x8C, 0x34,
+        0x49, 0xF1, 0x27, 0x9F, 0x00, 0xB8, 0x6E, 0xD6, 0xAB, 0x13, 0xC5, 0x7D, 0x08, 0xB0, 0x66,
+        0xDE, 0xA3, 0x1B, 0xCD, 0x75, 0xEA, 0x52, 0x84, 0x3C, 0x41, 0xF9, 0x2F, 0x97, 0x00, 0xB8,
+        0x6E, 0xD6, 0xAB, 0x13, 0xC5, 0x7D, 0xE2, 0x5A, 0x8C, 0x34, 0x49, 0xF1, 0x27, 0x9F, 0x4A,
+        0xF2, 0x24, 0x9C, 0xE1, 0x59, 0x8F, 0x37, 0xA8, 0x10, 0xC6, 0x7E, 0x03, 0xBB, 0x6D, 0xD5,
+        0x42, 0xFA, 0x2C, 0x94, 0xE9, 0x51, 0x87, 0x3F, 0xA0, 0x18, 0xCE, 0x76, 0x0B, 0xB3, 0x65,
+        0xDD},
+    {
+        0x00, 0xAA, 0xDA, 0x70, 0xC6, 0x6C, 0x1C, 0xB6, 0x41, 0xEB, 0x9B, 0x31, 0x87, 0x2D, 0x5D,
+        0xF7, 0xA8, 0x02, 0x72, 0xD8, 0x6E, 0xC4, 0xB4, 0x1E, 0xE9, 0x43, 0x33, 0x99, 0x2F, 0x85,
+        0xF5, 0x5F, 0xAA, 0x00, 0x70, 0xDA, 0x6C, 0xC6, 0xB6, 0x1C, 0xEB, 0x41, 0x31, 0x9B, 0x2D,
+        0x87, 0xF7, 0x5D, 0x02, 0xA8, 0xD8, 0x72, 0xC4, 0x6E, 0x1E, 0xB4, 0x43, 0xE9, 0x99, 0x33,
+        0x85, 0x2F, 0x5F, 0xF5, 0x9A, 0x30, 0x40, 0xEA, 0x5C, 0xF6, 0x86, 0x2C, 0xDB, 0x71, 0x01,
+        0xAB, 0x1D, 0xB7, 0xC7, 0x6D, 0x32, 0x98, 0xE8, 0x42, 0xF4, 0x5E, 0x2E, 0x84, 0x73, 0xD9,
+        0xA9, 0x03, 0xB5, 0x1F, 0x6F, 0xC5, 0x30, 0x9A, 0xEA, 0x40, 0xF6, 0x5C, 0x2C, 0x86, 0x71,
+        0xDB, 0xAB, 0x01, 0xB7, 0x1D, 0x6D, 0xC7, 0x98, 0x32, 0x42, 0xE8, 0x5E, 0xF4, 0x84, 0x2E,
+        0xD9, 0x73, 0x03, 0xA9, 0x1F, 0xB5, 0xC5, 0x6F, 0x96, 0x3C, 0x4C, 0xE6, 0x50, 0xFA, 0x8A,
+        0x20, 0xD7, 0x7D, 0x0D, 0xA7, 0x11, 0xBB, 0xCB, 0x61, 0x3E, 0x94, 0xE4, 0x4E, 0xF8, 0x52,
+        0x22, 0x88, 0x7F, 0xD5, 0xA5, 0x0F, 0xB9, 0x13, 0x63, 0xC9, 0x3C, 0x96, 0xE6, 0x4C, 0xFA,
+        0x50, 0x20, 0x8A, 0x7D, 0xD7, 0xA7, 0x0D, 0xBB, 0x11, 0x61, 0xCB, 0x94, 0x3E, 0x4E, 0xE4,
+        0x52, 0xF8, 0x88, 0x22, 0xD5, 0x7F, 0x0F, 0xA5, 0x13, 0xB9, 0xC9, 0x63, 0x0C, 0xA6, 0xD6,
+        0x7C, 0xCA, 0x60, 0x10, 0xBA, 0x4D, 0xE7, 0x97, 0x3D, 0x8B, 0x21, 0x51, 0xFB, 0xA4, 0x0E,
+        0x7E, 0xD4, 0x62, 0xC8, 0xB8, 0x12, 0xE5, 0x4F, 0x3F, 0x95, 0x23, 0x89, 0xF9, 0x53, 0xA6,
+        0x0C, 0x7C, 0xD6, 0x60, 0xCA, 0xBA, 0x10, 0xE7, 0x4D, 0x3D, 0x97, 0x21, 0x8B, 0xFB, 0x51,
+        0x0E, 0xA4, 0xD4, 0x7E, 0xC8, 0x62, 0x12, 0xB8, 0x4F, 0xE5, 0x95, 0x3F, 0x89, 0x23, 0x53,
+        0xF9},
+    {
+        0x00, 0x55, 0xED, 0xB8, 0x03, 0x56, 0xEE, 0xBB, 0x08, 0x5D, 0xE5, 0xB0, 0x0B, 0x5E, 0xE6,
+        0xB3, 0x82, 0xD7, 0x6F, 0x3A, 0x81, 0xD4, 0x6C, 0x39, 0x8A, 0xDF, 0x67, 0x32, 0x89, 0xDC,
+        0x64, 0x31, 0x10, 0x45, 0xFD, 0xA8, 0x13, 0x46, 0xFE, 0xAB, 0x18, 0x4D, 0xF5, 0xA0, 0x1B,
+        0x4E, 0xF6, 0xA3, 0x92, 0xC7, 0x7F, 0x2A, 0x91, 0xC4, 0x7C, 0x29, 0x9A, 0xCF, 0x77, 0x22,
+        0x99, 0xCC, 0x74, 0x21, 0x84, 0xD1, 0x69, 0x3C, 0x87, 0xD2, 0x6A, 0x3F, 0x8C, 0xD9, 0x61,
+        0x34, 0x8F, 0xDA, 0x62, 0x37, 0x06, 0x53, 0xEB, 0xBE, 0x05, 0x50, 0xE8, 0xBD, 0x0E, 0x5B,
+        0xE3, 0xB6, 0x0D, 0x58, 0xE0, 0xB5, 0x94, 0xC1, 0x79, 0x2C, 0x97, 0xC2, 0x7A, 0x2F, 0x9C,
+        0xC9, 0x71, 0x24, 0x9F, 0xCA, 0x72, 0x27, 0x16, 0x43, 0xFB, 0xAE, 0x15, 0x40, 0xF8, 0xAD,
+        0x1E, 0x4B, 0xF3, 0xA6, 0x1D, 0x48, 0xF0, 0xA5, 0xE1, 0xB4, 0x0C, 0x59, 0xE2, 0xB7, 0x0F,
+        0x5A, 0xE9, 0xBC, 0x04, 0x51, 0xEA, 0xBF, 0x07, 0x52, 0x63, 0x36, 0x8E, 0xDB, 0x60, 0x35,
+        0x8D, 0xD8, 0x6B, 0x3E, 0x86, 0xD3, 0x68, 0x3D, 0x85, 0xD0, 0xF1, 0xA4, 0x1C, 0x49, 0xF2,
+        0xA7, 0x1F, 0x4A, 0xF9, 0xAC, 0x14, 0x41, 0xFA, 0xAF, 0x17, 0x42, 0x73, 0x26, 0x9E, 0xCB,
+        0x70, 0x25, 0x9D, 0xC8, 0x7B, 0x2E, 0x96, 0xC3, 0x78, 0x2D, 0x95, 0xC0, 0x65, 0x30, 0x88,
+        0xDD, 0x66, 0x33, 0x8B, 0xDE, 0x6D, 0x38, 0x80, 0xD5, 0x6E, 0x3B, 0x83, 0xD6, 0xE7, 0xB2,
+        0x0A, 0x5F, 0xE4, 0xB1, 0x09, 0x5C, 0xEF, 0xBA, 0x02, 0x57, 0xEC, 0xB9, 0x01, 0x54, 0x75,
+        0x20, 0x98, 0xCD, 0x76, 0x23, 0x9B, 0xCE, 0x7D, 0x28, 0x90, 0xC5, 0x7E, 0x2B, 0x93, 0xC6,
+        0xF7, 0xA2, 0x1A, 0x4F, 0xF4, 0xA1, 0x19, 0x4C, 0xFF, 0xAA, 0x12, 0x47, 0xFC, 0xA9, 0x11,
+        0x44},
+};
+
+static const uint8_t crypto1_feedback_in[256] = {
+    0x00, 0xE1, 0xC2, 0x23, 0x84, 0x65, 0x46, 0xA7, 0x08, 0xE9, 0xCA, 0x2B, 0x8C, 0x6D, 0x4E, 0xAF,
+    0x10, 0xF1, 0xD2, 0x33, 0x94, 0x75, 0x56, 0xB7, 0x18, 0xF9, 0xDA, 0x3B, 0x9C, 0x7D, 0x5E, 0xBF,
+    0x20, 0xC1, 0xE2, 0x03, 0xA4, 0x45, 0x66, 0x87, 0x28, 0xC9, 0xEA, 0x0B, 0xAC, 0x4D, 0x6E, 0x8F,
+    0x30, 0xD1, 0xF2, 0x13, 0xB4, 0x55, 0x76, 0x97, 0x38, 0xD9, 0xFA, 0x1B, 0xBC, 0x5D, 0x7E, 0x9F,
+    0x40, 0xA1, 0x82, 0x63, 0xC4, 0x25, 0x06, 0xE7, 0x48, 0xA9, 0x8A, 0x6B, 0xCC, 0x2D, 0x0E, 0xEF,
+    0x50, 0xB1, 0x92, 0x73, 0xD4, 0x35, 0x16, 0xF7, 0x58, 0xB9, 0x9A, 0x7B, 0xDC, 0x3D, 0x1E, 0xFF,
+    0x60, 0x81, 0xA2, 0x43, 0xE4, 0x05, 0x26, 0xC7, 0x68, 0x89, 0xAA, 0x4B, 0xEC, 0x0D, 0x2E, 0xCF,
+    0x70, 0x91, 0xB2, 0x53, 0xF4, 0x15, 0x36, 0xD7, 0x78, 0x99, 0xBA, 0x5B, 0xFC, 0x1D, 0x3E, 0xDF,
+    0x80, 0x61, 0x42, 0xA3, 0x04, 0xE5, 0xC6, 0x27, 0x88, 0x69, 0x4A, 0xAB, 0x0C, 0xED, 0xCE, 0x2F,
+    0x90, 0x71, 0x52, 0xB3, 0x14, 0xF5, 0xD6, 0x37, 0x98, 0x79, 0x5A, 0xBB, 0x1C, 0xFD, 0xDE, 0x3F,
+    0xA0, 0x41, 0x62, 0x83, 0x24, 0xC5, 0xE6, 0x07, 0xA8, 0x49, 0x6A, 0x8B, 0x2C, 0xCD, 0xEE, 0x0F,
+    0xB0, 0x51, 0x72, 0x93, 0x34, 0xD5, 0xF6, 0x17, 0xB8, 0x59, 0x7A, 0x9B, 0x3C, 0xDD, 0xFE, 0x1F,
+    0xC0, 0x21, 0x02, 0xE3, 0x44, 0xA5, 0x86, 0x67, 0xC8, 0x29, 0x0A, 0xEB, 0x4C, 0xAD, 0x8E, 0x6F,
+    0xD0, 0x31, 0x12, 0xF3, 0x54, 0xB5, 0x96, 0x77, 0xD8, 0x39, 0x1A, 0xFB, 0x5C, 0xBD, 0x9E, 0x7F,
+    0xE0, 0x01, 0x22, 0xC3, 0x64, 0x85, 0xA6, 0x47, 0xE8, 0x09, 0x2A, 0xCB, 0x6C, 0x8D, 0xAE, 0x4F,
+    0xF0, 0x11, 0x32, 0xD3, 0x74, 0x95, 0xB6, 0x57, 0xF8, 0x19, 0x3A, 0xDB, 0x7C, 0x9D, 0xBE,
+    0x5F};
+
+/*
+ * Bit offsets of the LFSR taps and filter inputs in the bit-sliced history,
+ * odd register bit N is at offset 2N, even register bit N is at offset 2N + 1.
+ */
+static const uint8_t crypto1_batch_taps[] = {
+    4, 6, 8, 12, 18, 20, 22, 28, 30, 32, 38, 42, // LF_POLY_ODD
+    5, 23, 33, 35, 37, 47, // LF_POLY_EVEN
+};
+
 Crypto1* crypto1_alloc(void) {
     Crypto1* instance = malloc(sizeof(Crypto1));
 
@@ -64,8 +226,7 @@ uint8_t crypto1_bit(Crypto1* crypto1, uint8_t in, int is_encrypted) {
     return out;
 }
 
-uint8_t crypto1_byte(Crypto1* crypto1, uint8_t in, int is_encrypted) {
-    furi_assert(crypto1);
+static uint8_t crypto1_byte_bitwise(Crypto1* crypto1, uint8_t in, int is_encrypted) {
     uint8_t out = 0;
     for(uint8_t i = 0; i < 8; i++) {
         out |= crypto1_bit(crypto1, FURI_BIT(in, i), is_encrypted) << i;
@@ -73,15 +234,142 @@ uint8_t crypto1_byte(Crypto1* crypto1, uint8_t in, int is_encrypted) {
     return out;
 }
 
+static uint8_t crypto1_byte_table(Crypto1* crypto1, uint8_t in) {
+    uint32_t odd = crypto1->odd;
+    uint32_t even = crypto1->even;
+
+    uint8_t feed = crypto1_feedback_in[in];
+    feed ^= crypto1_feedback_odd[0][odd & 0xFF] ^ crypto1_feedback_even[0][even & 0xFF];
+    feed ^= crypto1_feedback_odd[1][odd >> 8 & 0xFF] ^ crypto1_feedback_even[1][even >> 8 & 0xFF];
+    feed ^= crypto1_feedback_odd[2][odd >> 16 & 0xFF] ^
+            crypto1_feedback_even[2][even >> 16 & 0xFF];
+
+    // Registers swap on every step, so odd gets even steps feedback and vice versa
+    odd = odd << 4 | FURI_BIT(feed, 1) << 3 | FURI_BIT(feed, 3) << 2 | FURI_BIT(feed, 5) << 1 |
+          FURI_BIT(feed, 7);
+    even = even << 4 | FURI_BIT(feed, 0) << 3 | FURI_BIT(feed, 2) << 2 | FURI_BIT(feed, 4) << 1 |
+           FURI_BIT(feed, 6);
+
+    uint8_t out = 0;
+    for(uint8_t i = 0; i < 4; i++) {
+        out |= crypto1_filter(odd >> (4 - i)) << (2 * i);
+        out |= crypto1_filter(even >> (3 - i)) << (2 * i + 1);
+    }
+
+    crypto1->odd = odd;
+    crypto1->even = even;
+
+    return out;
+}
+
+uint8_t crypto1_byte(Crypto1* crypto1, uint8_t in, int is_encrypted) {
+    furi_assert(crypto1);
+    // Encrypted feed makes feedback depend on filter output, only bitwise path is possible
+    if(is_encrypted) {
+        return crypto1_byte_bitwise(crypto1, in, is_encrypted);
+    } else {
+        return crypto1_byte_table(crypto1, in);
+    }
+}
+
 uint32_t crypto1_word(Crypto1* crypto1, uint32_t in, int is_encrypted) {
     furi_assert(crypto1);
     uint32_t out = 0;
-    for(uint8_t i = 0; i < 32; i++) {
-        out |= (uint32_t)crypto1_bit(crypto1, BEBIT(in, i), is_encrypted) << (24 ^ i);
+    if(is_encrypted) {
+        for(uint8_t i = 0; i < 32; i++) {
+            out |= (uint32_t)crypto1_bit(crypto1, BEBIT(in, i), is_encrypted) << (24 ^ i);
+        }
+    } else {
+        // Bytes are clocked from most significant one, bits from least significant one
+        for(int8_t i = 24; i >= 0; i -= 8) {
+            out |= (uint32_t)crypto1_byte_table(crypto1, in >> i & 0xFF) << i;
+        }
+    }
+    return out;
+}
+
+static uint32_t crypto1_batch_lut(uint32_t table, const uint32_t* inputs, size_t input_count) {
+    // Bit-sliced multiplexer tree, inputs[0] selects between adjacent table bits
+    uint32_t level[16];
+    size_t level_count = 1U << (input_count - 1);
+    for(size_t i = 0; i < level_count; i++) {
+        uint32_t low = FURI_BIT(table, 2 * i) ? UINT32_MAX : 0;
+        uint32_t high = FURI_BIT(table, 2 * i + 1) ? UINT32_MAX : 0;
+        level[i] = low ^ ((low ^ high) & inputs[0]);
+    }
+    for(size_t input = 1; input < input_count; input++) {
+        level_count /= 2;
+        for(size_t i = 0; i < level_count; i++) {
+            level[i] = level[2 * i] ^ ((level[2 * i] ^ level[2 * i + 1]) & inputs[input]);
+        }
     }
+    return level[0];
+}
+
+static inline uint32_t crypto1_batch_history(const Crypto1Batch* batch, uint8_t offset) {
+    return batch->lanes[(batch->head - offset) & CRYPTO1_BATCH_LANES_MASK];
+}
+
+static uint32_t crypto1_batch_filter(const Crypto1Batch* batch) {
+    uint32_t nibble[4];
+    uint32_t index[5];
+    // Same layout as crypto1_filter: nibble N of odd register gives bit 4 - N of index
+    for(uint8_t i = 0; i < 5; i++) {
+        for(uint8_t j = 0; j < 4; j++) {
+            nibble[j] = crypto1_batch_history(batch, 2 * (4 * i + j));
+        }
+        uint32_t table = (i == 1 || i == 4) ? CRYPTO1_FILTER_B : CRYPTO1_FILTER_A;
+        index[4 - i] = crypto1_batch_lut(table, nibble, COUNT_OF(nibble));
+    }
+    return crypto1_batch_lut(CRYPTO1_FILTER_C, index, COUNT_OF(index));
+}
+
+void crypto1_batch_init(Crypto1Batch* batch, const uint64_t* keys, size_t key_count) {
+    furi_assert(batch);
+    furi_assert(keys);
+    furi_assert(key_count <= CRYPTO1_BATCH_SIZE);
+
+    memset(batch, 0, sizeof(Crypto1Batch));
+    // Same bit order as crypto1_init: history offset N holds key bit N ^ 7
+    batch->head = CRYPTO1_BATCH_STATE_SIZE - 1;
+    for(size_t lane = 0; lane < key_count; lane++) {
+        for(uint8_t offset = 0; offset < CRYPTO1_BATCH_STATE_SIZE; offset++) {
+            uint32_t bit = FURI_BIT(keys[lane], offset ^ 7);
+            batch->lanes[batch->head - offset] |= bit << lane;
+        }
+    }
+}
+
+uint32_t crypto1_batch_bit(Crypto1Batch* batch, uint32_t in, int is_encrypted) {
+    furi_assert(batch);
+
+    uint32_t out = crypto1_batch_filter(batch);
+    uint32_t feed = is_encrypted ? out : 0;
+    feed ^= in;
+    for(size_t i = 0; i < COUNT_OF(crypto1_batch_taps); i++) {
+        feed ^= crypto1_batch_history(batch, crypto1_batch_taps[i]);
+    }
+
+    batch->head = (batch->head + 1) & CRYPTO1_BATCH_LANES_MASK;
+    batch->lanes[batch->head] = feed;
+
     return out;
 }
 
+void crypto1_batch_word(Crypto1Batch* batch, uint32_t in, int is_encrypted, uint32_t* out) {
+    furi_assert(batch);
+    furi_assert(out);
+
+    memset(out, 0, sizeof(uint32_t) * CRYPTO1_BATCH_SIZE);
+    for(uint8_t i = 0; i < 32; i++) {
+        uint32_t in_lanes = BEBIT(in, i) ? UINT32_MAX : 0;
+        uint32_t out_lanes = crypto1_batch_bit(batch, in_lanes, is_encrypted);
+        for(size_t lane = 0; lane < CRYPTO1_BATCH_SIZE; lane++) {
+            out[lane] |= (uint32_t)FURI_BIT(out_lanes, lane) << (24 ^ i);
+        }
+    }
+}
+
 uint32_t prng_successor(uint32_t x, uint32_t n) {
     SWAPENDIAN(x);
     while(n--)
@@ -11,6 +11,19 @@ typedef struct {
     uint32_t even;
 } Crypto1;
 
+#define CRYPTO1_BATCH_SIZE       (32U)
+#define CRYPTO1_BATCH_STATE_SIZE (48U)
+#define CRYPTO1_BATCH_LANES_SIZE (64U)
+
+/**
+ * Bit-sliced Crypto1 state for CRYPTO1_BATCH_SIZE keys at once.
+ * Bit N of every history word belongs to key N.
+ */
+typedef struct {
+    uint32_t lanes[CRYPTO1_BATCH_LANES_SIZE];
+    uint8_t head;
+} Crypto1Batch;
+
 Crypto1* crypto1_alloc(void);
 
 void crypto1_free(Crypto1* instance);
@@ -25,6 +38,37 @@ uint8_t crypto1_byte(Crypto1* crypto1, uint8_t in, int is_encrypted);
 
 uint32_t crypto1_word(Crypto1* crypto1, uint32_t in, int is_encrypted);
 
+/**
+ * Initialize bit-sliced state with up to CRYPTO1_BATCH_SIZE keys.
+ *
+ * Unused lanes are initialized with zero key.
+ *
+ * @param batch pointer to the Crypto1Batch instance
+ * @param keys array of keys
+ * @param key_count number of keys, must not exceed CRYPTO1_BATCH_SIZE
+ */
+void crypto1_batch_init(Crypto1Batch* batch, const uint64_t* keys, size_t key_count);
+
+/**
+ * Clock all lanes once, same as crypto1_bit() for each key.
+ *
+ * @param batch pointer to the Crypto1Batch instance
+ * @param in input bits, bit N is fed to key N
+ * @param is_encrypted feed filter output back to the LFSR
+ * @return filter output bits, bit N belongs to key N
+ */
+uint32_t crypto1_batch_bit(Crypto1Batch* batch, uint32_t in, int is_encrypted);
+
+/**
+ * Clock all lanes with the same word, same as crypto1_word() for each key.
+ *
+ * @param batch pointer to the Crypto1Batch instance
+ * @param in input word, common for all keys
+ * @param is_encrypted feed filter output back to the LFSR
+ * @param out array of CRYPTO1_BATCH_SIZE words, element N is keystream of key N
+ */
+void crypto1_batch_word(Crypto1Batch* batch, uint32_t in, int is_encrypted, uint32_t* out);
+
 void crypto1_decrypt(Crypto1* crypto, const BitBuffer* buff, BitBuffer* out);
 
 void crypto1_encrypt(Crypto1* crypto, uint8_t* keystream, const BitBuffer* buff, BitBuffer* out);
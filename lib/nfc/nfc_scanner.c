@@ -23,6 +23,12 @@ typedef enum {
     NfcScannerSessionStateStopRequest,
 } NfcScannerSessionState;
 
+// Shared by all scanner instances, applications allocate a new one for every scan
+static NfcScannerStats nfc_scanner_stats = {};
+static NfcScannerProtocolStats nfc_scanner_protocol_stats[NfcProtocolNum] = {};
+// Created on first use and kept, as the stats are
+static FuriMutex* nfc_scanner_stats_mutex = NULL;
+
 struct NfcScanner {
     Nfc* nfc;
     NfcScannerState state;
@@ -51,9 +57,85 @@ struct NfcScanner {
 
     NfcProtocol current_protocol;
 
+    uint32_t scan_start;
+    uint32_t scan_misses;
+
     FuriThread* scan_worker;
 };
 
+static size_t nfc_scanner_latency_bucket(uint32_t latency) {
+    size_t bucket = 0;
+    while(latency && bucket < NFC_SCANNER_LATENCY_BUCKETS - 1) {
+        latency >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+static void nfc_scanner_stats_acquire(void) {
+    if(!nfc_scanner_stats_mutex) {
+        FuriMutex* mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+
+        FURI_CRITICAL_ENTER();
+        if(!nfc_scanner_stats_mutex) {
+            nfc_scanner_stats_mutex = mutex;
+            mutex = NULL;
+        }
+        FURI_CRITICAL_EXIT();
+
+        if(mutex) furi_mutex_free(mutex);
+    }
+
+    furi_check(furi_mutex_acquire(nfc_scanner_stats_mutex, FuriWaitForever) == FuriStatusOk);
+}
+
+static void nfc_scanner_stats_release(void) {
+    furi_check(furi_mutex_release(nfc_scanner_stats_mutex) == FuriStatusOk);
+}
+
+static bool nfc_scanner_detect(NfcScanner* instance, NfcProtocol protocol) {
+    const uint32_t start = furi_get_tick();
+
+    NfcPoller* poller = nfc_poller_alloc(instance->nfc, protocol);
+    bool protocol_detected = nfc_poller_detect(poller);
+    nfc_poller_free(poller);
+
+    const size_t bucket = nfc_scanner_latency_bucket(furi_get_tick() - start);
+
+    nfc_scanner_stats_acquire();
+    NfcScannerProtocolStats* stats = &nfc_scanner_protocol_stats[protocol];
+    stats->attempts++;
+    if(protocol_detected) {
+        stats->detections++;
+        stats->hit_latency[bucket]++;
+    } else {
+        stats->miss_latency[bucket]++;
+    }
+    nfc_scanner_stats_release();
+
+    return protocol_detected;
+}
+
+static void nfc_scanner_sort_base_protocols(NfcScanner* instance) {
+    uint32_t detections[NfcProtocolNum];
+
+    nfc_scanner_stats_acquire();
+    for(size_t i = 0; i < NfcProtocolNum; i++) {
+        detections[i] = nfc_scanner_protocol_stats[i].detections;
+    }
+    nfc_scanner_stats_release();
+
+    // Stable insertion sort, the default order is kept for the same number of detections
+    for(size_t i = 1; i < instance->base_protocols_num; i++) {
+        const NfcProtocol protocol = instance->base_protocols[i];
+        size_t j = i;
+        for(; j > 0 && detections[instance->base_protocols[j - 1]] < detections[protocol]; j--) {
+            instance->base_protocols[j] = instance->base_protocols[j - 1];
+        }
+        instance->base_protocols[j] = protocol;
+    }
+}
+
 static void nfc_scanner_reset(NfcScanner* instance) {
     instance->base_protocols_idx = 0;
     instance->base_protocols_num = 0;
@@ -79,6 +161,11 @@ void nfc_scanner_state_handler_idle(NfcScanner* instance) {
     }
     FURI_LOG_D(TAG, "Found %zu base protocols", instance->base_protocols_num);
 
+    // Greedy scan still tries all of them, the most likely protocol is detected sooner
+    nfc_scanner_sort_base_protocols(instance);
+
+    instance->scan_start = furi_get_tick();
+    instance->scan_misses = 0;
     instance->first_detected_protocol = NfcProtocolInvalid;
     instance->state = NfcScannerStateTryBasePollers;
 }
@@ -92,9 +179,7 @@ void nfc_scanner_state_handler_try_base_pollers(NfcScanner* instance) {
             break;
         }
 
-        NfcPoller* poller = nfc_poller_alloc(instance->nfc, instance->current_protocol);
-        bool protocol_detected = nfc_poller_detect(poller);
-        nfc_poller_free(poller);
+        bool protocol_detected = nfc_scanner_detect(instance, instance->current_protocol);
 
         if(protocol_detected) {
             instance->detected_protocols[instance->detected_protocols_num] =
@@ -108,7 +193,16 @@ void nfc_scanner_state_handler_try_base_pollers(NfcScanner* instance) {
             if(instance->first_detected_protocol == NfcProtocolInvalid) {
                 instance->first_detected_protocol = instance->current_protocol;
                 instance->current_protocol = NfcProtocolInvalid;
+
+                nfc_scanner_stats_acquire();
+                nfc_scanner_stats.scans++;
+                nfc_scanner_stats.last_scan_misses = instance->scan_misses;
+                nfc_scanner_stats.last_scan_detection_time =
+                    furi_get_tick() - instance->scan_start;
+                nfc_scanner_stats_release();
             }
+        } else if(instance->first_detected_protocol == NfcProtocolInvalid) {
+            instance->scan_misses++;
         }
 
         instance->base_protocols_idx =
@@ -139,9 +233,7 @@ void nfc_scanner_state_handler_detect_children_protocols(NfcScanner* instance) {
 
     instance->current_protocol = instance->children_protocols[instance->children_protocols_idx];
 
-    NfcPoller* poller = nfc_poller_alloc(instance->nfc, instance->current_protocol);
-    bool protocol_detected = nfc_poller_detect(poller);
-    nfc_poller_free(poller);
+    bool protocol_detected = nfc_scanner_detect(instance, instance->current_protocol);
 
     if(protocol_detected) {
         instance->detected_protocols[instance->detected_protocols_num] =
@@ -173,7 +265,10 @@ static void nfc_scanner_filter_detected_protocols(NfcScanner* instance) {
     }
 
     instance->detected_protocols_num = filtered_protocols_num;
-    memcpy(instance->detected_protocols, filtered_protocols, filtered_protocols_num);
+    memcpy(
+        instance->detected_protocols,
+        filtered_protocols,
+        filtered_protocols_num * sizeof(NfcProtocol));
 }
 
 void nfc_scanner_state_handler_complete(NfcScanner* instance) {
@@ -266,3 +361,27 @@ void nfc_scanner_stop(NfcScanner* instance) {
     instance->context = NULL;
     instance->state = NfcScannerStateIdle;
 }
+
+void nfc_scanner_get_stats(NfcScannerStats* stats) {
+    furi_check(stats);
+
+    nfc_scanner_stats_acquire();
+    *stats = nfc_scanner_stats;
+    nfc_scanner_stats_release();
+}
+
+void nfc_scanner_get_protocol_stats(NfcProtocol protocol, NfcScannerProtocolStats* stats) {
+    furi_check(protocol < NfcProtocolNum);
+    furi_check(stats);
+
+    nfc_scanner_stats_acquire();
+    *stats = nfc_scanner_protocol_stats[protocol];
+    nfc_scanner_stats_release();
+}
+
+void nfc_scanner_reset_stats(void) {
+    nfc_scanner_stats_acquire();
+    memset(&nfc_scanner_stats, 0, sizeof(nfc_scanner_stats));
+    memset(nfc_scanner_protocol_stats, 0, sizeof(nfc_scanner_protocol_stats));
+    nfc_scanner_stats_release();
+}
@@ -11,6 +11,10 @@
  *
  * If no supported cards are in the vicinity, the scanning process will continue
  * until stopped explicitly.
+ *
+ * Base protocols are tried in order of their detection count since boot, so the
+ * protocol of the previously scanned cards is detected first. Detection statistics
+ * can be obtained with nfc_scanner_get_stats() and nfc_scanner_get_protocol_stats().
  */
 #pragma once
 
@@ -49,6 +53,37 @@ typedef struct {
     NfcScannerEventData data; /**< Event-specific data. Handled accordingly to the even type. */
 } NfcScannerEvent;
 
+/**
+ * @brief Number of buckets in detection latency histograms.
+ *
+ * Bucket 0 counts detection attempts shorter than 1 ms, bucket N counts
+ * attempts lasting from 2^(N-1) to 2^N - 1 ms. The last bucket counts
+ * all the longer attempts as well.
+ */
+#define NFC_SCANNER_LATENCY_BUCKETS (8)
+
+/**
+ * @brief Detection statistics of a single protocol.
+ */
+typedef struct {
+    uint32_t attempts; /**< Number of detection attempts. */
+    uint32_t detections; /**< Number of successful detection attempts. */
+    uint32_t hit_latency[NFC_SCANNER_LATENCY_BUCKETS]; /**< Successful attempts histogram. */
+    uint32_t miss_latency[NFC_SCANNER_LATENCY_BUCKETS]; /**< Failed attempts histogram. */
+} NfcScannerProtocolStats;
+
+/**
+ * @brief Detection statistics of all NfcScanner instances since boot or reset.
+ *
+ * Per protocol statistics are obtained separately, so the structure
+ * does not change when protocols are added.
+ */
+typedef struct {
+    uint32_t scans; /**< Number of scans that detected a card. */
+    uint32_t last_scan_misses; /**< Failed attempts before the first detection, last scan. */
+    uint32_t last_scan_detection_time; /**< Time to the first detection in ms, last scan. */
+} NfcScannerStats;
+
 /**
  * @brief User callback function signature.
  *
@@ -92,6 +127,28 @@ void nfc_scanner_start(NfcScanner* instance, NfcScannerCallback callback, void*
  */
 void nfc_scanner_stop(NfcScanner* instance);
 
+/**
+ * @brief Get detection statistics.
+ *
+ * @param[out] stats pointer to the statistics to be filled.
+ */
+void nfc_scanner_get_stats(NfcScannerStats* stats);
+
+/**
+ * @brief Get detection statistics of a single protocol.
+ *
+ * @param[in] protocol identifier of the protocol in question.
+ * @param[out] stats pointer to the statistics to be filled.
+ */
+void nfc_scanner_get_protocol_stats(NfcProtocol protocol, NfcScannerProtocolStats* stats);
+
+/**
+ * @brief Reset detection statistics.
+ *
+ * Base protocols are tried in the default order again.
+ */
+void nfc_scanner_reset_stats(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -183,7 +183,8 @@ bool mf_classic_load(MfClassicData* data, FlipperFormat* ff, uint32_t version) {
             }
         }
 
-        // Read Mifare Classic blocks
+        // Read Mifare Classic blocks, up to 256 of them are looked up in the key index
+        flipper_format_set_key_index(ff, true);
         bool block_read = true;
         FuriString* block_str = furi_string_alloc();
         uint16_t blocks_total = mf_classic_get_total_block_num(data->type);
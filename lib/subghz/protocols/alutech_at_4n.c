@@ -54,6 +54,8 @@ const SubGhzProtocolDecoder subghz_protocol_alutech_at_4n_decoder = {
     .serialize = subghz_protocol_decoder_alutech_at_4n_serialize,
     .deserialize = subghz_protocol_decoder_alutech_at_4n_deserialize,
     .get_string = subghz_protocol_decoder_alutech_at_4n_get_string,
+
+    .timing = &subghz_protocol_alutech_at_4n_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_alutech_at_4n_encoder = {
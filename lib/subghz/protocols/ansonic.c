@@ -53,6 +53,8 @@ const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder = {
     .serialize = subghz_protocol_decoder_ansonic_serialize,
     .deserialize = subghz_protocol_decoder_ansonic_deserialize,
     .get_string = subghz_protocol_decoder_ansonic_get_string,
+
+    .timing = &subghz_protocol_ansonic_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_ansonic_encoder = {
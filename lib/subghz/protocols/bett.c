@@ -63,6 +63,8 @@ const SubGhzProtocolDecoder subghz_protocol_bett_decoder = {
     .serialize = subghz_protocol_decoder_bett_serialize,
     .deserialize = subghz_protocol_decoder_bett_deserialize,
     .get_string = subghz_protocol_decoder_bett_get_string,
+
+    .timing = &subghz_protocol_bett_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_bett_encoder = {
@@ -60,6 +60,8 @@ const SubGhzProtocolDecoder subghz_protocol_came_decoder = {
     .serialize = subghz_protocol_decoder_came_serialize,
     .deserialize = subghz_protocol_decoder_came_deserialize,
     .get_string = subghz_protocol_decoder_came_get_string,
+
+    .timing = &subghz_protocol_came_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_encoder = {
@@ -50,6 +50,8 @@ const SubGhzProtocolDecoder subghz_protocol_came_atomo_decoder = {
     .serialize = subghz_protocol_decoder_came_atomo_serialize,
     .deserialize = subghz_protocol_decoder_came_atomo_deserialize,
     .get_string = subghz_protocol_decoder_came_atomo_get_string,
+
+    .timing = &subghz_protocol_came_atomo_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_atomo_encoder = {
@@ -81,6 +81,8 @@ const SubGhzProtocolDecoder subghz_protocol_came_twee_decoder = {
     .serialize = subghz_protocol_decoder_came_twee_serialize,
     .deserialize = subghz_protocol_decoder_came_twee_deserialize,
     .get_string = subghz_protocol_decoder_came_twee_get_string,
+
+    .timing = &subghz_protocol_came_twee_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_came_twee_encoder = {
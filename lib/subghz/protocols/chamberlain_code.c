@@ -77,6 +77,8 @@ const SubGhzProtocolDecoder subghz_protocol_chamb_code_decoder = {
     .serialize = subghz_protocol_decoder_chamb_code_serialize,
     .deserialize = subghz_protocol_decoder_chamb_code_deserialize,
     .get_string = subghz_protocol_decoder_chamb_code_get_string,
+
+    .timing = &subghz_protocol_chamb_code_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_chamb_code_encoder = {
@@ -62,6 +62,8 @@ const SubGhzProtocolDecoder subghz_protocol_clemsa_decoder = {
     .serialize = subghz_protocol_decoder_clemsa_serialize,
     .deserialize = subghz_protocol_decoder_clemsa_deserialize,
     .get_string = subghz_protocol_decoder_clemsa_get_string,
+
+    .timing = &subghz_protocol_clemsa_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_clemsa_encoder = {
@@ -53,6 +53,8 @@ const SubGhzProtocolDecoder subghz_protocol_dickert_mahs_decoder = {
     .serialize = subghz_protocol_decoder_dickert_mahs_serialize,
     .deserialize = subghz_protocol_decoder_dickert_mahs_deserialize,
     .get_string = subghz_protocol_decoder_dickert_mahs_get_string,
+
+    .timing = &subghz_protocol_dickert_mahs_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_dickert_mahs_encoder = {
@@ -54,6 +54,8 @@ const SubGhzProtocolDecoder subghz_protocol_doitrand_decoder = {
     .serialize = subghz_protocol_decoder_doitrand_serialize,
     .deserialize = subghz_protocol_decoder_doitrand_deserialize,
     .get_string = subghz_protocol_decoder_doitrand_get_string,
+
+    .timing = &subghz_protocol_doitrand_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_doitrand_encoder = {
@@ -48,6 +48,8 @@ const SubGhzProtocolDecoder subghz_protocol_dooya_decoder = {
     .serialize = subghz_protocol_decoder_dooya_serialize,
     .deserialize = subghz_protocol_decoder_dooya_deserialize,
     .get_string = subghz_protocol_decoder_dooya_get_string,
+
+    .timing = &subghz_protocol_dooya_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_dooya_encoder = {
@@ -47,6 +47,8 @@ const SubGhzProtocolDecoder subghz_protocol_faac_slh_decoder = {
     .serialize = subghz_protocol_decoder_faac_slh_serialize,
     .deserialize = subghz_protocol_decoder_faac_slh_deserialize,
     .get_string = subghz_protocol_decoder_faac_slh_get_string,
+
+    .timing = &subghz_protocol_faac_slh_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_faac_slh_encoder = {
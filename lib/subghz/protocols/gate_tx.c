@@ -47,6 +47,8 @@ const SubGhzProtocolDecoder subghz_protocol_gate_tx_decoder = {
     .serialize = subghz_protocol_decoder_gate_tx_serialize,
     .deserialize = subghz_protocol_decoder_gate_tx_deserialize,
     .get_string = subghz_protocol_decoder_gate_tx_get_string,
+
+    .timing = &subghz_protocol_gate_tx_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_gate_tx_encoder = {
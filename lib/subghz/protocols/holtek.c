@@ -57,6 +57,8 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_decoder = {
     .serialize = subghz_protocol_decoder_holtek_serialize,
     .deserialize = subghz_protocol_decoder_holtek_deserialize,
     .get_string = subghz_protocol_decoder_holtek_get_string,
+
+    .timing = &subghz_protocol_holtek_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_holtek_encoder = {
@@ -64,6 +64,8 @@ const SubGhzProtocolDecoder subghz_protocol_holtek_th12x_decoder = {
     .serialize = subghz_protocol_decoder_holtek_th12x_serialize,
     .deserialize = subghz_protocol_decoder_holtek_th12x_deserialize,
     .get_string = subghz_protocol_decoder_holtek_th12x_get_string,
+
+    .timing = &subghz_protocol_holtek_th12x_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_holtek_th12x_encoder = {
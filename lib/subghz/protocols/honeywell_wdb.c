@@ -58,6 +58,8 @@ const SubGhzProtocolDecoder subghz_protocol_honeywell_wdb_decoder = {
     .serialize = subghz_protocol_decoder_honeywell_wdb_serialize,
     .deserialize = subghz_protocol_decoder_honeywell_wdb_deserialize,
     .get_string = subghz_protocol_decoder_honeywell_wdb_get_string,
+
+    .timing = &subghz_protocol_honeywell_wdb_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_honeywell_wdb_encoder = {
@@ -51,6 +51,8 @@ const SubGhzProtocolDecoder subghz_protocol_hormann_decoder = {
     .serialize = subghz_protocol_decoder_hormann_serialize,
     .deserialize = subghz_protocol_decoder_hormann_deserialize,
     .get_string = subghz_protocol_decoder_hormann_get_string,
+
+    .timing = &subghz_protocol_hormann_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_hormann_encoder = {
@@ -58,6 +58,8 @@ const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder = {
     .serialize = subghz_protocol_decoder_keeloq_serialize,
     .deserialize = subghz_protocol_decoder_keeloq_deserialize,
     .get_string = subghz_protocol_decoder_keeloq_get_string,
+
+    .timing = &subghz_protocol_keeloq_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_keeloq_encoder = {
@@ -481,20 +483,20 @@ static inline bool subghz_protocol_keeloq_check_decrypt_centurion(
 }
 
 /** 
- * Checking the accepted code against the database manafacture key
+ * Checking the accepted code against one manafacture key
  * @param instance Pointer to a SubGhzBlockGeneric* instance
  * @param fix Fix part of the parcel
  * @param hop Hop encrypted part of the parcel
- * @param keystore Pointer to a SubGhzKeystore* instance
- * @param manufacture_name 
- * @return true on successful search
+ * @param entry Pointer to a SubGhzKeystoreEntry* instance
+ * @param centurion_name Interned "Centurion" name, may be NULL
+ * @return true on successful check
  */
-static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
+static bool subghz_protocol_keeloq_check_manufacture_key(
     SubGhzBlockGeneric* instance,
     uint32_t fix,
     uint32_t hop,
-    SubGhzKeystore* keystore,
-    const char** manufacture_name) {
+    const SubGhzKeystoreEntry* entry,
+    const char* centurion_name) {
     // protocol HCS300 uses 10 bits in discriminator, HCS200 uses 8 bits, for backward compatibility, we are looking for the 8-bit pattern
     // HCS300 -> uint16_t end_serial = (uint16_t)(fix & 0x3FF);
     // HCS200 -> uint16_t end_serial = (uint16_t)(fix & 0xFF);
@@ -505,155 +507,140 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
     uint64_t man;
     uint32_t seed = 0;
 
-    for
-        M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
-            switch(manufacture_code->type) {
-            case KEELOQ_LEARNING_SIMPLE:
-                // Simple Learning
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            case KEELOQ_LEARNING_NORMAL:
-                // Normal Learning
-                // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                man = subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(strcmp(furi_string_get_cstr(manufacture_code->name), "Centurion") == 0) {
-                    if(subghz_protocol_keeloq_check_decrypt_centurion(instance, decrypt, btn)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        return 1;
-                    }
-                } else {
-                    if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                        *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                        return 1;
-                    }
-                }
-                break;
-            case KEELOQ_LEARNING_SECURE:
-                man = subghz_protocol_keeloq_common_secure_learning(
-                    fix, seed, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
-                man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
-                man = subghz_protocol_keeloq_common_magic_serial_type1_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
-                man = subghz_protocol_keeloq_common_magic_serial_type2_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
-                man = subghz_protocol_keeloq_common_magic_serial_type3_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            case KEELOQ_LEARNING_UNKNOWN:
-                // Simple Learning
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+    switch(entry->type) {
+    case KEELOQ_LEARNING_SIMPLE:
+        // Simple Learning
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, entry->key);
+        return subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial);
+    case KEELOQ_LEARNING_NORMAL:
+        // Normal Learning
+        // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+        man = subghz_protocol_keeloq_common_normal_learning(fix, entry->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(entry->name == centurion_name) {
+            return subghz_protocol_keeloq_check_decrypt_centurion(instance, decrypt, btn);
+        }
+        return subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial);
+    case KEELOQ_LEARNING_SECURE:
+        man = subghz_protocol_keeloq_common_secure_learning(fix, seed, entry->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        return subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial);
+    case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
+        man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, entry->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        return subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial);
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
+        man = subghz_protocol_keeloq_common_magic_serial_type1_learning(fix, entry->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        return subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial);
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
+        man = subghz_protocol_keeloq_common_magic_serial_type2_learning(fix, entry->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        return subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial);
+    case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
+        man = subghz_protocol_keeloq_common_magic_serial_type3_learning(fix, entry->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        return subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial);
+    case KEELOQ_LEARNING_UNKNOWN:
+        // Simple Learning
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, entry->key);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            return true;
+        }
 
-                // Check for mirrored man
-                uint64_t man_rev = 0;
-                uint64_t man_rev_byte = 0;
-                for(uint8_t i = 0; i < 64; i += 8) {
-                    man_rev_byte = (uint8_t)(manufacture_code->key >> i);
-                    man_rev = man_rev | man_rev_byte << (56 - i);
-                }
+        // Check for mirrored man
+        uint64_t man_rev = __builtin_bswap64(entry->key);
 
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            return true;
+        }
 
-                //###########################
-                // Normal Learning
-                // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                man = subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+        //###########################
+        // Normal Learning
+        // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+        man = subghz_protocol_keeloq_common_normal_learning(fix, entry->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            return true;
+        }
 
-                // Check for mirrored man
-                man = subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+        // Check for mirrored man
+        man = subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            return true;
+        }
 
-                // Secure Learning
-                man = subghz_protocol_keeloq_common_secure_learning(
-                    fix, seed, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+        // Secure Learning
+        man = subghz_protocol_keeloq_common_secure_learning(fix, seed, entry->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            return true;
+        }
 
-                // Check for mirrored man
-                man = subghz_protocol_keeloq_common_secure_learning(fix, seed, man_rev);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+        // Check for mirrored man
+        man = subghz_protocol_keeloq_common_secure_learning(fix, seed, man_rev);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            return true;
+        }
 
-                // Magic xor type1 learning
-                man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+        // Magic xor type1 learning
+        man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, entry->key);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
+            return true;
+        }
 
-                // Check for mirrored man
-                man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, man_rev);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
-            }
+        // Check for mirrored man
+        man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, man_rev);
+        decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
+        return subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial);
+    }
+
+    return false;
+}
+
+/** 
+ * Checking the accepted code against the database manafacture key
+ * Recently matched keys are checked first, then the whole lookup table
+ * @param instance Pointer to a SubGhzBlockGeneric* instance
+ * @param fix Fix part of the parcel
+ * @param hop Hop encrypted part of the parcel
+ * @param keystore Pointer to a SubGhzKeystore* instance
+ * @param manufacture_name 
+ * @return true on successful search
+ */
+static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
+    SubGhzBlockGeneric* instance,
+    uint32_t fix,
+    uint32_t hop,
+    SubGhzKeystore* keystore,
+    const char** manufacture_name) {
+    const char* centurion_name = subghz_keystore_find_name(keystore, "Centurion");
+
+    const SubGhzKeystoreEntry* entry = NULL;
+    for(size_t i = 0; (entry = subghz_keystore_get_recent(keystore, i)) != NULL; i++) {
+        if(subghz_protocol_keeloq_check_manufacture_key(
+               instance, fix, hop, entry, centurion_name)) {
+            subghz_keystore_set_recent(keystore, entry);
+            *manufacture_name = entry->name;
+            return 1;
         }
+    }
+
+    size_t table_count = 0;
+    const SubGhzKeystoreEntry* table = subghz_keystore_get_table(keystore, &table_count);
+    for(size_t i = 0; i < table_count; i++) {
+        entry = &table[i];
+        if(subghz_protocol_keeloq_check_manufacture_key(
+               instance, fix, hop, entry, centurion_name)) {
+            subghz_keystore_set_recent(keystore, entry);
+            *manufacture_name = entry->name;
+            return 1;
+        }
+    }
 
     *manufacture_name = "Unknown";
     instance->cnt = 0;
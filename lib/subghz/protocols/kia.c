@@ -49,6 +49,8 @@ const SubGhzProtocolDecoder subghz_protocol_kia_decoder = {
     .serialize = subghz_protocol_decoder_kia_serialize,
     .deserialize = subghz_protocol_decoder_kia_deserialize,
     .get_string = subghz_protocol_decoder_kia_get_string,
+
+    .timing = &subghz_protocol_kia_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_kia_encoder = {
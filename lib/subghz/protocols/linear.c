@@ -53,6 +53,8 @@ const SubGhzProtocolDecoder subghz_protocol_linear_decoder = {
     .serialize = subghz_protocol_decoder_linear_serialize,
     .deserialize = subghz_protocol_decoder_linear_deserialize,
     .get_string = subghz_protocol_decoder_linear_get_string,
+
+    .timing = &subghz_protocol_linear_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_linear_encoder = {
@@ -49,6 +49,8 @@ const SubGhzProtocolDecoder subghz_protocol_magellan_decoder = {
     .serialize = subghz_protocol_decoder_magellan_serialize,
     .deserialize = subghz_protocol_decoder_magellan_deserialize,
     .get_string = subghz_protocol_decoder_magellan_get_string,
+
+    .timing = &subghz_protocol_magellan_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_magellan_encoder = {
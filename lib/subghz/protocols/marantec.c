@@ -49,6 +49,8 @@ const SubGhzProtocolDecoder subghz_protocol_marantec_decoder = {
     .serialize = subghz_protocol_decoder_marantec_serialize,
     .deserialize = subghz_protocol_decoder_marantec_deserialize,
     .get_string = subghz_protocol_decoder_marantec_get_string,
+
+    .timing = &subghz_protocol_marantec_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_marantec_encoder = {
@@ -59,6 +59,8 @@ const SubGhzProtocolDecoder subghz_protocol_megacode_decoder = {
     .serialize = subghz_protocol_decoder_megacode_serialize,
     .deserialize = subghz_protocol_decoder_megacode_deserialize,
     .get_string = subghz_protocol_decoder_megacode_get_string,
+
+    .timing = &subghz_protocol_megacode_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_megacode_encoder = {
@@ -49,6 +49,8 @@ const SubGhzProtocolDecoder subghz_protocol_nero_radio_decoder = {
     .serialize = subghz_protocol_decoder_nero_radio_serialize,
     .deserialize = subghz_protocol_decoder_nero_radio_deserialize,
     .get_string = subghz_protocol_decoder_nero_radio_get_string,
+
+    .timing = &subghz_protocol_nero_radio_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nero_radio_encoder = {
@@ -48,6 +48,8 @@ const SubGhzProtocolDecoder subghz_protocol_nero_sketch_decoder = {
     .serialize = subghz_protocol_decoder_nero_sketch_serialize,
     .deserialize = subghz_protocol_decoder_nero_sketch_deserialize,
     .get_string = subghz_protocol_decoder_nero_sketch_get_string,
+
+    .timing = &subghz_protocol_nero_sketch_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nero_sketch_encoder = {
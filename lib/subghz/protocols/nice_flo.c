@@ -46,6 +46,8 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flo_decoder = {
     .serialize = subghz_protocol_decoder_nice_flo_serialize,
     .deserialize = subghz_protocol_decoder_nice_flo_deserialize,
     .get_string = subghz_protocol_decoder_nice_flo_get_string,
+
+    .timing = &subghz_protocol_nice_flo_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nice_flo_encoder = {
@@ -60,6 +60,8 @@ const SubGhzProtocolDecoder subghz_protocol_nice_flor_s_decoder = {
     .serialize = subghz_protocol_decoder_nice_flor_s_serialize,
     .deserialize = subghz_protocol_decoder_nice_flor_s_deserialize,
     .get_string = subghz_protocol_decoder_nice_flor_s_get_string,
+
+    .timing = &subghz_protocol_nice_flor_s_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_nice_flor_s_encoder = {
@@ -49,6 +49,8 @@ const SubGhzProtocolDecoder subghz_protocol_phoenix_v2_decoder = {
     .serialize = subghz_protocol_decoder_phoenix_v2_serialize,
     .deserialize = subghz_protocol_decoder_phoenix_v2_deserialize,
     .get_string = subghz_protocol_decoder_phoenix_v2_get_string,
+
+    .timing = &subghz_protocol_phoenix_v2_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_phoenix_v2_encoder = {
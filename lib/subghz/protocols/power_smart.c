@@ -57,6 +57,8 @@ const SubGhzProtocolDecoder subghz_protocol_power_smart_decoder = {
     .serialize = subghz_protocol_decoder_power_smart_serialize,
     .deserialize = subghz_protocol_decoder_power_smart_deserialize,
     .get_string = subghz_protocol_decoder_power_smart_get_string,
+
+    .timing = &subghz_protocol_power_smart_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_power_smart_encoder = {
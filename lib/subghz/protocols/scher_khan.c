@@ -55,6 +55,8 @@ const SubGhzProtocolDecoder subghz_protocol_scher_khan_decoder = {
     .serialize = subghz_protocol_decoder_scher_khan_serialize,
     .deserialize = subghz_protocol_decoder_scher_khan_deserialize,
     .get_string = subghz_protocol_decoder_scher_khan_get_string,
+
+    .timing = &subghz_protocol_scher_khan_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_scher_khan_encoder = {
@@ -70,6 +70,8 @@ const SubGhzProtocolDecoder subghz_protocol_secplus_v1_decoder = {
     .serialize = subghz_protocol_decoder_secplus_v1_serialize,
     .deserialize = subghz_protocol_decoder_secplus_v1_deserialize,
     .get_string = subghz_protocol_decoder_secplus_v1_get_string,
+
+    .timing = &subghz_protocol_secplus_v1_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_secplus_v1_encoder = {
@@ -72,6 +72,8 @@ const SubGhzProtocolDecoder subghz_protocol_smc5326_decoder = {
     .serialize = subghz_protocol_decoder_smc5326_serialize,
     .deserialize = subghz_protocol_decoder_smc5326_deserialize,
     .get_string = subghz_protocol_decoder_smc5326_get_string,
+
+    .timing = &subghz_protocol_smc5326_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_smc5326_encoder = {
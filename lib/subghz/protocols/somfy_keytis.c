@@ -53,6 +53,8 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_keytis_decoder = {
     .serialize = subghz_protocol_decoder_somfy_keytis_serialize,
     .deserialize = subghz_protocol_decoder_somfy_keytis_deserialize,
     .get_string = subghz_protocol_decoder_somfy_keytis_get_string,
+
+    .timing = &subghz_protocol_somfy_keytis_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_somfy_keytis_encoder = {
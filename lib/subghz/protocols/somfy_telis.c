@@ -52,6 +52,8 @@ const SubGhzProtocolDecoder subghz_protocol_somfy_telis_decoder = {
     .serialize = subghz_protocol_decoder_somfy_telis_serialize,
     .deserialize = subghz_protocol_decoder_somfy_telis_deserialize,
     .get_string = subghz_protocol_decoder_somfy_telis_get_string,
+
+    .timing = &subghz_protocol_somfy_telis_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_somfy_telis_encoder = {
@@ -55,6 +55,8 @@ const SubGhzProtocolDecoder subghz_protocol_star_line_decoder = {
     .serialize = subghz_protocol_decoder_star_line_serialize,
     .deserialize = subghz_protocol_decoder_star_line_deserialize,
     .get_string = subghz_protocol_decoder_star_line_get_string,
+
+    .timing = &subghz_protocol_star_line_const,
 };
 
 const SubGhzProtocolEncoder subghz_protocol_star_line_encoder = {
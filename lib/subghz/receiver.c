@@ -4,8 +4,14 @@
 
 #include <m-array.h>
 
+// Slots covered by the dispatch table, the rest are fed with every pulse
+#define SUBGHZ_RECEIVER_DISPATCH_SLOTS (64U)
+// Pulses outside of the envelope delivered to a decoder before it is considered idle
+#define SUBGHZ_RECEIVER_ENVELOPE_TAIL  (2U)
+
 typedef struct {
     SubGhzProtocolEncoderBase* base;
+    uint32_t duration_min;
 } SubGhzReceiverSlot;
 
 ARRAY_DEF(SubGhzReceiverSlotArray, SubGhzReceiverSlot, M_POD_OPLIST);
@@ -15,10 +21,75 @@ struct SubGhzReceiver {
     SubGhzReceiverSlotArray_t slots;
     SubGhzProtocolFlag filter;
 
+    // Duration buckets bounded by envelope edges, with a mask of accepting slots per bucket
+    uint32_t* dispatch_edges;
+    uint64_t* dispatch_masks;
+    size_t dispatch_edge_count;
+    uint64_t filter_mask;
+    // Slots that may be mid-frame, they also get pulses outside of their envelope
+    uint64_t tail_masks[SUBGHZ_RECEIVER_ENVELOPE_TAIL];
+
     SubGhzReceiverCallback callback;
     void* context;
 };
 
+static void subghz_receiver_build_dispatch(SubGhzReceiver* instance) {
+    size_t slot_count =
+        MIN(SubGhzReceiverSlotArray_size(instance->slots), SUBGHZ_RECEIVER_DISPATCH_SLOTS);
+
+    instance->dispatch_edges = malloc(sizeof(uint32_t) * slot_count);
+    instance->dispatch_masks = malloc(sizeof(uint64_t) * (slot_count + 1));
+
+    // Unique envelope edges in ascending order
+    size_t edge_count = 0;
+    for(size_t i = 0; i < slot_count; i++) {
+        uint32_t edge = SubGhzReceiverSlotArray_cget(instance->slots, i)->duration_min;
+        if(edge == 0) continue;
+
+        size_t position = 0;
+        while(position < edge_count && instance->dispatch_edges[position] < edge) {
+            position++;
+        }
+        if(position < edge_count && instance->dispatch_edges[position] == edge) continue;
+
+        memmove(
+            &instance->dispatch_edges[position + 1],
+            &instance->dispatch_edges[position],
+            sizeof(uint32_t) * (edge_count - position));
+        instance->dispatch_edges[position] = edge;
+        edge_count++;
+    }
+    instance->dispatch_edge_count = edge_count;
+
+    // Bucket 0 is below the first edge, bucket N starts at edge N-1
+    for(size_t bucket = 0; bucket <= edge_count; bucket++) {
+        uint64_t mask = 0;
+        for(size_t i = 0; i < slot_count; i++) {
+            uint32_t duration_min = SubGhzReceiverSlotArray_cget(instance->slots, i)->duration_min;
+            if(duration_min == 0 ||
+               (bucket > 0 && duration_min <= instance->dispatch_edges[bucket - 1])) {
+                mask |= 1ULL << i;
+            }
+        }
+        instance->dispatch_masks[bucket] = mask;
+    }
+}
+
+static inline uint64_t
+    subghz_receiver_get_dispatch_mask(SubGhzReceiver* instance, uint32_t duration) {
+    size_t low = 0;
+    size_t high = instance->dispatch_edge_count;
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        if(instance->dispatch_edges[middle] <= duration) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return instance->dispatch_masks[low];
+}
+
 SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
     SubGhzReceiver* instance = malloc(sizeof(SubGhzReceiver));
     SubGhzReceiverSlotArray_init(instance->slots);
@@ -32,9 +103,18 @@ SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
         if(protocol->decoder && protocol->decoder->alloc) {
             SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_push_new(instance->slots);
             slot->base = protocol->decoder->alloc(environment);
+
+            const SubGhzBlockConst* timing = protocol->decoder->timing;
+            if(timing && timing->te_short > timing->te_delta) {
+                slot->duration_min = timing->te_short - timing->te_delta;
+            } else {
+                slot->duration_min = 0;
+            }
         }
     }
 
+    subghz_receiver_build_dispatch(instance);
+
     instance->callback = NULL;
     instance->context = NULL;
     return instance;
@@ -53,6 +133,8 @@ void subghz_receiver_free(SubGhzReceiver* instance) {
             slot->base = NULL;
         }
     SubGhzReceiverSlotArray_clear(instance->slots);
+    free(instance->dispatch_edges);
+    free(instance->dispatch_masks);
 
     free(instance);
 }
@@ -61,12 +143,33 @@ void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t durat
     furi_check(instance);
     furi_check(instance->slots);
 
-    for
-        M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
-            if((slot->base->protocol->flag & instance->filter) != 0) {
-                slot->base->protocol->decoder->feed(slot->base, level, duration);
-            }
+    uint64_t accept_mask = subghz_receiver_get_dispatch_mask(instance, duration);
+
+    // Decoders that accepted one of the last pulses may be mid-frame, let them see
+    // the pulses that end the frame
+    uint64_t feed_mask = accept_mask;
+    for(size_t i = SUBGHZ_RECEIVER_ENVELOPE_TAIL - 1; i > 0; i--) {
+        feed_mask |= instance->tail_masks[i];
+        instance->tail_masks[i] = instance->tail_masks[i - 1] & ~accept_mask;
+    }
+    feed_mask |= instance->tail_masks[0];
+    instance->tail_masks[0] = accept_mask;
+    feed_mask &= instance->filter_mask;
+
+    while(feed_mask) {
+        size_t index = __builtin_ctzll(feed_mask);
+        feed_mask &= feed_mask - 1;
+        SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_get(instance->slots, index);
+        slot->base->protocol->decoder->feed(slot->base, level, duration);
+    }
+
+    size_t slot_count = SubGhzReceiverSlotArray_size(instance->slots);
+    for(size_t i = SUBGHZ_RECEIVER_DISPATCH_SLOTS; i < slot_count; i++) {
+        SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_get(instance->slots, i);
+        if((slot->base->protocol->flag & instance->filter) != 0) {
+            slot->base->protocol->decoder->feed(slot->base, level, duration);
         }
+    }
 }
 
 void subghz_receiver_reset(SubGhzReceiver* instance) {
@@ -77,6 +180,9 @@ void subghz_receiver_reset(SubGhzReceiver* instance) {
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
             slot->base->protocol->decoder->reset(slot->base);
         }
+
+    // Reset decoders are not mid-frame anymore
+    memset(instance->tail_masks, 0, sizeof(instance->tail_masks));
 }
 
 static void subghz_receiver_rx_callback(SubGhzProtocolDecoderBase* decoder_base, void* context) {
@@ -105,6 +211,16 @@ void subghz_receiver_set_rx_callback(
 void subghz_receiver_set_filter(SubGhzReceiver* instance, SubGhzProtocolFlag filter) {
     furi_check(instance);
     instance->filter = filter;
+
+    instance->filter_mask = 0;
+    size_t slot_count =
+        MIN(SubGhzReceiverSlotArray_size(instance->slots), SUBGHZ_RECEIVER_DISPATCH_SLOTS);
+    for(size_t i = 0; i < slot_count; i++) {
+        const SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_cget(instance->slots, i);
+        if((slot->base->protocol->flag & filter) != 0) {
+            instance->filter_mask |= 1ULL << i;
+        }
+    }
 }
 
 SubGhzProtocolDecoderBase* subghz_receiver_search_decoder_base_by_name(
@@ -4,12 +4,57 @@
 #include <flipper_format/flipper_format.h>
 #include <flipper_format/flipper_format_i.h>
 #include <lib/subghz/devices/devices.h>
+#include <lib/subghz/types.h>
 #include <lib/toolbox/strint.h>
+#include <lib/toolbox/varint.h>
+#include <lib/toolbox/crc32_calc.h>
+
+#include <ctype.h>
+#include <m-array.h>
 
 #define TAG "SubGhzFileEncoderWorker"
 
 #define SUBGHZ_FILE_ENCODER_LOAD 512
 
+#define SUBGHZ_FILE_ENCODER_SIDECAR_MAGIC    (0x42574152UL) // "RAWB"
+#define SUBGHZ_FILE_ENCODER_SIDECAR_VERSION  (3U)
+#define SUBGHZ_FILE_ENCODER_SIDECAR_BUFFER   (2048U)
+#define SUBGHZ_FILE_ENCODER_SIDECAR_SAMPLE   (1024U)
+#define SUBGHZ_FILE_ENCODER_SIDECAR_NAME_MAX (256U)
+#define SUBGHZ_FILE_ENCODER_VARINT_MAX       (5U)
+#define SUBGHZ_FILE_ENCODER_VARINT_MIN_VALUE (INT32_MIN / 2 + 1)
+
+#define SUBGHZ_FILE_ENCODER_FNV_BASIS (0xCBF29CE484222325ULL)
+#define SUBGHZ_FILE_ENCODER_FNV_PRIME (0x100000001B3ULL)
+
+/*
+ * Binary sidecar file layout:
+ * - SubGhzFileEncoderSidecarHeader
+ * - path_size bytes of the RAW file path, used to drop sidecars of removed files
+ * - data_size bytes of zigzag varint durations, same values and order as the RAW_Data lines
+ * Sidecars are kept in SUBGHZ_FILE_ENCODER_SIDECAR_FOLDER, named by the RAW file path hash,
+ * and built outside of transmission by subghz_file_encoder_worker_build_sidecar.
+ * Text file stays the source of truth, sidecar is ignored when the text size or the CRC of
+ * its first and last SUBGHZ_FILE_ENCODER_SIDECAR_SAMPLE bytes changes.
+ */
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t path_size;
+    uint32_t source_size;
+    uint32_t source_crc;
+    uint32_t data_size;
+    uint32_t value_count;
+} SubGhzFileEncoderSidecarHeader;
+
+ARRAY_DEF(SubGhzFileEncoderPathArray, FuriString*, FURI_STRING_OPLIST) // NOLINT
+
+typedef enum {
+    SubGhzFileEncoderSidecarStateNone,
+    SubGhzFileEncoderSidecarStateRead,
+} SubGhzFileEncoderSidecarState;
+
 struct SubGhzFileEncoderWorker {
     FuriThread* thread;
     FuriStreamBuffer* stream;
@@ -24,6 +69,18 @@ struct SubGhzFileEncoderWorker {
     FuriString* file_path;
     const SubGhzDevice* device;
 
+    int32_t* upload;
+    size_t upload_count;
+
+    File* sidecar;
+    FuriString* sidecar_path;
+    SubGhzFileEncoderSidecarState sidecar_state;
+    SubGhzFileEncoderSidecarHeader sidecar_header;
+    uint8_t* sidecar_buffer;
+    size_t sidecar_buffer_count;
+    size_t sidecar_buffer_position;
+    size_t sidecar_data_left;
+
     SubGhzFileEncoderWorkerCallbackEnd callback_end;
     void* context_end;
 };
@@ -45,6 +102,195 @@ void subghz_file_encoder_worker_add_level_duration(
     if(sizeof(int32_t) != ret) FURI_LOG_E(TAG, "Invalid add duration in the stream");
 }
 
+static void subghz_file_encoder_worker_sidecar_close(SubGhzFileEncoderWorker* instance) {
+    if(instance->sidecar_state != SubGhzFileEncoderSidecarStateNone) {
+        storage_file_close(instance->sidecar);
+        instance->sidecar_state = SubGhzFileEncoderSidecarStateNone;
+    }
+}
+
+// FAT is case insensitive, so are the sidecar names
+static void subghz_file_encoder_worker_sidecar_path(const char* file_path, FuriString* path) {
+    uint64_t hash = SUBGHZ_FILE_ENCODER_FNV_BASIS;
+    for(; *file_path; file_path++) {
+        hash = (hash ^ (uint8_t)tolower((uint8_t)*file_path)) * SUBGHZ_FILE_ENCODER_FNV_PRIME;
+    }
+    furi_string_printf(
+        path,
+        "%s/%08lX%08lX.bin",
+        SUBGHZ_FILE_ENCODER_SIDECAR_FOLDER,
+        (uint32_t)(hash >> 32),
+        (uint32_t)hash);
+}
+
+/** Fill the source part of a sidecar header for the given RAW file
+ * 
+ * Only the first and the last blocks of the text are read, so it is cheap enough for TX start.
+ * 
+ * @param storage Pointer to a Storage instance
+ * @param file_path RAW file path
+ * @param header header to fill
+ * @return true if the text file size and CRC are known
+ */
+static bool subghz_file_encoder_worker_sidecar_source(
+    Storage* storage,
+    const char* file_path,
+    SubGhzFileEncoderSidecarHeader* header) {
+    *header = (SubGhzFileEncoderSidecarHeader){
+        .magic = SUBGHZ_FILE_ENCODER_SIDECAR_MAGIC,
+        .version = SUBGHZ_FILE_ENCODER_SIDECAR_VERSION,
+        .path_size = strlen(file_path),
+    };
+
+    File* file = storage_file_alloc(storage);
+    uint8_t* buffer = malloc(SUBGHZ_FILE_ENCODER_SIDECAR_SAMPLE);
+    bool result = false;
+
+    do {
+        if(!storage_file_open(file, file_path, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+        const uint64_t size = storage_file_size(file);
+        if(size > UINT32_MAX) break;
+        header->source_size = size;
+
+        const size_t head = MIN(size, SUBGHZ_FILE_ENCODER_SIDECAR_SAMPLE);
+        if(storage_file_read(file, buffer, head) != head) break;
+        header->source_crc = crc32_calc_buffer(0, buffer, head);
+
+        const size_t tail = MIN(size - head, SUBGHZ_FILE_ENCODER_SIDECAR_SAMPLE);
+        if(tail) {
+            if(!storage_file_seek(file, size - tail, true)) break;
+            if(storage_file_read(file, buffer, tail) != tail) break;
+            header->source_crc = crc32_calc_buffer(header->source_crc, buffer, tail);
+        }
+
+        result = true;
+    } while(false);
+
+    free(buffer);
+    storage_file_free(file);
+
+    return result;
+}
+
+/** Open a sidecar and check that it was built from the given source
+ * 
+ * @param sidecar File instance, left open after the path on success
+ * @param sidecar_path sidecar path
+ * @param source expected source part of the header, NULL to only check the format
+ * @param header header read from the sidecar
+ * @param file_path RAW file path stored in the sidecar, may be NULL
+ * @return true if the sidecar can be replayed
+ */
+static bool subghz_file_encoder_worker_sidecar_check(
+    File* sidecar,
+    const char* sidecar_path,
+    const SubGhzFileEncoderSidecarHeader* source,
+    SubGhzFileEncoderSidecarHeader* header,
+    FuriString* file_path) {
+    if(!storage_file_open(sidecar, sidecar_path, FSAM_READ, FSOM_OPEN_EXISTING)) return false;
+    if(storage_file_read(sidecar, header, sizeof(*header)) != sizeof(*header)) return false;
+
+    if(header->magic != SUBGHZ_FILE_ENCODER_SIDECAR_MAGIC ||
+       header->version != SUBGHZ_FILE_ENCODER_SIDECAR_VERSION ||
+       storage_file_size(sidecar) != sizeof(*header) + header->path_size + header->data_size) {
+        FURI_LOG_W(TAG, "Sidecar format mismatch");
+        return false;
+    }
+    if(source && (header->path_size != source->path_size ||
+                  header->source_size != source->source_size ||
+                  header->source_crc != source->source_crc)) {
+        FURI_LOG_I(TAG, "Sidecar is outdated");
+        return false;
+    }
+
+    if(file_path) {
+        char* path = malloc(header->path_size + 1);
+        const bool result = storage_file_read(sidecar, path, header->path_size) ==
+                            header->path_size;
+        furi_string_set_strn(file_path, path, header->path_size);
+        free(path);
+        return result;
+    } else {
+        return storage_file_seek(sidecar, sizeof(*header) + header->path_size, true);
+    }
+}
+
+static void subghz_file_encoder_worker_sidecar_open(SubGhzFileEncoderWorker* instance) {
+    const char* sidecar_path = furi_string_get_cstr(instance->sidecar_path);
+    SubGhzFileEncoderSidecarHeader source;
+
+    instance->sidecar_buffer_count = 0;
+    instance->sidecar_buffer_position = 0;
+
+    if(storage_common_exists(instance->storage, sidecar_path) &&
+       subghz_file_encoder_worker_sidecar_source(
+           instance->storage, furi_string_get_cstr(instance->file_path), &source) &&
+       subghz_file_encoder_worker_sidecar_check(
+           instance->sidecar, sidecar_path, &source, &instance->sidecar_header, NULL)) {
+        instance->sidecar_data_left = instance->sidecar_header.data_size;
+        instance->sidecar_state = SubGhzFileEncoderSidecarStateRead;
+        FURI_LOG_I(TAG, "Replay from sidecar: %lu values", instance->sidecar_header.value_count);
+    } else {
+        storage_file_close(instance->sidecar);
+    }
+}
+
+/** Decode the next block of durations from the sidecar into the upload buffer
+ * 
+ * @param instance Pointer to a SubGhzFileEncoderWorker instance
+ * @return count of decoded durations, 0 at the end of data
+ */
+static size_t subghz_file_encoder_worker_sidecar_load(SubGhzFileEncoderWorker* instance) {
+    size_t count = 0;
+    while(count < SUBGHZ_FILE_ENCODER_LOAD) {
+        size_t available = instance->sidecar_buffer_count - instance->sidecar_buffer_position;
+        if(available < SUBGHZ_FILE_ENCODER_VARINT_MAX && instance->sidecar_data_left) {
+            memmove(
+                instance->sidecar_buffer,
+                &instance->sidecar_buffer[instance->sidecar_buffer_position],
+                available);
+            size_t bytes_to_read =
+                MIN(SUBGHZ_FILE_ENCODER_SIDECAR_BUFFER - available, instance->sidecar_data_left);
+            size_t bytes_read = storage_file_read(
+                instance->sidecar, &instance->sidecar_buffer[available], bytes_to_read);
+            if(bytes_read != bytes_to_read) {
+                FURI_LOG_E(TAG, "Unable to read sidecar");
+                instance->sidecar_data_left = 0;
+            } else {
+                instance->sidecar_data_left -= bytes_read;
+            }
+            instance->sidecar_buffer_count = available + bytes_read;
+            instance->sidecar_buffer_position = 0;
+            available = instance->sidecar_buffer_count;
+        }
+        if(available == 0) break;
+
+        size_t size = varint_int32_unpack(
+            &instance->upload[count],
+            &instance->sidecar_buffer[instance->sidecar_buffer_position],
+            available);
+        if(size > available) {
+            FURI_LOG_E(TAG, "Sidecar data is truncated");
+            instance->sidecar_buffer_position = instance->sidecar_buffer_count;
+            instance->sidecar_data_left = 0;
+            break;
+        }
+        instance->sidecar_buffer_position += size;
+        count++;
+    }
+
+    return count;
+}
+
+static void subghz_file_encoder_worker_upload_flush(SubGhzFileEncoderWorker* instance) {
+    if(instance->upload_count == 0) return;
+
+    size_t size = instance->upload_count * sizeof(int32_t);
+    size_t ret = furi_stream_buffer_send(instance->stream, instance->upload, size, 100);
+    if(size != ret) FURI_LOG_E(TAG, "Invalid add duration in the stream");
+    instance->upload_count = 0;
+}
+
 bool subghz_file_encoder_worker_data_parse(SubGhzFileEncoderWorker* instance, const char* strStart) {
     // Line sample: "RAW_Data: -1, 2, -2..."
 
@@ -56,12 +302,16 @@ bool subghz_file_encoder_worker_data_parse(SubGhzFileEncoderWorker* instance, co
         // Skip key
         str = strchr(str, ' ');
 
-        // Parse next element
+        // Parse next element, the whole line goes to the stream in one block
         int32_t duration;
         while(strint_to_int32(str, &str, &duration, 10) == StrintParseNoError) {
-            subghz_file_encoder_worker_add_level_duration(instance, duration);
+            instance->upload[instance->upload_count++] = duration;
+            if(instance->upload_count == SUBGHZ_FILE_ENCODER_LOAD) {
+                subghz_file_encoder_worker_upload_flush(instance);
+            }
             if(*str == ',') str++; // could also be `\0`
         }
+        subghz_file_encoder_worker_upload_flush(instance);
 
         res = true;
     }
@@ -102,6 +352,7 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
     FURI_LOG_I(TAG, "Worker start");
     bool res = false;
     instance->is_storage_slow = false;
+    instance->upload_count = 0;
     Stream* stream = flipper_format_get_raw_stream(instance->flipper_format);
     do {
         if(!flipper_format_file_open_existing(
@@ -119,6 +370,9 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
 
         //skip the end of the previous line "\n"
         stream_seek(stream, 1, StreamOffsetFromCurrent);
+        subghz_file_encoder_worker_sidecar_path(
+            furi_string_get_cstr(instance->file_path), instance->sidecar_path);
+        subghz_file_encoder_worker_sidecar_open(instance);
         res = true;
         instance->worker_stoping = false;
         FURI_LOG_I(TAG, "Start transmission");
@@ -127,7 +381,15 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
     while(res && instance->worker_running) {
         size_t stream_free_byte = furi_stream_buffer_spaces_available(instance->stream);
         if((stream_free_byte / sizeof(int32_t)) >= SUBGHZ_FILE_ENCODER_LOAD) {
-            if(stream_read_line(stream, instance->str_data)) {
+            if(instance->sidecar_state == SubGhzFileEncoderSidecarStateRead) {
+                // Binary replay, one block read and one stream buffer send per load
+                instance->upload_count = subghz_file_encoder_worker_sidecar_load(instance);
+                if(instance->upload_count == 0) {
+                    subghz_file_encoder_worker_add_level_duration(instance, LEVEL_DURATION_RESET);
+                    break;
+                }
+                subghz_file_encoder_worker_upload_flush(instance);
+            } else if(stream_read_line(stream, instance->str_data)) {
                 furi_string_trim(instance->str_data);
                 if(!subghz_file_encoder_worker_data_parse(
                        instance, furi_string_get_cstr(instance->str_data))) {
@@ -142,6 +404,8 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
             furi_delay_ms(1);
         }
     }
+    subghz_file_encoder_worker_sidecar_close(instance);
+
     //waiting for the end of the transfer
     if(instance->is_storage_slow) {
         FURI_LOG_E(TAG, "Storage is slow");
@@ -180,6 +444,11 @@ SubGhzFileEncoderWorker* subghz_file_encoder_worker_alloc(void) {
     instance->file_path = furi_string_alloc();
     instance->worker_stoping = true;
 
+    instance->upload = malloc(sizeof(int32_t) * SUBGHZ_FILE_ENCODER_LOAD);
+    instance->sidecar = storage_file_alloc(instance->storage);
+    instance->sidecar_path = furi_string_alloc();
+    instance->sidecar_buffer = malloc(SUBGHZ_FILE_ENCODER_SIDECAR_BUFFER);
+
     return instance;
 }
 
@@ -192,6 +461,11 @@ void subghz_file_encoder_worker_free(SubGhzFileEncoderWorker* instance) {
     furi_string_free(instance->str_data);
     furi_string_free(instance->file_path);
 
+    free(instance->upload);
+    storage_file_free(instance->sidecar);
+    furi_string_free(instance->sidecar_path);
+    free(instance->sidecar_buffer);
+
     flipper_format_free(instance->flipper_format);
     furi_record_close(RECORD_STORAGE);
 
@@ -228,3 +502,184 @@ bool subghz_file_encoder_worker_is_running(SubGhzFileEncoderWorker* instance) {
     furi_assert(instance);
     return instance->worker_running;
 }
+
+void subghz_file_encoder_worker_get_sidecar_path(const char* file_path, FuriString* sidecar_path) {
+    furi_check(file_path);
+    furi_check(sidecar_path);
+
+    subghz_file_encoder_worker_sidecar_path(file_path, sidecar_path);
+}
+
+void subghz_file_encoder_worker_remove_sidecar(Storage* storage, const char* file_path) {
+    furi_check(storage);
+    furi_check(file_path);
+
+    FuriString* sidecar_path = furi_string_alloc();
+    subghz_file_encoder_worker_sidecar_path(file_path, sidecar_path);
+    storage_common_remove(storage, furi_string_get_cstr(sidecar_path));
+    furi_string_free(sidecar_path);
+}
+
+static bool subghz_file_encoder_worker_sidecar_write(
+    Storage* storage,
+    const char* file_path,
+    File* sidecar,
+    const char* sidecar_path,
+    SubGhzFileEncoderSidecarHeader* header) {
+    FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+    Stream* stream = flipper_format_get_raw_stream(flipper_format);
+    FuriString* str_data = furi_string_alloc();
+    uint8_t* buffer = malloc(SUBGHZ_FILE_ENCODER_SIDECAR_BUFFER);
+    size_t buffer_count = 0;
+    uint32_t version = 0;
+    bool result = false;
+
+    do {
+        if(!flipper_format_file_open_existing(flipper_format, file_path)) break;
+        if(!flipper_format_read_header(flipper_format, str_data, &version)) break;
+        if(!furi_string_equal(str_data, SUBGHZ_RAW_FILE_TYPE)) {
+            FURI_LOG_D(TAG, "Not a RAW file: %s", file_path);
+            break;
+        }
+        if(!flipper_format_read_string(flipper_format, "Protocol", str_data)) break;
+        //skip the end of the previous line "\n"
+        stream_seek(stream, 1, StreamOffsetFromCurrent);
+
+        if(!storage_simply_mkdir(storage, SUBGHZ_FILE_ENCODER_SIDECAR_FOLDER)) break;
+        if(!storage_file_open(sidecar, sidecar_path, FSAM_WRITE, FSOM_CREATE_ALWAYS)) break;
+        if(!storage_file_seek(sidecar, sizeof(*header), true)) break;
+        if(storage_file_write(sidecar, file_path, header->path_size) != header->path_size) break;
+
+        // Same lines as the text replay: it ends on the first line without RAW_Data
+        result = true;
+        while(result && stream_read_line(stream, str_data)) {
+            furi_string_trim(str_data);
+            char* str = strstr(furi_string_get_cstr(str_data), "RAW_Data: ");
+            if(!str) break;
+            str = strchr(str, ' ');
+
+            int32_t duration;
+            while(strint_to_int32(str, &str, &duration, 10) == StrintParseNoError) {
+                if(duration < SUBGHZ_FILE_ENCODER_VARINT_MIN_VALUE) {
+                    FURI_LOG_W(TAG, "Duration out of sidecar range");
+                    result = false;
+                    break;
+                }
+                buffer_count += varint_int32_pack(duration, &buffer[buffer_count]);
+                header->value_count++;
+
+                if(SUBGHZ_FILE_ENCODER_SIDECAR_BUFFER - buffer_count <
+                   SUBGHZ_FILE_ENCODER_VARINT_MAX) {
+                    result = storage_file_write(sidecar, buffer, buffer_count) == buffer_count;
+                    header->data_size += buffer_count;
+                    buffer_count = 0;
+                    if(!result) break;
+                }
+                if(*str == ',') str++; // could also be `\0`
+            }
+        }
+        if(!result) break;
+
+        result = false;
+        if(header->value_count == 0) {
+            FURI_LOG_W(TAG, "No RAW data: %s", file_path);
+            break;
+        }
+        if(storage_file_write(sidecar, buffer, buffer_count) != buffer_count) break;
+        header->data_size += buffer_count;
+        if(!storage_file_seek(sidecar, 0, true)) break;
+        if(storage_file_write(sidecar, header, sizeof(*header)) != sizeof(*header)) break;
+        result = true;
+    } while(false);
+
+    free(buffer);
+    furi_string_free(str_data);
+    flipper_format_free(flipper_format);
+
+    return result;
+}
+
+// Sidecars of RAW files that were removed, renamed or changed outside of the SubGhz app
+static void subghz_file_encoder_worker_sidecar_prune(Storage* storage, const char* keep_path) {
+    File* folder = storage_file_alloc(storage);
+    File* sidecar = storage_file_alloc(storage);
+    FuriString* sidecar_path = furi_string_alloc();
+    FuriString* file_path = furi_string_alloc();
+    char* name = malloc(SUBGHZ_FILE_ENCODER_SIDECAR_NAME_MAX);
+    SubGhzFileEncoderPathArray_t stale;
+    SubGhzFileEncoderPathArray_init(stale);
+    FileInfo fileinfo;
+
+    if(storage_dir_open(folder, SUBGHZ_FILE_ENCODER_SIDECAR_FOLDER)) {
+        while(storage_dir_read(folder, &fileinfo, name, SUBGHZ_FILE_ENCODER_SIDECAR_NAME_MAX)) {
+            if(file_info_is_dir(&fileinfo)) continue;
+            furi_string_printf(sidecar_path, "%s/%s", SUBGHZ_FILE_ENCODER_SIDECAR_FOLDER, name);
+            if(furi_string_equal(sidecar_path, keep_path)) continue;
+
+            SubGhzFileEncoderSidecarHeader header, source;
+            bool valid = subghz_file_encoder_worker_sidecar_check(
+                sidecar, furi_string_get_cstr(sidecar_path), NULL, &header, file_path);
+            storage_file_close(sidecar);
+
+            valid = valid &&
+                    subghz_file_encoder_worker_sidecar_source(
+                        storage, furi_string_get_cstr(file_path), &source) &&
+                    source.source_size == header.source_size &&
+                    source.source_crc == header.source_crc;
+            if(!valid) SubGhzFileEncoderPathArray_push_back(stale, sidecar_path);
+        }
+    }
+    storage_dir_close(folder);
+
+    // Removed after the folder is closed, so the listing is not changed under it
+    for
+        M_EACH(path, stale, SubGhzFileEncoderPathArray_t) {
+            FURI_LOG_I(TAG, "Removing stale sidecar %s", furi_string_get_cstr(*path));
+            storage_common_remove(storage, furi_string_get_cstr(*path));
+        }
+
+    SubGhzFileEncoderPathArray_clear(stale);
+    free(name);
+    furi_string_free(file_path);
+    furi_string_free(sidecar_path);
+    storage_file_free(sidecar);
+    storage_file_free(folder);
+}
+
+bool subghz_file_encoder_worker_build_sidecar(Storage* storage, const char* file_path) {
+    furi_check(storage);
+    furi_check(file_path);
+
+    SubGhzFileEncoderSidecarHeader source;
+    if(!subghz_file_encoder_worker_sidecar_source(storage, file_path, &source)) {
+        FURI_LOG_E(TAG, "Unable to read: %s", file_path);
+        return false;
+    }
+
+    FuriString* sidecar_path = furi_string_alloc();
+    subghz_file_encoder_worker_sidecar_path(file_path, sidecar_path);
+    File* sidecar = storage_file_alloc(storage);
+    SubGhzFileEncoderSidecarHeader header;
+
+    bool result = subghz_file_encoder_worker_sidecar_check(
+        sidecar, furi_string_get_cstr(sidecar_path), &source, &header, NULL);
+    storage_file_close(sidecar);
+
+    if(!result) {
+        result = subghz_file_encoder_worker_sidecar_write(
+            storage, file_path, sidecar, furi_string_get_cstr(sidecar_path), &source);
+        storage_file_close(sidecar);
+        if(result) {
+            FURI_LOG_I(
+                TAG, "Sidecar saved: %lu values, %lu bytes", source.value_count, source.data_size);
+            subghz_file_encoder_worker_sidecar_prune(storage, furi_string_get_cstr(sidecar_path));
+        } else {
+            storage_common_remove(storage, furi_string_get_cstr(sidecar_path));
+        }
+    }
+
+    storage_file_free(sidecar);
+    furi_string_free(sidecar_path);
+
+    return result;
+}
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <furi_hal.h>
+#include <storage/storage.h>
+
+/** Binary sidecars of RAW files, named by the RAW file path hash */
+#define SUBGHZ_FILE_ENCODER_SIDECAR_FOLDER EXT_PATH("subghz/.cache")
 
 #ifdef __cplusplus
 extern "C" {
@@ -64,6 +68,34 @@ void subghz_file_encoder_worker_stop(SubGhzFileEncoderWorker* instance);
  */
 bool subghz_file_encoder_worker_is_running(SubGhzFileEncoderWorker* instance);
 
+/** 
+ * Build binary sidecar of a RAW file.
+ * Worker replays a sidecar instead of the text when it matches the text size and the CRC
+ * of the first and last KiB of the text. Parses the whole text, call it from a background
+ * thread after the file is saved, never during transmission. Does nothing if the sidecar
+ * is already up to date. After a new sidecar is written, sidecars of RAW files removed or
+ * changed since are removed too.
+ * @param storage Pointer to a Storage instance
+ * @param file_path RAW file path
+ * @return bool - true if the sidecar is up to date, false for files that are not RAW
+ */
+bool subghz_file_encoder_worker_build_sidecar(Storage* storage, const char* file_path);
+
+/** 
+ * Get binary sidecar path of a RAW file.
+ * @param file_path RAW file path
+ * @param sidecar_path sidecar path, set
+ */
+void subghz_file_encoder_worker_get_sidecar_path(const char* file_path, FuriString* sidecar_path);
+
+/** 
+ * Remove binary sidecar of a RAW file.
+ * Call this when the RAW file is deleted or renamed.
+ * @param storage Pointer to a Storage instance
+ * @param file_path RAW file path
+ */
+void subghz_file_encoder_worker_remove_sidecar(Storage* storage, const char* file_path);
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,19 +21,32 @@
 #define SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE 512
 #define SUBGHZ_KEYSTORE_FILE_ENCRYPTED_LINE_SIZE (SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE * 2)
 
+#define SUBGHZ_KEYSTORE_RECENT_SIZE 4
+
 typedef enum {
     SubGhzKeystoreEncryptionNone,
     SubGhzKeystoreEncryptionAES256,
 } SubGhzKeystoreEncryption;
 
+ARRAY_DEF(SubGhzKeystoreNameArray, FuriString*, M_PTR_OPLIST) // NOLINT
+
 struct SubGhzKeystore {
     SubGhzKeyArray_t data;
+    // Sorted unique manufacture names, owned by keystore and shared by keys
+    SubGhzKeystoreNameArray_t names;
+
+    SubGhzKeystoreEntry* table;
+    size_t table_count;
+
+    size_t recent[SUBGHZ_KEYSTORE_RECENT_SIZE];
+    size_t recent_count;
 };
 
 SubGhzKeystore* subghz_keystore_alloc(void) {
     SubGhzKeystore* instance = malloc(sizeof(SubGhzKeystore));
 
     SubGhzKeyArray_init(instance->data);
+    SubGhzKeystoreNameArray_init(instance->names);
 
     return instance;
 }
@@ -43,25 +56,95 @@ void subghz_keystore_free(SubGhzKeystore* instance) {
 
     for
         M_EACH(manufacture_code, instance->data, SubGhzKeyArray_t) {
-            furi_string_free(manufacture_code->name);
             manufacture_code->key = 0;
         }
     SubGhzKeyArray_clear(instance->data);
 
+    for
+        M_EACH(name, instance->names, SubGhzKeystoreNameArray_t) {
+            furi_string_free(*name);
+        }
+    SubGhzKeystoreNameArray_clear(instance->names);
+
+    if(instance->table) {
+        memset(instance->table, 0, sizeof(SubGhzKeystoreEntry) * instance->table_count);
+        free(instance->table);
+    }
+
     free(instance);
 }
 
+static bool
+    subghz_keystore_search_name(SubGhzKeystore* instance, const char* name, size_t* position) {
+    size_t low = 0;
+    size_t high = SubGhzKeystoreNameArray_size(instance->names);
+
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        FuriString* middle_name = *SubGhzKeystoreNameArray_cget(instance->names, middle);
+        int res = strcmp(furi_string_get_cstr(middle_name), name);
+        if(res == 0) {
+            *position = middle;
+            return true;
+        } else if(res < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    *position = low;
+    return false;
+}
+
+static FuriString* subghz_keystore_intern_name(SubGhzKeystore* instance, const char* name) {
+    size_t position = 0;
+    if(!subghz_keystore_search_name(instance, name, &position)) {
+        SubGhzKeystoreNameArray_push_at(instance->names, position, furi_string_alloc_set(name));
+    }
+    return *SubGhzKeystoreNameArray_get(instance->names, position);
+}
+
 static void subghz_keystore_add_key(
     SubGhzKeystore* instance,
     const char* name,
     uint64_t key,
     uint16_t type) {
     SubGhzKey* manufacture_code = SubGhzKeyArray_push_raw(instance->data);
-    manufacture_code->name = furi_string_alloc_set(name);
+    manufacture_code->name = subghz_keystore_intern_name(instance, name);
     manufacture_code->key = key;
     manufacture_code->type = type;
 }
 
+static void subghz_keystore_build_table(SubGhzKeystore* instance) {
+    if(instance->table) {
+        memset(instance->table, 0, sizeof(SubGhzKeystoreEntry) * instance->table_count);
+        free(instance->table);
+        instance->table = NULL;
+    }
+    instance->table_count = SubGhzKeyArray_size(instance->data);
+    instance->recent_count = 0;
+
+    if(instance->table_count == 0) return;
+
+    // File order is kept, the first matching key wins as it did before the table
+    instance->table = malloc(sizeof(SubGhzKeystoreEntry) * instance->table_count);
+    size_t index = 0;
+    for
+        M_EACH(manufacture_code, instance->data, SubGhzKeyArray_t) {
+            SubGhzKeystoreEntry* entry = &instance->table[index++];
+            entry->key = manufacture_code->key;
+            entry->name = furi_string_get_cstr(manufacture_code->name);
+            entry->type = manufacture_code->type;
+        }
+
+    FURI_LOG_D(
+        TAG,
+        "Lookup table: %zu keys, %zu names",
+        instance->table_count,
+        SubGhzKeystoreNameArray_size(instance->names));
+}
+
 static bool subghz_keystore_process_line(SubGhzKeystore* instance, char* line) {
     uint64_t key = 0;
     uint16_t type = 0;
@@ -240,6 +323,8 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
 
     furi_string_free(filetype);
 
+    subghz_keystore_build_table(instance);
+
     return result;
 }
 
@@ -343,6 +428,54 @@ SubGhzKeyArray_t* subghz_keystore_get_data(SubGhzKeystore* instance) {
     return &instance->data;
 }
 
+const SubGhzKeystoreEntry* subghz_keystore_get_table(SubGhzKeystore* instance, size_t* count) {
+    furi_assert(instance);
+    furi_assert(count);
+    *count = instance->table_count;
+    return instance->table;
+}
+
+const SubGhzKeystoreEntry* subghz_keystore_get_recent(SubGhzKeystore* instance, size_t index) {
+    furi_assert(instance);
+    if(index >= instance->recent_count) return NULL;
+    return &instance->table[instance->recent[index]];
+}
+
+void subghz_keystore_set_recent(SubGhzKeystore* instance, const SubGhzKeystoreEntry* entry) {
+    furi_assert(instance);
+    furi_assert(entry >= instance->table);
+    furi_assert(entry < instance->table + instance->table_count);
+
+    size_t table_index = entry - instance->table;
+
+    // Find entry in the list or drop the least recently matched one
+    size_t position = 0;
+    while(position < instance->recent_count && instance->recent[position] != table_index) {
+        position++;
+    }
+    if(position == instance->recent_count) {
+        if(instance->recent_count < SUBGHZ_KEYSTORE_RECENT_SIZE) {
+            instance->recent_count++;
+        } else {
+            position--;
+        }
+    }
+
+    // Move to front
+    for(; position > 0; position--) {
+        instance->recent[position] = instance->recent[position - 1];
+    }
+    instance->recent[0] = table_index;
+}
+
+const char* subghz_keystore_find_name(SubGhzKeystore* instance, const char* name) {
+    furi_assert(instance);
+    furi_assert(name);
+    size_t position = 0;
+    if(!subghz_keystore_search_name(instance, name, &position)) return NULL;
+    return furi_string_get_cstr(*SubGhzKeystoreNameArray_cget(instance->names, position));
+}
+
 bool subghz_keystore_raw_encrypted_save(
     const char* input_file_name,
     const char* output_file_name,
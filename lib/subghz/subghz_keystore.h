@@ -18,6 +18,13 @@ ARRAY_DEF(SubGhzKeyArray, SubGhzKey, M_POD_OPLIST)
 
 #define M_OPL_SubGhzKeyArray_t() ARRAY_OPLIST(SubGhzKeyArray, M_POD_OPLIST)
 
+/** Compact lookup table entry, built from SubGhzKeyArray at load time */
+typedef struct {
+    uint64_t key;
+    const char* name; /**< Interned name, shared by all keys of the same manufacture */
+    uint16_t type;
+} SubGhzKeystoreEntry;
+
 typedef struct SubGhzKeystore SubGhzKeystore;
 
 /**
@@ -54,6 +61,38 @@ bool subghz_keystore_save(SubGhzKeystore* instance, const char* filename, uint8_
  */
 SubGhzKeyArray_t* subghz_keystore_get_data(SubGhzKeystore* instance);
 
+/** 
+ * Get compact lookup table, entries are in the order they were loaded
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param count Pointer to store the number of entries
+ * @return const SubGhzKeystoreEntry* pointer to the first entry, NULL if empty
+ */
+const SubGhzKeystoreEntry* subghz_keystore_get_table(SubGhzKeystore* instance, size_t* count);
+
+/** 
+ * Get recently matched entry, most recent first
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param index Position in the recently matched list
+ * @return const SubGhzKeystoreEntry* pointer to the entry, NULL if index is out of range
+ */
+const SubGhzKeystoreEntry* subghz_keystore_get_recent(SubGhzKeystore* instance, size_t index);
+
+/** 
+ * Mark table entry as recently matched, so it will be returned first by subghz_keystore_get_recent
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param entry Pointer to an entry obtained from subghz_keystore_get_table
+ */
+void subghz_keystore_set_recent(SubGhzKeystore* instance, const SubGhzKeystoreEntry* entry);
+
+/** 
+ * Find interned manufacture name
+ * Interned names can be compared by pointer against SubGhzKeystoreEntry.name
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param name Manufacture name
+ * @return const char* interned name, NULL if there is no such name in the keystore
+ */
+const char* subghz_keystore_find_name(SubGhzKeystore* instance, const char* name);
+
 /** 
  * Save RAW encrypted to file
  * @param input_file_name Full path to the input file
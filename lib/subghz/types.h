@@ -8,6 +8,7 @@
 #include <lib/toolbox/level_duration.h>
 
 #include "environment.h"
+#include "blocks/const.h"
 #include <furi.h>
 #include <furi_hal.h>
 
@@ -92,6 +93,10 @@ typedef struct {
     SubGhzGetString get_string;
     SubGhzSerialize serialize;
     SubGhzDeserialize deserialize;
+
+    // Timing envelope, optional. Pulses shorter than te_short - te_delta are not
+    // delivered to the idle decoder, so the decoder must not accept them in any state.
+    const SubGhzBlockConst* timing;
 } SubGhzProtocolDecoder;
 
 typedef struct {
@@ -88,6 +88,13 @@ void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint
     }
 }
 
+size_t compress_icon_get_compressed_size(const uint8_t* icon_data) {
+    furi_check(icon_data);
+
+    const CompressHeader* header = (const CompressHeader*)icon_data;
+    return header->is_compressed ? sizeof(CompressHeader) + header->compressed_buff_size : 0;
+}
+
 struct Compress {
     const void* config;
     heatshrink_encoder* encoder;
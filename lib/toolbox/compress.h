@@ -44,6 +44,15 @@ void compress_icon_free(CompressIcon* instance);
  */
 void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint8_t** output);
 
+/** Get size of compressed icon data
+ *
+ * @param      icon_data  pointer to icon data
+ *
+ * @return     size of icon data including header, 0 if icon data is not
+ *             compressed
+ */
+size_t compress_icon_get_compressed_size(const uint8_t* icon_data);
+
 //////////////////////////////////////////////////////////////////////////
 
 /** Compress control structure */
@@ -1,6 +1,9 @@
 #include "dir_walk.h"
 #include <m-list.h>
 
+#define DIR_WALK_BATCH_SIZE       16
+#define DIR_WALK_BATCH_NAMES_SIZE (4 * STORAGE_DIR_BATCH_NAME_SIZE)
+
 LIST_DEF(DirIndexList, uint32_t);
 
 struct DirWalk {
@@ -8,6 +11,10 @@ struct DirWalk {
     FuriString* path;
     DirIndexList_t index_list;
     uint32_t current_index;
+    StorageDirEntry* batch;
+    char* batch_names;
+    size_t batch_count;
+    size_t batch_pos;
     bool recursive;
     DirWalkFilterCb filter_cb;
     void* filter_context;
@@ -20,6 +27,8 @@ DirWalk* dir_walk_alloc(Storage* storage) {
     dir_walk->path = furi_string_alloc();
     dir_walk->file = storage_file_alloc(storage);
     DirIndexList_init(dir_walk->index_list);
+    dir_walk->batch = malloc(sizeof(StorageDirEntry) * DIR_WALK_BATCH_SIZE);
+    dir_walk->batch_names = malloc(DIR_WALK_BATCH_NAMES_SIZE);
     dir_walk->recursive = true;
     dir_walk->filter_cb = NULL;
     return dir_walk;
@@ -31,6 +40,8 @@ void dir_walk_free(DirWalk* dir_walk) {
     storage_file_free(dir_walk->file);
     furi_string_free(dir_walk->path);
     DirIndexList_clear(dir_walk->index_list);
+    free(dir_walk->batch_names);
+    free(dir_walk->batch);
     free(dir_walk);
 }
 
@@ -45,11 +56,38 @@ void dir_walk_set_filter_cb(DirWalk* dir_walk, DirWalkFilterCb cb, void* context
     dir_walk->filter_context = context;
 }
 
+// Items are read ahead in batches, read ahead items are dropped whenever the directory is reopened
+static bool dir_walk_dir_open(DirWalk* dir_walk) {
+    dir_walk->batch_count = 0;
+    dir_walk->batch_pos = 0;
+    return storage_dir_open(dir_walk->file, furi_string_get_cstr(dir_walk->path));
+}
+
+static bool dir_walk_dir_read(DirWalk* dir_walk, const char** name, FileInfo* fileinfo) {
+    if(dir_walk->batch_pos == dir_walk->batch_count) {
+        dir_walk->batch_pos = 0;
+        dir_walk->batch_count = storage_dir_read_batch(
+            dir_walk->file,
+            dir_walk->batch,
+            DIR_WALK_BATCH_SIZE,
+            dir_walk->batch_names,
+            DIR_WALK_BATCH_NAMES_SIZE);
+        if(dir_walk->batch_count == 0) {
+            return false;
+        }
+    }
+
+    const StorageDirEntry* entry = &dir_walk->batch[dir_walk->batch_pos++];
+    *name = entry->name;
+    *fileinfo = entry->fileinfo;
+    return true;
+}
+
 bool dir_walk_open(DirWalk* dir_walk, const char* path) {
     furi_check(dir_walk);
     furi_string_set(dir_walk->path, path);
     dir_walk->current_index = 0;
-    return storage_dir_open(dir_walk->file, path);
+    return dir_walk_dir_open(dir_walk);
 }
 
 static bool dir_walk_filter(DirWalk* dir_walk, const char* name, FileInfo* fileinfo) {
@@ -63,12 +101,12 @@ static bool dir_walk_filter(DirWalk* dir_walk, const char* name, FileInfo* filei
 static DirWalkResult
     dir_walk_iter(DirWalk* dir_walk, FuriString* return_path, FileInfo* fileinfo) {
     DirWalkResult result = DirWalkError;
-    char* name = malloc(256); // FIXME: remove magic number
+    const char* name = NULL;
     FileInfo info;
     bool end = false;
 
     while(!end) {
-        storage_dir_read(dir_walk->file, &info, name, 255);
+        dir_walk_dir_read(dir_walk, &name, &info);
 
         if(storage_file_get_error(dir_walk->file) == FSE_OK) {
             result = DirWalkOK;
@@ -97,7 +135,7 @@ static DirWalkResult
                 storage_dir_close(dir_walk->file);
 
                 furi_string_cat_printf(dir_walk->path, "/%s", name);
-                storage_dir_open(dir_walk->file, furi_string_get_cstr(dir_walk->path));
+                dir_walk_dir_open(dir_walk);
             }
         } else if(storage_file_get_error(dir_walk->file) == FSE_NOT_EXIST) {
             if(DirIndexList_size(dir_walk->index_list) == 0) {
@@ -117,7 +155,7 @@ static DirWalkResult
                     furi_string_left(dir_walk->path, last_char);
                 }
 
-                storage_dir_open(dir_walk->file, furi_string_get_cstr(dir_walk->path));
+                dir_walk_dir_open(dir_walk);
 
                 // rewind
                 while(true) {
@@ -126,7 +164,7 @@ static DirWalkResult
                         break;
                     }
 
-                    if(!storage_dir_read(dir_walk->file, &info, name, 255)) {
+                    if(!dir_walk_dir_read(dir_walk, &name, &info)) {
                         result = DirWalkError;
                         end = true;
                         break;
@@ -141,7 +179,6 @@ static DirWalkResult
         }
     }
 
-    free(name);
     return result;
 }
 
@@ -164,4 +201,6 @@ void dir_walk_close(DirWalk* dir_walk) {
     DirIndexList_reset(dir_walk->index_list);
     furi_string_reset(dir_walk->path);
     dir_walk->current_index = 0;
+    dir_walk->batch_count = 0;
+    dir_walk->batch_pos = 0;
 }
@@ -5,14 +5,52 @@
 #include <toolbox/stream/file_stream.h>
 #include <toolbox/stream/buffered_file_stream.h>
 #include <toolbox/args.h>
+#include <toolbox/crc32_calc.h>
 
 #define TAG "KeysDict"
 
+#define KEYS_DICT_INDEX_EXTENSION ".idx"
+#define KEYS_DICT_INDEX_MAGIC     (0x5844494BUL) // "KIDX"
+#define KEYS_DICT_INDEX_VERSION   (1U)
+#define KEYS_DICT_INDEX_READ_KEYS (32U)
+#define KEYS_DICT_CRC_BUFFER_SIZE (512U)
+
+/*
+ * Compiled index file layout:
+ * - KeysDictIndexHeader
+ * - key_count keys in the text file order, used for iteration
+ * - key_count keys sorted with memcmp, used for presence checks
+ * Text file stays the source of truth, index is rebuilt when text size or CRC changes.
+ */
+typedef struct {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t key_size;
+    uint16_t reserved;
+    uint32_t key_count;
+    uint32_t source_size;
+    uint32_t source_crc;
+    uint32_t checksum;
+} KeysDictIndexHeader;
+
 struct KeysDict {
     Stream* stream;
     size_t key_size;
     size_t key_size_symbols;
     size_t total_keys;
+
+    Storage* storage;
+    FuriString* index_path;
+    File* index_file;
+    bool index_valid;
+    size_t index_keys;
+    size_t index_position;
+    uint8_t* index_buffer;
+    size_t index_buffer_start;
+    size_t index_buffer_count;
+    // Keys appended to the text file after the index was loaded
+    uint8_t* added_keys;
+    size_t added_keys_count;
 };
 
 static inline void keys_dict_add_ending_new_line(KeysDict* instance) {
@@ -64,14 +102,204 @@ bool keys_dict_check_presence(const char* path) {
     return dict_present;
 }
 
+static void keys_dict_str_to_int(KeysDict* instance, FuriString* key_str, uint64_t* key_int);
+
+static uint32_t keys_dict_calc_text_crc(KeysDict* instance) {
+    uint8_t* buffer = malloc(KEYS_DICT_CRC_BUFFER_SIZE);
+    uint32_t crc = 0;
+
+    stream_rewind(instance->stream);
+    size_t bytes_read = 0;
+    do {
+        bytes_read = stream_read(instance->stream, buffer, KEYS_DICT_CRC_BUFFER_SIZE);
+        crc = crc32_calc_buffer(crc, buffer, bytes_read);
+    } while(bytes_read == KEYS_DICT_CRC_BUFFER_SIZE);
+    stream_rewind(instance->stream);
+
+    free(buffer);
+    return crc;
+}
+
+static inline size_t keys_dict_index_get_offset(KeysDict* instance, size_t block, size_t index) {
+    return sizeof(KeysDictIndexHeader) +
+           (block * instance->index_keys + index) * instance->key_size;
+}
+
+static bool keys_dict_index_load(KeysDict* instance, uint32_t source_size, uint32_t source_crc) {
+    bool index_loaded = false;
+    const char* index_path = furi_string_get_cstr(instance->index_path);
+
+    do {
+        if(!storage_file_open(instance->index_file, index_path, FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+
+        KeysDictIndexHeader header;
+        if(storage_file_read(instance->index_file, &header, sizeof(header)) != sizeof(header))
+            break;
+        if(header.magic != KEYS_DICT_INDEX_MAGIC || header.version != KEYS_DICT_INDEX_VERSION ||
+           header.key_size != instance->key_size) {
+            FURI_LOG_W(TAG, "Index format mismatch");
+            break;
+        }
+        if(header.source_size != source_size || header.source_crc != source_crc) {
+            FURI_LOG_I(TAG, "Index is outdated");
+            break;
+        }
+
+        // Block read of the whole index to verify it
+        size_t keys_size = header.key_count * instance->key_size * 2;
+        size_t buffer_size = instance->key_size * KEYS_DICT_INDEX_READ_KEYS;
+        uint32_t checksum = 0;
+        while(keys_size > 0) {
+            size_t bytes_to_read = MIN(keys_size, buffer_size);
+            if(storage_file_read(instance->index_file, instance->index_buffer, bytes_to_read) !=
+               bytes_to_read)
+                break;
+            checksum = crc32_calc_buffer(checksum, instance->index_buffer, bytes_to_read);
+            keys_size -= bytes_to_read;
+        }
+        if(keys_size > 0 || checksum != header.checksum) {
+            FURI_LOG_W(TAG, "Index is corrupted");
+            break;
+        }
+
+        instance->index_keys = header.key_count;
+        index_loaded = true;
+    } while(false);
+
+    if(!index_loaded) {
+        storage_file_close(instance->index_file);
+    }
+
+    return index_loaded;
+}
+
+static int keys_dict_index_key_cmp(const void* a, const void* b) {
+    uint64_t key_a = *(const uint64_t*)a;
+    uint64_t key_b = *(const uint64_t*)b;
+    return (key_a > key_b) - (key_a < key_b);
+}
+
+static bool keys_dict_index_write_keys(
+    KeysDict* instance,
+    const uint64_t* keys,
+    size_t key_count,
+    uint32_t* checksum) {
+    // Keys are stored big endian, so numeric order matches memcmp order
+    for(size_t i = 0; i < key_count; i += KEYS_DICT_INDEX_READ_KEYS) {
+        size_t keys_to_write = MIN(KEYS_DICT_INDEX_READ_KEYS, key_count - i);
+        for(size_t j = 0; j < keys_to_write; j++) {
+            uint64_t key_int = keys[i + j];
+            uint8_t* key = &instance->index_buffer[j * instance->key_size];
+            for(size_t k = instance->key_size; k > 0; k--) {
+                key[k - 1] = (uint8_t)key_int;
+                key_int >>= 8;
+            }
+        }
+        size_t bytes_to_write = keys_to_write * instance->key_size;
+        *checksum = crc32_calc_buffer(*checksum, instance->index_buffer, bytes_to_write);
+        if(storage_file_write(instance->index_file, instance->index_buffer, bytes_to_write) !=
+           bytes_to_write) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool keys_dict_index_save(
+    KeysDict* instance,
+    uint64_t* keys,
+    size_t key_count,
+    uint32_t source_size,
+    uint32_t source_crc) {
+    bool index_saved = false;
+    const char* index_path = furi_string_get_cstr(instance->index_path);
+
+    KeysDictIndexHeader header = {
+        .magic = KEYS_DICT_INDEX_MAGIC,
+        .version = KEYS_DICT_INDEX_VERSION,
+        .key_size = instance->key_size,
+        .reserved = 0,
+        .key_count = key_count,
+        .source_size = source_size,
+        .source_crc = source_crc,
+        .checksum = 0,
+    };
+
+    do {
+        if(!storage_file_open(
+               instance->index_file, index_path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS))
+            break;
+
+        // Text order block first, then sort the same array in place
+        if(!storage_file_seek(instance->index_file, sizeof(header), true)) break;
+        if(!keys_dict_index_write_keys(instance, keys, key_count, &header.checksum)) break;
+        qsort(keys, key_count, sizeof(uint64_t), keys_dict_index_key_cmp);
+        if(!keys_dict_index_write_keys(instance, keys, key_count, &header.checksum)) break;
+
+        if(!storage_file_seek(instance->index_file, 0, true)) break;
+        if(storage_file_write(instance->index_file, &header, sizeof(header)) != sizeof(header))
+            break;
+
+        instance->index_keys = key_count;
+        index_saved = true;
+        FURI_LOG_I(TAG, "Index saved: %s", index_path);
+    } while(false);
+
+    if(!index_saved) {
+        storage_file_close(instance->index_file);
+        storage_common_remove(instance->storage, index_path);
+    }
+
+    return index_saved;
+}
+
+static void keys_dict_load_text(KeysDict* instance, uint32_t source_size, uint32_t source_crc) {
+    FuriString* line = furi_string_alloc();
+
+    // Every key takes at least one full line, so text size limits the number of keys.
+    // Keys are collected for the index only if there is enough memory for them.
+    size_t keys_capacity = source_size / instance->key_size_symbols;
+    uint64_t* keys = NULL;
+    if(instance->key_size <= sizeof(uint64_t) && keys_capacity > 0 &&
+       keys_capacity * sizeof(uint64_t) < memmgr_heap_get_max_free_block() / 2) {
+        keys = malloc(keys_capacity * sizeof(uint64_t));
+    }
+
+    bool is_endfile = false;
+
+    // In this loop we only count the entries in the file
+    // We prefer not to load the whole file in memory for space reasons
+    while(!is_endfile) {
+        bool read_key = keys_dict_read_key_line(instance, line, &is_endfile);
+        if(read_key) {
+            if(keys && instance->total_keys < keys_capacity) {
+                keys_dict_str_to_int(instance, line, &keys[instance->total_keys]);
+            }
+            instance->total_keys++;
+        }
+    }
+
+    if(keys) {
+        if(instance->total_keys <= keys_capacity) {
+            instance->index_valid = keys_dict_index_save(
+                instance, keys, instance->total_keys, source_size, source_crc);
+        }
+        free(keys);
+    }
+
+    furi_string_free(line);
+}
+
 KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size) {
     furi_check(path);
     furi_check(key_size > 0);
 
     KeysDict* instance = malloc(sizeof(KeysDict));
 
-    Storage* storage = furi_record_open(RECORD_STORAGE);
-    instance->stream = buffered_file_stream_alloc(storage);
+    instance->storage = furi_record_open(RECORD_STORAGE);
+    instance->stream = buffered_file_stream_alloc(instance->storage);
 
     FS_OpenMode open_mode = (mode == KeysDictModeOpenAlways) ? FSOM_OPEN_ALWAYS :
                                                                FSOM_OPEN_EXISTING;
@@ -82,6 +310,10 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
 
     instance->total_keys = 0;
 
+    instance->index_path = furi_string_alloc_printf("%s%s", path, KEYS_DICT_INDEX_EXTENSION);
+    instance->index_file = storage_file_alloc(instance->storage);
+    instance->index_buffer = malloc(key_size * KEYS_DICT_INDEX_READ_KEYS);
+
     bool file_exists =
         buffered_file_stream_open(instance->stream, path, FSAM_READ_WRITE, open_mode);
 
@@ -90,24 +322,24 @@ KeysDict* keys_dict_alloc(const char* path, KeysDictMode mode, size_t key_size)
     } else {
         // Eventually add new line character in the last line to avoid skipping keys
         keys_dict_add_ending_new_line(instance);
-    }
 
-    FuriString* line = furi_string_alloc();
-
-    bool is_endfile = false;
+        uint32_t source_size = stream_size(instance->stream);
+        uint32_t source_crc = keys_dict_calc_text_crc(instance);
 
-    // In this loop we only count the entries in the file
-    // We prefer not to load the whole file in memory for space reasons
-    while(file_exists && !is_endfile) {
-        bool read_key = keys_dict_read_key_line(instance, line, &is_endfile);
-        if(read_key) {
-            instance->total_keys++;
+        instance->index_valid = keys_dict_index_load(instance, source_size, source_crc);
+        if(instance->index_valid) {
+            instance->total_keys = instance->index_keys;
+        } else {
+            keys_dict_load_text(instance, source_size, source_crc);
         }
     }
-    stream_rewind(instance->stream);
-    FURI_LOG_I(TAG, "Loaded dictionary with %zu keys", instance->total_keys);
 
-    furi_string_free(line);
+    stream_rewind(instance->stream);
+    FURI_LOG_I(
+        TAG,
+        "Loaded dictionary with %zu keys%s",
+        instance->total_keys,
+        instance->index_valid ? " from index" : "");
 
     return instance;
 }
@@ -118,6 +350,15 @@ void keys_dict_free(KeysDict* instance) {
 
     buffered_file_stream_close(instance->stream);
     stream_free(instance->stream);
+
+    if(instance->index_valid) {
+        storage_file_close(instance->index_file);
+    }
+    storage_file_free(instance->index_file);
+    furi_string_free(instance->index_path);
+    free(instance->index_buffer);
+    free(instance->added_keys);
+
     free(instance);
 
     furi_record_close(RECORD_STORAGE);
@@ -153,6 +394,18 @@ static void keys_dict_str_to_int(KeysDict* instance, FuriString* key_str, uint64
     }
 }
 
+static void keys_dict_str_to_bytes(KeysDict* instance, FuriString* key_str, uint8_t* key) {
+    uint64_t key_int = 0;
+    size_t tmp_len = instance->key_size;
+
+    keys_dict_str_to_int(instance, key_str, &key_int);
+
+    while(tmp_len--) {
+        key[tmp_len] = (uint8_t)key_int;
+        key_int >>= 8;
+    }
+}
+
 size_t keys_dict_get_total_keys(KeysDict* instance) {
     furi_check(instance);
 
@@ -163,9 +416,79 @@ bool keys_dict_rewind(KeysDict* instance) {
     furi_check(instance);
     furi_check(instance->stream);
 
+    instance->index_position = 0;
+    instance->index_buffer_count = 0;
+
     return stream_rewind(instance->stream);
 }
 
+static bool keys_dict_index_get_next_key(KeysDict* instance, uint8_t* key) {
+    size_t position = instance->index_position;
+    size_t key_size = instance->key_size;
+
+    if(position < instance->index_keys) {
+        if(position < instance->index_buffer_start ||
+           position >= instance->index_buffer_start + instance->index_buffer_count) {
+            // Read ahead a block of keys in the text file order
+            size_t keys_to_read = MIN(KEYS_DICT_INDEX_READ_KEYS, instance->index_keys - position);
+            size_t bytes_to_read = keys_to_read * key_size;
+            size_t offset = keys_dict_index_get_offset(instance, 0, position);
+            if(!storage_file_seek(instance->index_file, offset, true) ||
+               storage_file_read(instance->index_file, instance->index_buffer, bytes_to_read) !=
+                   bytes_to_read) {
+                return false;
+            }
+            instance->index_buffer_start = position;
+            instance->index_buffer_count = keys_to_read;
+        }
+        size_t buffer_index = position - instance->index_buffer_start;
+        memcpy(key, &instance->index_buffer[buffer_index * key_size], key_size);
+    } else if(position - instance->index_keys < instance->added_keys_count) {
+        size_t added_index = position - instance->index_keys;
+        memcpy(key, &instance->added_keys[added_index * key_size], key_size);
+    } else {
+        return false;
+    }
+
+    instance->index_position++;
+    return true;
+}
+
+static bool keys_dict_index_is_key_present(KeysDict* instance, const uint8_t* key) {
+    for(size_t i = 0; i < instance->added_keys_count; i++) {
+        if(memcmp(&instance->added_keys[i * instance->key_size], key, instance->key_size) == 0) {
+            return true;
+        }
+    }
+
+    // Binary search over the sorted block
+    uint8_t* middle_key = instance->index_buffer;
+    size_t low = 0;
+    size_t high = instance->index_keys;
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        if(!storage_file_seek(
+               instance->index_file, keys_dict_index_get_offset(instance, 1, middle), true) ||
+           storage_file_read(instance->index_file, middle_key, instance->key_size) !=
+               instance->key_size) {
+            break;
+        }
+        int res = memcmp(middle_key, key, instance->key_size);
+        if(res == 0) {
+            // Read ahead buffer was used for the search
+            instance->index_buffer_count = 0;
+            return true;
+        } else if(res < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    instance->index_buffer_count = 0;
+    return false;
+}
+
 static bool keys_dict_get_next_key_str(KeysDict* instance, FuriString* key) {
     furi_assert(instance);
     furi_assert(instance->stream);
@@ -188,20 +511,16 @@ bool keys_dict_get_next_key(KeysDict* instance, uint8_t* key, size_t key_size) {
     furi_check(instance->key_size == key_size);
     furi_check(key);
 
+    if(instance->index_valid) {
+        return keys_dict_index_get_next_key(instance, key);
+    }
+
     FuriString* temp_key = furi_string_alloc();
 
     bool key_read = keys_dict_get_next_key_str(instance, temp_key);
 
     if(key_read) {
-        size_t tmp_len = key_size;
-        uint64_t key_int = 0;
-
-        keys_dict_str_to_int(instance, temp_key, &key_int);
-
-        while(tmp_len--) {
-            key[tmp_len] = (uint8_t)key_int;
-            key_int >>= 8;
-        }
+        keys_dict_str_to_bytes(instance, temp_key, key);
     }
 
     furi_string_free(temp_key);
@@ -240,6 +559,10 @@ bool keys_dict_is_key_present(KeysDict* instance, const uint8_t* key, size_t key
     furi_check(instance->key_size == key_size);
     furi_check(key);
 
+    if(instance->index_valid) {
+        return keys_dict_index_is_key_present(instance, key);
+    }
+
     FuriString* temp_key = furi_string_alloc();
 
     keys_dict_int_to_str(instance, key, temp_key);
@@ -282,6 +605,15 @@ bool keys_dict_add_key(KeysDict* instance, const uint8_t* key, size_t key_size)
     keys_dict_int_to_str(instance, key, temp_key);
     bool key_added = keys_dict_add_key_str(instance, temp_key);
 
+    if(key_added && instance->index_valid) {
+        // Key is appended to the text file, keep it in memory until the index is rebuilt
+        instance->added_keys = realloc( //-V701
+            instance->added_keys,
+            (instance->added_keys_count + 1) * key_size);
+        memcpy(&instance->added_keys[instance->added_keys_count * key_size], key, key_size);
+        instance->added_keys_count++;
+    }
+
     FURI_LOG_I(TAG, "Added key %s", furi_string_get_cstr(temp_key));
 
     furi_string_free(temp_key);
@@ -297,6 +629,15 @@ bool keys_dict_delete_key(KeysDict* instance, const uint8_t* key, size_t key_siz
 
     bool key_removed = false;
 
+    // Deletion changes text file order, fall back to the text file until the index is rebuilt
+    if(instance->index_valid) {
+        storage_file_close(instance->index_file);
+        instance->index_valid = false;
+        free(instance->added_keys);
+        instance->added_keys = NULL;
+        instance->added_keys_count = 0;
+    }
+
     uint8_t* temp_key = malloc(key_size);
 
     stream_rewind(instance->stream);
@@ -7,12 +7,29 @@
 extern "C" {
 #endif
 
+/** Default cache size, four storage sectors */
+#define BUFFERED_FILE_STREAM_CACHE_SIZE_DEFAULT 2048U
+
+typedef struct {
+    uint32_t hits; /**< cache block lookups served without file access */
+    uint32_t misses; /**< cache block lookups that needed a new block */
+    uint32_t write_backs; /**< dirty ranges written to the file */
+} BufferedFileStreamCacheStats;
+
 /**
  * Allocate a file stream with buffered read operations
  * @return Stream*
  */
 Stream* buffered_file_stream_alloc(Storage* storage);
 
+/**
+ * Allocate a file stream with buffered read operations and a given cache size
+ * @param storage pointer to storage object
+ * @param cache_size cache size in bytes, rounded down to whole 512 byte blocks
+ * @return Stream*
+ */
+Stream* buffered_file_stream_alloc_ex(Storage* storage, size_t cache_size);
+
 /**
  * Opens an existing file or creates a new one.
  * @param stream pointer to file stream object.
@@ -48,6 +65,13 @@ bool buffered_file_stream_sync(Stream* stream);
  */
 FS_Error buffered_file_stream_get_error(Stream* stream);
 
+/**
+ * Retrieves cache statistics collected since the stream was allocated
+ * @param stream pointer to stream object.
+ * @param stats pointer to stats structure to fill
+ */
+void buffered_file_stream_get_cache_stats(Stream* stream, BufferedFileStreamCacheStats* stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,92 +1,272 @@
 #include "stream_cache.h"
 
-#define STREAM_CACHE_MAX_SIZE 1024U
+#define STREAM_CACHE_OFFSET_NONE SIZE_MAX
+
+typedef struct {
+    // Block aligned offset in the stream, STREAM_CACHE_OFFSET_NONE if unused
+    size_t offset;
+    // Range of block data that matches the stream
+    size_t valid_start;
+    size_t valid_end;
+    // Range of block data that is not written to the stream yet
+    size_t dirty_start;
+    size_t dirty_end;
+    uint32_t last_use;
+    uint8_t* data;
+} StreamCacheBlock;
 
 struct StreamCache {
-    uint8_t data[STREAM_CACHE_MAX_SIZE];
-    size_t data_size;
-    size_t position;
+    StreamCacheBlock* blocks;
+    size_t block_count;
+    // Known underlying stream position, STREAM_CACHE_OFFSET_NONE if unknown
+    size_t stream_position;
+    uint32_t use_counter;
+    StreamCacheStats stats;
+    uint8_t* data;
 };
 
-StreamCache* stream_cache_alloc(void) {
+static inline bool stream_cache_block_is_dirty(const StreamCacheBlock* block) {
+    return block->dirty_end > block->dirty_start;
+}
+
+static inline void stream_cache_block_reset(StreamCacheBlock* block) {
+    block->offset = STREAM_CACHE_OFFSET_NONE;
+    block->valid_start = 0;
+    block->valid_end = 0;
+    block->dirty_start = 0;
+    block->dirty_end = 0;
+    block->last_use = 0;
+}
+
+StreamCache* stream_cache_alloc(size_t size) {
     StreamCache* cache = malloc(sizeof(StreamCache));
-    cache->data_size = 0;
-    cache->position = 0;
+    cache->block_count = MAX(size / STREAM_CACHE_BLOCK_SIZE, 1U);
+    cache->blocks = malloc(sizeof(StreamCacheBlock) * cache->block_count);
+    cache->data = malloc(STREAM_CACHE_BLOCK_SIZE * cache->block_count);
+    for(size_t i = 0; i < cache->block_count; i++) {
+        cache->blocks[i].data = cache->data + STREAM_CACHE_BLOCK_SIZE * i;
+    }
+    cache->use_counter = 0;
+    cache->stats = (StreamCacheStats){0};
+    stream_cache_drop(cache);
     return cache;
 }
+
 void stream_cache_free(StreamCache* cache) {
     furi_assert(cache);
-    cache->data_size = 0;
-    cache->position = 0;
+    free(cache->data);
+    free(cache->blocks);
     free(cache);
 }
 
 void stream_cache_drop(StreamCache* cache) {
-    cache->data_size = 0;
-    cache->position = 0;
+    furi_assert(cache);
+    for(size_t i = 0; i < cache->block_count; i++) {
+        stream_cache_block_reset(&cache->blocks[i]);
+    }
+    cache->stream_position = STREAM_CACHE_OFFSET_NONE;
 }
 
-bool stream_cache_at_end(StreamCache* cache) {
-    furi_assert(cache->data_size >= cache->position);
-    return cache->data_size == cache->position;
+static bool stream_cache_seek_stream(StreamCache* cache, Stream* stream, size_t offset) {
+    if(cache->stream_position == offset) return true;
+
+    if(stream_seek(stream, offset, StreamOffsetFromStart)) {
+        cache->stream_position = offset;
+        return true;
+    } else {
+        cache->stream_position = STREAM_CACHE_OFFSET_NONE;
+        return false;
+    }
 }
 
-size_t stream_cache_size(StreamCache* cache) {
-    return cache->data_size;
+static StreamCacheBlock* stream_cache_find(StreamCache* cache, size_t block_offset) {
+    for(size_t i = 0; i < cache->block_count; i++) {
+        if(cache->blocks[i].offset == block_offset) return &cache->blocks[i];
+    }
+    return NULL;
 }
 
-size_t stream_cache_pos(StreamCache* cache) {
-    return cache->position;
+static StreamCacheBlock* stream_cache_get_victim(StreamCache* cache) {
+    StreamCacheBlock* victim = &cache->blocks[0];
+    for(size_t i = 0; i < cache->block_count; i++) {
+        StreamCacheBlock* block = &cache->blocks[i];
+        if(block->offset == STREAM_CACHE_OFFSET_NONE) return block;
+        if(block->last_use < victim->last_use) victim = block;
+    }
+    return victim;
 }
 
-size_t stream_cache_fill(StreamCache* cache, Stream* stream) {
-    const size_t size_read = stream_read(stream, cache->data, STREAM_CACHE_MAX_SIZE);
-    cache->data_size = size_read;
-    cache->position = 0;
-    return size_read;
+static bool stream_cache_has_dirty(StreamCache* cache) {
+    for(size_t i = 0; i < cache->block_count; i++) {
+        if(stream_cache_block_is_dirty(&cache->blocks[i])) return true;
+    }
+    return false;
 }
 
 bool stream_cache_flush(StreamCache* cache, Stream* stream) {
-    const size_t size_written = stream_write(stream, cache->data, cache->data_size);
-    const bool success = (size_written == cache->data_size);
-    cache->data_size = 0;
-    cache->position = 0;
+    furi_assert(cache);
+    bool success = true;
+
+    // Dirty blocks go in ascending order: writes never start beyond the end of
+    // the stream and adjacent blocks are written without seeking in between
+    while(true) {
+        StreamCacheBlock* block = NULL;
+        for(size_t i = 0; i < cache->block_count; i++) {
+            StreamCacheBlock* candidate = &cache->blocks[i];
+            if(!stream_cache_block_is_dirty(candidate)) continue;
+            if(!block || candidate->offset < block->offset) block = candidate;
+        }
+        if(!block) break;
+
+        const size_t size = block->dirty_end - block->dirty_start;
+        bool written = false;
+        if(stream_cache_seek_stream(cache, stream, block->offset + block->dirty_start)) {
+            const size_t size_written =
+                stream_write(stream, block->data + block->dirty_start, size);
+            cache->stream_position += size_written;
+            written = (size_written == size);
+        }
+        cache->stats.write_backs++;
+
+        block->dirty_start = 0;
+        block->dirty_end = 0;
+        if(!written) {
+            cache->stream_position = STREAM_CACHE_OFFSET_NONE;
+            stream_cache_block_reset(block);
+            success = false;
+        }
+    }
+
     return success;
 }
 
-size_t stream_cache_read(StreamCache* cache, uint8_t* data, size_t size) {
-    furi_assert(cache->data_size >= cache->position);
-    const size_t size_read = MIN(size, cache->data_size - cache->position);
-    if(size_read > 0) {
-        memcpy(data, cache->data + cache->position, size_read);
-        cache->position += size_read;
+static StreamCacheBlock*
+    stream_cache_get_for_read(StreamCache* cache, Stream* stream, size_t offset) {
+    const size_t block_offset = offset - offset % STREAM_CACHE_BLOCK_SIZE;
+    const size_t block_pos = offset - block_offset;
+
+    StreamCacheBlock* block = stream_cache_find(cache, block_offset);
+    if(block && block_pos >= block->valid_start && block_pos < block->valid_end) {
+        cache->stats.hits++;
+        block->last_use = ++cache->use_counter;
+        return block;
     }
+
+    cache->stats.misses++;
+    // Stream must have all the data before anything is loaded from it
+    if(stream_cache_has_dirty(cache)) {
+        if(!stream_cache_flush(cache, stream)) return NULL;
+    }
+
+    if(!block) block = stream_cache_get_victim(cache);
+    stream_cache_block_reset(block);
+
+    if(!stream_cache_seek_stream(cache, stream, block_offset)) return NULL;
+    const size_t size_read = stream_read(stream, block->data, STREAM_CACHE_BLOCK_SIZE);
+    cache->stream_position += size_read;
+    if(block_pos >= size_read) return NULL;
+
+    block->offset = block_offset;
+    block->valid_end = size_read;
+    block->last_use = ++cache->use_counter;
+    return block;
+}
+
+size_t stream_cache_read(
+    StreamCache* cache,
+    Stream* stream,
+    size_t offset,
+    uint8_t* data,
+    size_t size) {
+    furi_assert(cache);
+    size_t size_read = 0;
+
+    while(size_read < size) {
+        const size_t position = offset + size_read;
+        StreamCacheBlock* block = stream_cache_get_for_read(cache, stream, position);
+        if(!block) break;
+
+        const size_t block_pos = position - block->offset;
+        const size_t chunk_size = MIN(size - size_read, block->valid_end - block_pos);
+        memcpy(data + size_read, block->data + block_pos, chunk_size);
+        size_read += chunk_size;
+    }
+
     return size_read;
 }
 
-size_t stream_cache_write(StreamCache* cache, const uint8_t* data, size_t size) {
-    furi_assert(cache->data_size >= cache->position);
-    const size_t size_written = MIN(size, STREAM_CACHE_MAX_SIZE - cache->position);
-    if(size_written > 0) {
-        memcpy(cache->data + cache->position, data, size_written);
-        cache->position += size_written;
-        if(cache->position > cache->data_size) {
-            cache->data_size = cache->position;
+static StreamCacheBlock* stream_cache_get_for_write(
+    StreamCache* cache,
+    Stream* stream,
+    size_t block_offset,
+    size_t start,
+    size_t end) {
+    StreamCacheBlock* block = stream_cache_find(cache, block_offset);
+
+    if(block) {
+        cache->stats.hits++;
+        // Block can only hold one contiguous range of data
+        if(end < block->valid_start || start > block->valid_end) {
+            if(stream_cache_block_is_dirty(block)) {
+                if(!stream_cache_flush(cache, stream)) return NULL;
+            }
+            block->valid_start = start;
+            block->valid_end = start;
+        }
+    } else {
+        // Nothing is loaded: only the written range becomes valid
+        cache->stats.misses++;
+        block = stream_cache_get_victim(cache);
+        if(stream_cache_block_is_dirty(block)) {
+            if(!stream_cache_flush(cache, stream)) return NULL;
         }
+        stream_cache_block_reset(block);
+        block->offset = block_offset;
+        block->valid_start = start;
+        block->valid_end = start;
     }
-    return size_written;
+
+    block->last_use = ++cache->use_counter;
+    return block;
 }
 
-int32_t stream_cache_seek(StreamCache* cache, int32_t offset) {
-    furi_assert(cache->data_size >= cache->position);
-    int32_t actual_offset = 0;
+size_t stream_cache_write(
+    StreamCache* cache,
+    Stream* stream,
+    size_t offset,
+    const uint8_t* data,
+    size_t size) {
+    furi_assert(cache);
+    size_t size_written = 0;
+
+    while(size_written < size) {
+        const size_t position = offset + size_written;
+        const size_t block_offset = position - position % STREAM_CACHE_BLOCK_SIZE;
+        const size_t start = position - block_offset;
+        const size_t end = MIN(STREAM_CACHE_BLOCK_SIZE, start + size - size_written);
 
-    if(offset > 0) {
-        actual_offset = MIN(cache->data_size - cache->position, (size_t)offset);
-    } else if(offset < 0) {
-        actual_offset = MAX(-((int32_t)cache->position), offset);
+        StreamCacheBlock* block =
+            stream_cache_get_for_write(cache, stream, block_offset, start, end);
+        if(!block) break;
+
+        memcpy(block->data + start, data + size_written, end - start);
+        block->valid_start = MIN(block->valid_start, start);
+        block->valid_end = MAX(block->valid_end, end);
+        if(stream_cache_block_is_dirty(block)) {
+            block->dirty_start = MIN(block->dirty_start, start);
+            block->dirty_end = MAX(block->dirty_end, end);
+        } else {
+            block->dirty_start = start;
+            block->dirty_end = end;
+        }
+        size_written += end - start;
     }
 
-    cache->position += actual_offset;
-    return actual_offset;
+    return size_written;
+}
+
+void stream_cache_get_stats(StreamCache* cache, StreamCacheStats* stats) {
+    furi_assert(cache);
+    furi_assert(stats);
+    *stats = cache->stats;
 }
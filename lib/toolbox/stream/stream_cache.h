@@ -6,57 +6,72 @@
 extern "C" {
 #endif
 
+/** Cache block size, matches the storage sector size */
+#define STREAM_CACHE_BLOCK_SIZE 512U
+
 typedef struct StreamCache StreamCache;
 
+typedef struct {
+    uint32_t hits; /**< block lookups served from the cache */
+    uint32_t misses; /**< block lookups that needed a new block */
+    uint32_t write_backs; /**< dirty ranges written to the stream */
+} StreamCacheStats;
+
 /**
  * Allocate stream cache.
+ * @param size Cache size in bytes, rounded down to whole blocks, at least one block.
  * @return StreamCache* pointer to a StreamCache instance
  */
-StreamCache* stream_cache_alloc(void);
+StreamCache* stream_cache_alloc(size_t size);
 
 /**
- * Free stream cache.
+ * Free stream cache. Dirty data is discarded, flush it first.
  * @param cache Pointer to a StreamCache instance
  */
 void stream_cache_free(StreamCache* cache);
 
 /**
- * Drop the cache contents and set it to initial state.
+ * Drop the cache contents, including dirty data, and forget the stream position.
+ * Must be called whenever the stream is accessed bypassing the cache.
  * @param cache Pointer to a StreamCache instance
  */
 void stream_cache_drop(StreamCache* cache);
 
 /**
- * Determine if the internal cursor is at end the end of cached data.
- * @param cache Pointer to a StreamCache instance
- * @return True if cursor is at end, otherwise false.
- */
-bool stream_cache_at_end(StreamCache* cache);
-
-/**
- * Get the current size of cached data.
- * @param cache Pointer to a StreamCache instance
- * @return Size of cached data.
- */
-size_t stream_cache_size(StreamCache* cache);
-
-/**
- * Get the internal cursor position.
+ * Read data at a given stream offset through the cache.
  * @param cache Pointer to a StreamCache instance
- * @return Cursor position inside the cache.
+ * @param stream Pointer to a Stream instance to load blocks from
+ * @param offset Offset in the stream
+ * @param data Pointer to a data buffer
+ * @param size Size in bytes to read
+ * @return Actual size that was read, less than size at the end of stream or on error.
  */
-size_t stream_cache_pos(StreamCache* cache);
+size_t stream_cache_read(
+    StreamCache* cache,
+    Stream* stream,
+    size_t offset,
+    uint8_t* data,
+    size_t size);
 
 /**
- * Load the cache with new data from a stream.
+ * Write data at a given stream offset into the cache.
+ * Data reaches the stream when blocks are evicted or on stream_cache_flush.
  * @param cache Pointer to a StreamCache instance
- * @param stream Pointer to a Stream instance
- * @return Size of newly cached data.
+ * @param stream Pointer to a Stream instance to write evicted blocks to
+ * @param offset Offset in the stream, not beyond the end of data
+ * @param data Pointer to a data buffer
+ * @param size Size in bytes to write
+ * @return Actual size that was written.
  */
-size_t stream_cache_fill(StreamCache* cache, Stream* stream);
+size_t stream_cache_write(
+    StreamCache* cache,
+    Stream* stream,
+    size_t offset,
+    const uint8_t* data,
+    size_t size);
 
 /**
- * Write as much cached data as possible to a stream.
+ * Write all dirty data to a stream, in ascending offset order.
  * @param cache Pointer to a StreamCache instance
  * @param stream Pointer to a Stream instance
  * @return True on success, False on failure.
@@ -64,30 +79,11 @@ size_t stream_cache_fill(StreamCache* cache, Stream* stream);
 bool stream_cache_flush(StreamCache* cache, Stream* stream);
 
 /**
- * Read cached data and advance the internal cursor.
- * @param cache Pointer to a StreamCache instance.
- * @param data Pointer to a data buffer. Must be initialized.
- * @param size Maximum size in bytes to read from the cache.
- * @return Actual size that was read.
- */
-size_t stream_cache_read(StreamCache* cache, uint8_t* data, size_t size);
-
-/**
- * Write to cached data and advance the internal cursor.
- * @param cache Pointer to a StreamCache instance.
- * @param data Pointer to a data buffer.
- * @param size Maximum size in bytes to write to the cache.
- * @return Actual size that was written.
- */
-size_t stream_cache_write(StreamCache* cache, const uint8_t* data, size_t size);
-
-/**
- * Move the internal cursor relatively to its current position.
- * @param cache Pointer to a StreamCache instance.
- * @param offset Cursor offset.
- * @return Actual cursor offset. Equal to offset parameter on hit.
+ * Get the cache statistics.
+ * @param cache Pointer to a StreamCache instance
+ * @param stats Pointer to a StreamCacheStats to fill
  */
-int32_t stream_cache_seek(StreamCache* cache, int32_t offset);
+void stream_cache_get_stats(StreamCache* cache, StreamCacheStats* stats);
 
 #ifdef __cplusplus
 }
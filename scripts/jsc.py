@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+
+import glob
+import os
+import shutil
+import subprocess
+import tempfile
+
+from flipper.app import App
+
+ROOT_DIR = os.path.normpath(os.path.join(os.path.dirname(__file__), ".."))
+MJS_DIR = os.path.join(ROOT_DIR, "lib", "mjs")
+HOST_SOURCE = os.path.join(os.path.dirname(__file__), "jsc", "jsc_host.c")
+HOST_COMPAT = os.path.join(os.path.dirname(__file__), "jsc", "jsc_host_compat.h")
+PROPERTY_BENCH = os.path.join(os.path.dirname(__file__), "jsc", "property_bench.js")
+EXAMPLES_DIR = os.path.join(
+    ROOT_DIR, "applications", "system", "js_app", "examples", "apps", "Scripts"
+)
+
+
+class Main(App):
+    def init(self):
+        self.parser.add_argument(
+            "-c", "--cc", help="Host C compiler", default=os.environ.get("CC", "cc")
+        )
+        self.subparsers = self.parser.add_subparsers(help="sub-command help")
+
+        self.parser_compile = self.subparsers.add_parser(
+            "compile", help="Precompile scripts to .jsc next to them"
+        )
+        self.parser_compile.add_argument("scripts", nargs="+", help="Script files")
+        self.parser_compile.add_argument(
+            "-o", "--output", help="Output directory, next to sources by default"
+        )
+        self.parser_compile.set_defaults(func=self.compile)
+
+        self.parser_bench = self.subparsers.add_parser(
+            "bench", help="Compare script startup from source and from .jsc"
+        )
+        self.parser_bench.add_argument(
+            "scripts", nargs="*", help="Script files, JS app examples by default"
+        )
+        self.parser_bench.add_argument(
+            "-n", "--iterations", help="Iterations per script", type=int, default=200
+        )
+        self.parser_bench.set_defaults(func=self.bench)
+
+        self.parser_run = self.subparsers.add_parser(
+            "run", help="Run scripts and report operations per second"
+        )
+        self.parser_run.add_argument(
+            "scripts",
+            nargs="*",
+            help="Script files calling ops(count), property benchmark by default",
+        )
+        self.parser_run.add_argument(
+            "-n", "--iterations", help="Iterations per script", type=int, default=20
+        )
+        self.parser_run.set_defaults(func=self.run)
+
+    def before(self):
+        self.build_dir = tempfile.mkdtemp(prefix="jsc")
+
+    def after(self):
+        shutil.rmtree(self.build_dir, ignore_errors=True)
+
+    def _build_host(self):
+        sources = [HOST_SOURCE]
+        for pattern in ("*.c", "common/*.c", "common/frozen/*.c", "ffi/*.c"):
+            sources += glob.glob(os.path.join(MJS_DIR, pattern))
+        sources = [source for source in sources if "platform_flipper" not in source]
+
+        binary = os.path.join(self.build_dir, "jsc_host")
+        # CS_MMAP selects the stdio based file functions of the mJS common code
+        command = [self.args.cc, "-O2", "-DCS_MMAP", f"-I{MJS_DIR}"]
+        command += ["-include", HOST_COMPAT]
+        command += sources + ["-lm", "-o", binary]
+        self.logger.debug(" ".join(command))
+        subprocess.run(command, check=True)
+        return binary
+
+    def compile(self):
+        binary = self._build_host()
+        for script in self.args.scripts:
+            output_dir = self.args.output or os.path.dirname(script)
+            os.makedirs(output_dir or ".", exist_ok=True)
+            jsc = os.path.join(output_dir, os.path.basename(script) + "c")
+            if subprocess.run([binary, "compile", script, jsc]).returncode != 0:
+                self.logger.error(f"Failed to compile {script}")
+                return 1
+            self.logger.info(f"{script} -> {jsc}")
+        return 0
+
+    def bench(self):
+        binary = self._build_host()
+        scripts = self.args.scripts or sorted(
+            glob.glob(os.path.join(EXAMPLES_DIR, "*.js"))
+        )
+        return subprocess.run(
+            [binary, "bench", str(self.args.iterations)] + scripts
+        ).returncode
+
+    def run(self):
+        binary = self._build_host()
+        scripts = self.args.scripts or [PROPERTY_BENCH]
+        return subprocess.run(
+            [binary, "run", str(self.args.iterations)] + scripts
+        ).returncode
+
+
+if __name__ == "__main__":
+    Main()()
@@ -0,0 +1,210 @@
+/*
+ * Host side mJS compiler and startup benchmark, built and driven by scripts/jsc.py
+ *
+ * jsc_host compile <script.js> <script.jsc>
+ *     Writes precompiled bcode, same as the JS app does on the first run.
+ *
+ * jsc_host bench <iterations> <script.js>...
+ *     Measures what happens before the first instruction of a script runs:
+ *     instance creation plus parsing the source versus instance creation plus
+ *     loading its precompiled bcode, timed together in every iteration.
+ *     The last column is the startup speedup.
+ *
+ * jsc_host run <iterations> <script.js>...
+ *     Executes scripts and reports their throughput. A script tells how much
+ *     work it has done by calling ops(count).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "common/cs_file.h"
+#include "mjs_bcode.h"
+#include "mjs_core.h"
+#include "mjs_exec_public.h"
+#include "mjs_object_public.h"
+#include "mjs_parser.h"
+#include "mjs_primitive.h"
+
+/* Newlib provides these on the device, older glibc does not, see jsc_host_compat.h */
+__attribute__((weak)) size_t strlcpy(char* dst, const char* src, size_t size) {
+    size_t len = strlen(src);
+    if(size > 0) {
+        size_t n = len < size - 1 ? len : size - 1;
+        memcpy(dst, src, n);
+        dst[n] = '\0';
+    }
+    return len;
+}
+
+__attribute__((weak)) size_t strlcat(char* dst, const char* src, size_t size) {
+    size_t len = strnlen(dst, size);
+    return len + strlcpy(dst + len, src, size - len);
+}
+
+static double jsc_host_time_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+static int jsc_host_compile_to(const char* path, const char* src, struct mbuf* jsc) {
+    struct mjs* mjs = mjs_create(NULL);
+    mjs_err_t err = mjs_parse(path, src, mjs);
+    if(err == MJS_OK) {
+        mjs_jsc_serialize(mjs, src, strlen(src), jsc);
+    } else {
+        fprintf(stderr, "%s: %s\n", path, mjs_strerror(mjs, err));
+    }
+    mjs_destroy(mjs);
+    return err == MJS_OK;
+}
+
+static int jsc_host_compile(const char* path, const char* jsc_path) {
+    size_t size;
+    char* src = cs_read_file(path, &size);
+    struct mbuf jsc;
+    int ok = 0;
+
+    if(src == NULL) {
+        fprintf(stderr, "Failed to read %s\n", path);
+        return 1;
+    }
+
+    mbuf_init(&jsc, 0);
+    if(jsc_host_compile_to(path, src, &jsc)) {
+        ok = cs_write_file(jsc_path, jsc.buf, jsc.len) == 0;
+        if(!ok) fprintf(stderr, "Failed to write %s\n", jsc_path);
+    }
+    mbuf_free(&jsc);
+    free(src);
+    return ok ? 0 : 1;
+}
+
+static int jsc_host_bench(int iterations, const char* path) {
+    size_t size;
+    char* src = cs_read_file(path, &size);
+    struct mbuf jsc;
+    const char* name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    double parse_us = 0, load_us = 0, start;
+    int i, ok = 1;
+
+    if(src == NULL) {
+        fprintf(stderr, "Failed to read %s\n", path);
+        return 1;
+    }
+
+    mbuf_init(&jsc, 0);
+    if(!jsc_host_compile_to(path, src, &jsc)) {
+        free(src);
+        return 1;
+    }
+
+    /* Destruction is left out, it is the same for both paths */
+    for(i = 0; i < iterations; i++) {
+        struct mjs* mjs;
+
+        start = jsc_host_time_us();
+        mjs = mjs_create(NULL);
+        ok &= mjs_parse(path, src, mjs) == MJS_OK;
+        parse_us += jsc_host_time_us() - start;
+        mjs_destroy(mjs);
+
+        start = jsc_host_time_us();
+        mjs = mjs_create(NULL);
+        ok &= mjs_jsc_load(mjs, path, jsc.buf, jsc.len, src, strlen(src));
+        load_us += jsc_host_time_us() - start;
+        mjs_destroy(mjs);
+    }
+
+    printf(
+        "%-20s %7lu %7lu %10.1f %10.1f %6.1fx\n",
+        name,
+        (unsigned long)size,
+        (unsigned long)jsc.len,
+        parse_us / iterations,
+        load_us / iterations,
+        parse_us / load_us);
+
+    mbuf_free(&jsc);
+    free(src);
+    return ok ? 0 : 1;
+}
+
+static double jsc_host_ops;
+
+static void jsc_host_ops_report(struct mjs* mjs) {
+    jsc_host_ops += mjs_get_double(mjs, mjs_arg(mjs, 0));
+    mjs_return(mjs, MJS_UNDEFINED);
+}
+
+static int jsc_host_run(int iterations, const char* path) {
+    const char* name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+    double elapsed_us = 0, start;
+    int i;
+
+    jsc_host_ops = 0;
+    for(i = 0; i < iterations; i++) {
+        struct mjs* mjs = mjs_create(NULL);
+        mjs_err_t err;
+        /* ~0 length only works where size_t is 32 bit */
+        mjs_set(mjs, mjs_get_global(mjs), "ops", 3, MJS_MK_FN(jsc_host_ops_report));
+
+        start = jsc_host_time_us();
+        err = mjs_exec_file(mjs, path, NULL);
+        elapsed_us += jsc_host_time_us() - start;
+
+        if(err != MJS_OK) {
+            fprintf(stderr, "%s: %s\n", path, mjs_strerror(mjs, err));
+            mjs_destroy(mjs);
+            return 1;
+        }
+        mjs_destroy(mjs);
+    }
+
+    printf(
+        "%-20s %10.0f %12.0f\n",
+        name,
+        elapsed_us / iterations,
+        jsc_host_ops / (elapsed_us / 1e6));
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    int i, iterations, ret = 0;
+
+    if(argc == 4 && strcmp(argv[1], "compile") == 0) {
+        return jsc_host_compile(argv[2], argv[3]);
+    }
+
+    if(argc >= 4 && strcmp(argv[1], "bench") == 0 && (iterations = atoi(argv[2])) > 0) {
+        printf(
+            "%-20s %7s %7s %10s %10s %7s\n",
+            "script",
+            "js",
+            "jsc",
+            "parse,us",
+            "load,us",
+            "speedup");
+        for(i = 3; i < argc; i++) {
+            ret |= jsc_host_bench(iterations, argv[i]);
+        }
+        return ret;
+    }
+
+    if(argc >= 4 && strcmp(argv[1], "run") == 0 && (iterations = atoi(argv[2])) > 0) {
+        printf("%-20s %10s %12s\n", "script", "run,us", "ops/s");
+        for(i = 3; i < argc; i++) {
+            ret |= jsc_host_run(iterations, argv[i]);
+        }
+        return ret;
+    }
+
+    fprintf(stderr, "Usage:\n");
+    fprintf(stderr, "  %s compile <script.js> <script.jsc>\n", argv[0]);
+    fprintf(stderr, "  %s bench <iterations> <script.js>...\n", argv[0]);
+    fprintf(stderr, "  %s run <iterations> <script.js>...\n", argv[0]);
+    return 2;
+}
@@ -0,0 +1,13 @@
+/*
+ * Forced into every mJS source of the host build by scripts/jsc.py
+ *
+ * mJS uses strlcpy and strlcat from newlib on the device. Glibc declares them
+ * only since 2.38, older hosts get the weak fallbacks from jsc_host.c.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+size_t strlcpy(char* dst, const char* src, size_t size);
+size_t strlcat(char* dst, const char* src, size_t size);
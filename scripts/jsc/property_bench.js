@@ -0,0 +1,34 @@
+// Property access micro-benchmark, run with `python scripts/jsc.py run scripts/jsc/property_bench.js`
+// Shaped like module objects: a few dozen methods, called in a loop
+function method() {
+    return 1;
+}
+
+let module = {
+    setup: method, write: method, read: method, readln: method,
+    readBytes: method, expect: method, end: method, print: method,
+    println: method, press: method, hold: method, release: method,
+    altPrint: method, altPrintln: method, isConnected: method, quit: method,
+    success: method, error: method, blink: method, addItem: method,
+    setHeader: method, show: method, setConfig: method, emptyText: method,
+    addText: method, isOpen: method, close: method, message: method,
+    custom: method, pickFile: method, getModel: method, getName: method
+};
+
+let point = { x: 1, y: 2, width: 10, height: 20 };
+
+let rounds = 2000;
+let sum = 0;
+for (let i = 0; i < rounds; i++) {
+    // Method calls by name, as scripts do with required modules
+    module.setup();
+    module.readBytes();
+    module.addText();
+    module.getName();
+    // Plain field reads and writes
+    sum = sum + point.x + point.y + point.width + point.height;
+    point.width = point.height;
+}
+
+// 4 calls and 6 field accesses per round
+ops(rounds * 10);
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+
+import re
+import struct
+import sys
+
+from elftools.elf.constants import SH_FLAGS
+from elftools.elf.elffile import ELFFile
+from flipper.app import App
+
+# Must match furi/core/log.c
+FRAME_MAGIC = b"\xff\xf1"
+FRAME_HEADER = struct.Struct("<IBBHII")
+FRAME_ARGS_SIZE_MAX = 32
+FRAME_FLAG_TRUNCATED = 1 << 0
+
+LOG_LEVELS = {2: "E", 3: "W", 4: "I", 5: "D", 6: "T"}
+LOG_COLORS = {2: "31", 3: "33", 4: "32", 5: "34", 6: "35"}
+
+FORMAT_SPEC = re.compile(
+    r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|L|q|j|z|t)?([diouxXcfFeEgGaAspn%])"
+)
+
+
+class StringResolver:
+    def __init__(self, elf_path):
+        self.sections = []
+        with open(elf_path, "rb") as f:
+            elf = ELFFile(f)
+            for section in elf.iter_sections():
+                if not section["sh_flags"] & SH_FLAGS.SHF_ALLOC:
+                    continue
+                if section["sh_type"] == "SHT_NOBITS":
+                    continue
+                self.sections.append((section["sh_addr"], section.data()))
+        self.cache = {}
+
+    def resolve(self, address):
+        if address in self.cache:
+            return self.cache[address]
+        string = f"<0x{address:08x}>"
+        for start, data in self.sections:
+            if start <= address < start + len(data):
+                offset = address - start
+                end = data.find(b"\0", offset)
+                string = data[offset : end if end >= 0 else None].decode(
+                    "utf-8", "replace"
+                )
+                break
+        self.cache[address] = string
+        return string
+
+
+class ArgsReader:
+    def __init__(self, data):
+        self.data = data
+        self.offset = 0
+
+    def unpack(self, fmt):
+        size = struct.calcsize(fmt)
+        if self.offset + size > len(self.data):
+            raise EOFError
+        (value,) = struct.unpack_from(fmt, self.data, self.offset)
+        self.offset += size
+        return value
+
+    def string(self):
+        if self.offset >= len(self.data):
+            raise EOFError
+        end = self.data.find(b"\0", self.offset)
+        if end < 0:
+            end = len(self.data)
+        value = self.data[self.offset : end].decode("utf-8", "replace")
+        self.offset = end + 1
+        return value
+
+
+def render(format_string, args, truncated):
+    reader = ArgsReader(args)
+    result = []
+    position = 0
+
+    try:
+        for spec in FORMAT_SPEC.finditer(format_string):
+            result.append(format_string[position : spec.start()])
+            position = spec.end()
+            flags, width, precision, length, conversion = spec.groups()
+
+            if conversion == "%":
+                result.append("%")
+                continue
+
+            if width == "*":
+                width = str(reader.unpack("<i"))
+            if precision == "*":
+                precision = str(reader.unpack("<i"))
+            wide = length in ("ll", "q", "j")
+
+            if conversion in "di":
+                value = reader.unpack("<q" if wide else "<i")
+                conversion = "d"
+            elif conversion in "ouxX":
+                value = reader.unpack("<Q" if wide else "<I")
+                conversion = "d" if conversion == "u" else conversion
+            elif conversion == "c":
+                value = chr(reader.unpack("<I") & 0xFF)
+            elif conversion in "fFeEgGaA":
+                value = reader.unpack("<d")
+                if conversion in "aA":
+                    value = value.hex()
+                    conversion = "s"
+            elif conversion == "s":
+                value = reader.string()
+            elif conversion == "p":
+                value = f"0x{reader.unpack('<I'):x}"
+                conversion = "s"
+            else:
+                continue
+
+            python_spec = "%" + flags + (width or "")
+            if precision is not None:
+                python_spec += "." + precision
+            result.append((python_spec + conversion) % value)
+    except EOFError:
+        truncated = True
+    else:
+        result.append(format_string[position:])
+
+    if truncated:
+        result.append("...")
+    return "".join(result)
+
+
+class FrameDecoder:
+    def __init__(self, resolver, output):
+        self.resolver = resolver
+        self.output = output
+        self.buffer = b""
+
+    def _text(self, data):
+        if data:
+            self.output.write(data.decode("utf-8", "replace"))
+
+    def _frame(self, payload):
+        tick, level, flags, dropped, tag, fmt = FRAME_HEADER.unpack_from(payload)
+        args = payload[FRAME_HEADER.size :]
+        message = render(
+            self.resolver.resolve(fmt), args, bool(flags & FRAME_FLAG_TRUNCATED)
+        )
+
+        if dropped:
+            self.output.write(f"[{dropped} log records dropped]\r\n")
+        if tag:
+            color = LOG_COLORS.get(level, "0")
+            letter = LOG_LEVELS.get(level, " ")
+            self.output.write(
+                f"{tick} \033[0;{color}m[{letter}][{self.resolver.resolve(tag)}] "
+                f"\033[0m{message}\r\n"
+            )
+        else:
+            self.output.write(message)
+
+    def feed(self, data):
+        self.buffer += data
+
+        while True:
+            start = self.buffer.find(FRAME_MAGIC)
+            if start < 0:
+                # Keep a possible magic start for the next chunk
+                keep = 1 if self.buffer.endswith(FRAME_MAGIC[:1]) else 0
+                self._text(self.buffer[: len(self.buffer) - keep])
+                self.buffer = self.buffer[len(self.buffer) - keep :]
+                break
+
+            self._text(self.buffer[:start])
+            self.buffer = self.buffer[start:]
+
+            if len(self.buffer) < 3:
+                break
+            size = self.buffer[2]
+            if not FRAME_HEADER.size <= size <= FRAME_HEADER.size + FRAME_ARGS_SIZE_MAX:
+                self.buffer = self.buffer[1:]
+                continue
+            if len(self.buffer) < 3 + size + 1:
+                break
+
+            payload = self.buffer[3 : 3 + size]
+            if sum(payload) & 0xFF != self.buffer[3 + size]:
+                self.buffer = self.buffer[1:]
+                continue
+
+            self._frame(payload)
+            self.buffer = self.buffer[3 + size + 1 :]
+
+        self.output.flush()
+
+
+class Main(App):
+    def init(self):
+        self.parser.add_argument("elf", help="Firmware ELF file")
+        self.parser.add_argument("-p", "--port", help="CDC Port", default=None)
+        self.parser.add_argument(
+            "-l", "--level", help="Log level for the log command", default=""
+        )
+        self.parser.add_argument(
+            "-i", "--input", help="Captured log, stdin by default", default="-"
+        )
+        self.parser.set_defaults(func=self.decode)
+
+    def decode(self):
+        decoder = FrameDecoder(StringResolver(self.args.elf), sys.stdout)
+
+        if self.args.port:
+            # Only needed for a live device, captures decode without pyserial
+            import serial
+            from flipper.utils.cdc import resolve_port
+
+            if not (port := resolve_port(self.logger, self.args.port)):
+                self.logger.error("Is Flipper connected via USB and not in DFU mode?")
+                return 1
+            with serial.Serial(port, 230400, timeout=0.1) as flipper:
+                flipper.write(f"log binary {self.args.level}\r".encode())
+                try:
+                    while True:
+                        decoder.feed(flipper.read(1024))
+                except KeyboardInterrupt:
+                    flipper.write(b"\x03")
+            return 0
+
+        stream = (
+            sys.stdin.buffer if self.args.input == "-" else open(self.args.input, "rb")
+        )
+        with stream:
+            while data := stream.read(1024):
+                decoder.feed(data)
+        return 0
+
+
+if __name__ == "__main__":
+    Main()()
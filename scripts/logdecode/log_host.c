@@ -0,0 +1,116 @@
+/*
+ * Host side round trip of deferred log frames, built and run by `make test`
+ *
+ * log_host <frames> <expected>
+ *     Packs records with furi/core/log_binary.c, the same code the firmware
+ *     uses, writes their frames mixed with plain text to <frames>, and the
+ *     text the firmware would have printed to <expected>. scripts/logdecode.py
+ *     decodes <frames> with this binary as the ELF, the output must match.
+ *
+ * The binary is linked without PIE, so string addresses fit the 32-bit
+ * address fields of a frame like they do on the device.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <core/log.h>
+
+static FILE* frames;
+static FILE* expected;
+static uint32_t tick;
+
+static const char* const log_colors[] = {
+    [FuriLogLevelError] = _FURI_LOG_CLR_E,
+    [FuriLogLevelWarn] = _FURI_LOG_CLR_W,
+    [FuriLogLevelInfo] = _FURI_LOG_CLR_I,
+    [FuriLogLevelDebug] = _FURI_LOG_CLR_D,
+    [FuriLogLevelTrace] = _FURI_LOG_CLR_T,
+};
+
+static const char log_letters[] = {
+    [FuriLogLevelError] = 'E',
+    [FuriLogLevelWarn] = 'W',
+    [FuriLogLevelInfo] = 'I',
+    [FuriLogLevelDebug] = 'D',
+    [FuriLogLevelTrace] = 'T',
+};
+
+static void log_text(const char* text) {
+    fputs(text, frames);
+    fputs(text, expected);
+}
+
+static void log_record(FuriLogLevel level, const char* tag, const char* format, ...)
+    __attribute__((__format__(__printf__, 3, 4)));
+
+static void log_record(FuriLogLevel level, const char* tag, const char* format, ...) {
+    FuriLogBinaryRecord record = {
+        .tick = tick++,
+        .tag = tag,
+        .format = format,
+        .level = level,
+    };
+    uint8_t frame[FURI_LOG_BINARY_FRAME_SIZE];
+    size_t args_size = 0;
+
+    va_list args;
+    va_start(args, format);
+    if(!furi_log_pack_args(record.args, &args_size, format, args)) {
+        fprintf(stderr, "Arguments of \"%s\" don't fit in a frame\n", format);
+        exit(EXIT_FAILURE);
+    }
+    va_end(args);
+    record.args_size = args_size;
+
+    const size_t size = furi_log_binary_frame(&record, 0, frame);
+    fwrite(frame, 1, size, frames);
+
+    if(tag) {
+        fprintf(
+            expected,
+            "%u %s[%c][%s] " _FURI_LOG_CLR_RESET,
+            record.tick,
+            log_colors[level],
+            log_letters[level],
+            tag);
+    }
+    va_start(args, format);
+    vfprintf(expected, format, args);
+    va_end(args);
+    if(tag) fputs("\r\n", expected);
+}
+
+int main(int argc, char** argv) {
+    if(argc != 3) {
+        fprintf(stderr, "Usage: %s <frames> <expected>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    frames = fopen(argv[1], "wb");
+    expected = fopen(argv[2], "wb");
+    if(!frames || !expected) {
+        perror("fopen");
+        return EXIT_FAILURE;
+    }
+
+    log_text("Plain text before the first frame\r\n");
+    log_record(FuriLogLevelInfo, "LogHost", "Started");
+    log_record(
+        FuriLogLevelError, "LogHost", "%d %u %x %#X %c %%", -42, 42U, 0xbeefU, 0xcafeU, 'z');
+    log_record(FuriLogLevelWarn, "LogHost", "%lld %llu %llx", -1LL, 1ULL << 40, 0xfeedULL << 32);
+    log_record(FuriLogLevelDebug, "LogHost", "%.3f %e %5.1f", 3.14159, 1234.5, -0.25);
+    log_record(FuriLogLevelTrace, "LogHost", "[%s] [%-6s] [%6s]", "abc", "left", "right");
+    log_record(FuriLogLevelInfo, "LogHost", "[%5d] [%-*d] [%.*s]", 7, 4, 8, 2, "cut");
+    log_record(FuriLogLevelInfo, "LogHost", "%p", (void*)0x20001234);
+    log_text("Plain text between frames\r\n");
+    log_record(FuriLogLevelInfo, NULL, "Raw record %d\r\n", 1);
+    log_record(FuriLogLevelInfo, NULL, "%s", "Raw string\r\n");
+    log_text("Plain text after the last frame\r\n");
+
+    fclose(frames);
+    fclose(expected);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,375 @@
+/*
+ * Host side test of the FatFs sector cache, built and run by `make test`
+ *
+ * sector_cache_host <image> [seed]
+ *     Formats <image> as FAT16, FAT32 and exFAT in turn and runs the same
+ *     random file and directory workload on it twice: straight to the image,
+ *     then through targets/f7/fatfs/sector_cache.c wired like user_diskio.c.
+ *     File contents are checked on every read, and both runs must leave
+ *     byte identical images. Device read calls of both runs are reported.
+ */
+
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "diskio.h"
+#include "ff.h"
+#include "sector_cache.h"
+
+#define IMAGE_SECTORS  (64UL * 1024 * 1024 / SECTOR_CACHE_SECTOR_SIZE)
+#define CACHE_SECTORS  16U /* SD_CACHE_SECTORS in user_diskio.c */
+#define DIR_COUNT      8U
+#define FILE_COUNT     64U
+#define FILE_SIZE_MAX  (192U * 1024)
+#define CHUNK_SIZE_MAX (8U * 1024)
+#define OPERATIONS     4000U
+
+typedef struct {
+    bool used;
+    uint32_t dir;
+    uint32_t size;
+    uint32_t seed;
+} TestFile;
+
+typedef struct {
+    uint32_t calls;
+    uint32_t sectors;
+} DeviceStats;
+
+static int image = -1;
+static FATFS fs;
+static SectorCache* cache;
+static DeviceStats device;
+static uint32_t random_state;
+static TestFile files[FILE_COUNT];
+static uint8_t buffer[CHUNK_SIZE_MAX];
+
+static uint32_t test_random(void) {
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 17;
+    random_state ^= random_state << 5;
+    return random_state;
+}
+
+static uint32_t test_random_range(uint32_t min, uint32_t max) {
+    return min + test_random() % (max - min + 1);
+}
+
+static uint8_t test_file_byte(const TestFile* file, uint32_t offset) {
+    uint32_t value = (file->seed + offset / 4) * 2654435761UL;
+    return value >> (8 * (offset % 4));
+}
+
+static void test_file_path(uint32_t index, uint32_t dir, char* path) {
+    sprintf(path, "/dir%u/file_with_a_long_name_%03u.bin", dir, index);
+}
+
+static bool device_read(void* context, uint8_t* data, uint32_t sector, uint32_t count) {
+    (void)context;
+    device.calls++;
+    device.sectors += count;
+    const size_t size = (size_t)count * SECTOR_CACHE_SECTOR_SIZE;
+    return pread(image, data, size, (off_t)sector * SECTOR_CACHE_SECTOR_SIZE) == (ssize_t)size;
+}
+
+/* FatFs disk interface, same routing as targets/f7/fatfs/user_diskio.c */
+
+DSTATUS disk_initialize(BYTE pdrv) {
+    (void)pdrv;
+    if(cache) sector_cache_invalidate_all(cache);
+    return 0;
+}
+
+DSTATUS disk_status(BYTE pdrv) {
+    (void)pdrv;
+    return 0;
+}
+
+DRESULT disk_read(BYTE pdrv, BYTE* buff, DWORD sector, UINT count) {
+    (void)pdrv;
+    bool success;
+    if(cache) {
+        const bool metadata = (buff == fs.win);
+        success = sector_cache_read(cache, buff, sector, count, metadata);
+    } else {
+        success = device_read(NULL, buff, sector, count);
+    }
+    return success ? RES_OK : RES_ERROR;
+}
+
+DRESULT disk_write(BYTE pdrv, const BYTE* buff, DWORD sector, UINT count) {
+    (void)pdrv;
+    const size_t size = (size_t)count * SECTOR_CACHE_SECTOR_SIZE;
+    const bool success =
+        pwrite(image, buff, size, (off_t)sector * SECTOR_CACHE_SECTOR_SIZE) == (ssize_t)size;
+    if(cache) {
+        if(success) {
+            sector_cache_update(cache, buff, sector, count);
+        } else {
+            sector_cache_invalidate_range(cache, sector, sector + count - 1);
+        }
+    }
+    return success ? RES_OK : RES_ERROR;
+}
+
+DRESULT disk_ioctl(BYTE pdrv, BYTE cmd, void* buff) {
+    (void)pdrv;
+    switch(cmd) {
+    case CTRL_SYNC:
+        return RES_OK;
+    case GET_SECTOR_COUNT:
+        *(DWORD*)buff = IMAGE_SECTORS;
+        return RES_OK;
+    case GET_BLOCK_SIZE:
+        *(DWORD*)buff = 1;
+        return RES_OK;
+    default:
+        return RES_PARERR;
+    }
+}
+
+/* Fixed time keeps both images identical */
+DWORD get_fattime(void) {
+    return ((DWORD)(2024 - 1980) << 25) | (1UL << 21) | (1UL << 16);
+}
+
+#define CHECK(expression)                                                           \
+    do {                                                                            \
+        if(!(expression)) {                                                         \
+            fprintf(stderr, "%s:%d: %s failed\n", __FILE__, __LINE__, #expression); \
+            return false;                                                           \
+        }                                                                           \
+    } while(0)
+
+static bool test_file_write(uint32_t index) {
+    TestFile* file = &files[index];
+    char path[64];
+    FIL fil = {0}; // Zeroed like the storage service allocations, FatFs relies on it
+    UINT done;
+
+    if(!file->used) file->dir = test_random_range(0, DIR_COUNT - 1);
+    file->used = true;
+    file->size = test_random_range(0, FILE_SIZE_MAX);
+    file->seed = test_random();
+    test_file_path(index, file->dir, path);
+
+    CHECK(f_open(&fil, path, FA_WRITE | FA_CREATE_ALWAYS) == FR_OK);
+    for(uint32_t offset = 0; offset < file->size; offset += done) {
+        UINT size = test_random_range(1, CHUNK_SIZE_MAX);
+        if(size > file->size - offset) size = file->size - offset;
+        for(UINT i = 0; i < size; i++) {
+            buffer[i] = test_file_byte(file, offset + i);
+        }
+        CHECK(f_write(&fil, buffer, size, &done) == FR_OK && done == size);
+    }
+    CHECK(f_close(&fil) == FR_OK);
+    return true;
+}
+
+static bool test_file_read(uint32_t index, bool whole) {
+    TestFile* file = &files[index];
+    char path[64];
+    FIL fil = {0};
+    UINT done;
+
+    test_file_path(index, file->dir, path);
+    CHECK(f_open(&fil, path, FA_READ) == FR_OK);
+    CHECK(f_size(&fil) == file->size);
+
+    uint32_t offset = whole ? 0 : test_random_range(0, file->size);
+    uint32_t left = whole ? file->size : test_random_range(0, file->size - offset);
+    CHECK(f_lseek(&fil, offset) == FR_OK);
+    while(left) {
+        UINT size = test_random_range(1, CHUNK_SIZE_MAX);
+        if(size > left) size = left;
+        CHECK(f_read(&fil, buffer, size, &done) == FR_OK && done == size);
+        for(UINT i = 0; i < size; i++) {
+            CHECK(buffer[i] == test_file_byte(file, offset + i));
+        }
+        offset += size;
+        left -= size;
+    }
+    CHECK(f_close(&fil) == FR_OK);
+    return true;
+}
+
+static bool test_file_move(uint32_t index) {
+    TestFile* file = &files[index];
+    char from[64], to[64];
+
+    const uint32_t dir = test_random_range(0, DIR_COUNT - 1);
+    if(dir == file->dir) return true;
+    test_file_path(index, file->dir, from);
+    test_file_path(index, dir, to);
+    CHECK(f_rename(from, to) == FR_OK);
+    file->dir = dir;
+    return true;
+}
+
+static bool test_file_remove(uint32_t index) {
+    TestFile* file = &files[index];
+    char path[64];
+
+    test_file_path(index, file->dir, path);
+    CHECK(f_unlink(path) == FR_OK);
+    file->used = false;
+    return true;
+}
+
+static bool test_dir_list(uint32_t dir) {
+    char path[16];
+    DIR dj = {0};
+    FILINFO info;
+    uint32_t expected = 0, found = 0;
+
+    for(uint32_t i = 0; i < FILE_COUNT; i++) {
+        if(files[i].used && files[i].dir == dir) expected++;
+    }
+    sprintf(path, "/dir%u", dir);
+    CHECK(f_opendir(&dj, path) == FR_OK);
+    while(f_readdir(&dj, &info) == FR_OK && info.fname[0]) {
+        found++;
+    }
+    CHECK(f_closedir(&dj) == FR_OK);
+    CHECK(found == expected);
+    return true;
+}
+
+static bool test_workload(BYTE format, uint32_t seed) {
+    static uint8_t work[32 * 1024];
+    char path[16];
+
+    random_state = seed;
+    memset(files, 0, sizeof(files));
+    CHECK(f_mkfs("", format | FM_SFD, 0, work, sizeof(work)) == FR_OK);
+    CHECK(f_mount(&fs, "", 1) == FR_OK);
+
+    for(uint32_t dir = 0; dir < DIR_COUNT; dir++) {
+        sprintf(path, "/dir%u", dir);
+        CHECK(f_mkdir(path) == FR_OK);
+    }
+
+    for(uint32_t operation = 0; operation < OPERATIONS; operation++) {
+        const uint32_t index = test_random_range(0, FILE_COUNT - 1);
+        const uint32_t action = test_random_range(0, 99);
+        if(!files[index].used || action < 20) {
+            CHECK(test_file_write(index));
+        } else if(action < 70) {
+            CHECK(test_file_read(index, false));
+        } else if(action < 80) {
+            CHECK(test_file_move(index));
+        } else if(action < 90) {
+            CHECK(test_file_remove(index));
+        } else {
+            CHECK(test_dir_list(test_random_range(0, DIR_COUNT - 1)));
+        }
+    }
+
+    // Remount drops the cache, then everything is read back
+    CHECK(f_mount(NULL, "", 0) == FR_OK);
+    CHECK(f_mount(&fs, "", 1) == FR_OK);
+    for(uint32_t index = 0; index < FILE_COUNT; index++) {
+        if(files[index].used) CHECK(test_file_read(index, true));
+    }
+    CHECK(f_mount(NULL, "", 0) == FR_OK);
+    return true;
+}
+
+static bool test_image_open(const char* path) {
+    if(image >= 0) close(image);
+    image = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    CHECK(image >= 0);
+    CHECK(ftruncate(image, (off_t)IMAGE_SECTORS * SECTOR_CACHE_SECTOR_SIZE) == 0);
+    return true;
+}
+
+static bool test_images_equal(const char* path_a, const char* path_b) {
+    FILE* a = fopen(path_a, "rb");
+    FILE* b = fopen(path_b, "rb");
+    static uint8_t chunk_a[64 * 1024], chunk_b[64 * 1024];
+    bool equal = a && b;
+
+    while(equal) {
+        const size_t size_a = fread(chunk_a, 1, sizeof(chunk_a), a);
+        const size_t size_b = fread(chunk_b, 1, sizeof(chunk_b), b);
+        equal = size_a == size_b && memcmp(chunk_a, chunk_b, size_a) == 0;
+        if(!size_a) break;
+    }
+
+    if(a) fclose(a);
+    if(b) fclose(b);
+    return equal;
+}
+
+int main(int argc, char** argv) {
+    static const struct {
+        BYTE format;
+        const char* name;
+    } formats[] = {
+        {FM_FAT, "FAT16"},
+        {FM_FAT32, "FAT32"},
+        {FM_EXFAT, "exFAT"},
+    };
+
+    if(argc < 2) {
+        fprintf(stderr, "Usage: %s <image> [seed]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    const uint32_t seed = argc > 2 ? strtoul(argv[2], NULL, 0) : 0x2545F491UL;
+
+    char cached_path[256];
+    snprintf(cached_path, sizeof(cached_path), "%s.cached", argv[1]);
+    void* memory = malloc(sector_cache_get_memory_size(CACHE_SECTORS));
+    bool success = true;
+
+    printf(
+        "Cache: %u sectors, %zu bytes\n",
+        CACHE_SECTORS,
+        sector_cache_get_memory_size(CACHE_SECTORS));
+
+    for(size_t i = 0; success && i < sizeof(formats) / sizeof(formats[0]); i++) {
+        DeviceStats direct;
+        SectorCacheStats stats;
+
+        cache = NULL;
+        device = (DeviceStats){0};
+        success = test_image_open(argv[1]) && test_workload(formats[i].format, seed);
+        direct = device;
+
+        cache = sector_cache_init(memory, CACHE_SECTORS, device_read, NULL);
+        device = (DeviceStats){0};
+        success = success && test_image_open(cached_path) &&
+                  test_workload(formats[i].format, seed);
+        sector_cache_get_stats(cache, &stats);
+
+        if(success && !test_images_equal(argv[1], cached_path)) {
+            fprintf(stderr, "%s: images differ\n", formats[i].name);
+            success = false;
+        }
+        if(success) {
+            printf(
+                "%s: read calls %u -> %u (%.2fx), sectors %u -> %u, "
+                "hits %u, misses %u, read-ahead %u, evictions %u\n",
+                formats[i].name,
+                direct.calls,
+                device.calls,
+                (double)direct.calls / device.calls,
+                direct.sectors,
+                device.sectors,
+                stats.hits,
+                stats.misses,
+                stats.read_ahead,
+                stats.evictions);
+        }
+    }
+
+    free(memory);
+    if(image >= 0) close(image);
+    printf(success ? "Sector cache OK\n" : "Sector cache FAILED\n");
+    return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -1,56 +1,304 @@
 #include "sector_cache.h"
 
-#include <stddef.h>
-#include <stdio.h>
 #include <string.h>
-#include <furi.h>
-#include <furi_hal_memory.h>
 
-#define SECTOR_SIZE 512
-#define N_SECTORS   8
+#define SECTOR_CACHE_NONE         (-1)
+#define SECTOR_CACHE_ALIGN(size)  (((size) + 3U) & ~(size_t)3U)
+#define SECTOR_CACHE_SECTOR_UNSET UINT32_MAX
+
+typedef enum {
+    SectorCacheListFree,
+    SectorCacheListData,
+    SectorCacheListPinned,
+    SectorCacheListCount,
+} SectorCacheList;
+
+typedef struct {
+    uint32_t sector;
+    int16_t hash_next;
+    // Most recently used first
+    int16_t prev;
+    int16_t next;
+    uint8_t list;
+} SectorCacheEntry;
 
 typedef struct {
-    uint32_t itr;
-    uint32_t sectors[N_SECTORS];
-    uint8_t sector_data[N_SECTORS][SECTOR_SIZE];
-} SectorCache;
+    int16_t head;
+    int16_t tail;
+    uint16_t count;
+} SectorCacheListHead;
+
+struct SectorCache {
+    SectorCacheReadCallback read_callback;
+    void* context;
+    uint16_t sector_count;
+    uint16_t pinned_max;
+    uint16_t bucket_mask;
+    // Where a sequential data reader continues, candidate for read-ahead
+    uint32_t next_sector;
+    SectorCacheListHead lists[SectorCacheListCount];
+    SectorCacheStats stats;
+    SectorCacheEntry* entries;
+    int16_t* buckets;
+    uint8_t* data;
+    uint8_t* staging;
+};
+
+static size_t sector_cache_get_bucket_count(size_t sector_count) {
+    size_t bucket_count = 1;
+    while(bucket_count < sector_count) {
+        bucket_count <<= 1;
+    }
+    return bucket_count;
+}
+
+size_t sector_cache_get_memory_size(size_t sector_count) {
+    return SECTOR_CACHE_ALIGN(sizeof(SectorCache)) +
+           SECTOR_CACHE_ALIGN(sizeof(SectorCacheEntry) * sector_count) +
+           SECTOR_CACHE_ALIGN(sizeof(int16_t) * sector_cache_get_bucket_count(sector_count)) +
+           SECTOR_CACHE_SECTOR_SIZE * (sector_count + SECTOR_CACHE_READ_AHEAD);
+}
+
+static inline uint8_t* sector_cache_entry_data(SectorCache* cache, int16_t index) {
+    return cache->data + SECTOR_CACHE_SECTOR_SIZE * index;
+}
+
+static void sector_cache_list_remove(SectorCache* cache, int16_t index) {
+    SectorCacheEntry* entry = &cache->entries[index];
+    SectorCacheListHead* list = &cache->lists[entry->list];
+
+    if(entry->prev != SECTOR_CACHE_NONE) {
+        cache->entries[entry->prev].next = entry->next;
+    } else {
+        list->head = entry->next;
+    }
+    if(entry->next != SECTOR_CACHE_NONE) {
+        cache->entries[entry->next].prev = entry->prev;
+    } else {
+        list->tail = entry->prev;
+    }
+    list->count--;
+}
+
+static void sector_cache_list_push(SectorCache* cache, uint8_t list_id, int16_t index) {
+    SectorCacheEntry* entry = &cache->entries[index];
+    SectorCacheListHead* list = &cache->lists[list_id];
 
-static SectorCache* cache = NULL;
+    entry->list = list_id;
+    entry->prev = SECTOR_CACHE_NONE;
+    entry->next = list->head;
+    if(list->head != SECTOR_CACHE_NONE) {
+        cache->entries[list->head].prev = index;
+    } else {
+        list->tail = index;
+    }
+    list->head = index;
+    list->count++;
+}
 
-void sector_cache_init(void) {
-    if(cache == NULL) {
-        cache = memmgr_alloc_from_pool(sizeof(SectorCache));
+static int16_t sector_cache_find(SectorCache* cache, uint32_t sector) {
+    int16_t index = cache->buckets[sector & cache->bucket_mask];
+    while(index != SECTOR_CACHE_NONE && cache->entries[index].sector != sector) {
+        index = cache->entries[index].hash_next;
     }
+    return index;
+}
 
-    if(cache != NULL) {
-        memset(cache, 0, sizeof(SectorCache));
+static void sector_cache_hash_remove(SectorCache* cache, int16_t index) {
+    int16_t* link = &cache->buckets[cache->entries[index].sector & cache->bucket_mask];
+    while(*link != index) {
+        link = &cache->entries[*link].hash_next;
     }
+    *link = cache->entries[index].hash_next;
+}
+
+static void sector_cache_drop(SectorCache* cache, int16_t index) {
+    sector_cache_hash_remove(cache, index);
+    sector_cache_list_remove(cache, index);
+    sector_cache_list_push(cache, SectorCacheListFree, index);
 }
 
-uint8_t* sector_cache_get(uint32_t n_sector) {
-    if(cache != NULL && n_sector != 0) {
-        for(int sector_i = 0; sector_i < N_SECTORS; ++sector_i) {
-            if(cache->sectors[sector_i] == n_sector) {
-                return cache->sector_data[sector_i];
+static void sector_cache_use(SectorCache* cache, int16_t index, bool metadata) {
+    uint8_t list_id = cache->entries[index].list;
+    if(metadata) {
+        list_id = SectorCacheListPinned;
+    } else if(list_id == SectorCacheListFree) {
+        list_id = SectorCacheListData;
+    }
+
+    sector_cache_list_remove(cache, index);
+    sector_cache_list_push(cache, list_id, index);
+
+    // Pinned sectors over the limit get a second chance among data sectors
+    while(cache->lists[SectorCacheListPinned].count > cache->pinned_max) {
+        const int16_t demoted = cache->lists[SectorCacheListPinned].tail;
+        sector_cache_list_remove(cache, demoted);
+        sector_cache_list_push(cache, SectorCacheListData, demoted);
+    }
+}
+
+static void sector_cache_insert(
+    SectorCache* cache,
+    const uint8_t* data,
+    uint32_t sector,
+    bool metadata) {
+    int16_t index = cache->lists[SectorCacheListFree].tail;
+
+    if(index == SECTOR_CACHE_NONE) {
+        index = cache->lists[SectorCacheListData].tail;
+        if(index == SECTOR_CACHE_NONE) index = cache->lists[SectorCacheListPinned].tail;
+        sector_cache_hash_remove(cache, index);
+        cache->stats.evictions++;
+    }
+
+    SectorCacheEntry* entry = &cache->entries[index];
+    entry->sector = sector;
+    int16_t* bucket = &cache->buckets[sector & cache->bucket_mask];
+    entry->hash_next = *bucket;
+    *bucket = index;
+
+    memcpy(sector_cache_entry_data(cache, index), data, SECTOR_CACHE_SECTOR_SIZE);
+    sector_cache_use(cache, index, metadata);
+}
+
+SectorCache* sector_cache_init(
+    void* memory,
+    size_t sector_count,
+    SectorCacheReadCallback read_callback,
+    void* context) {
+    if(!memory || !read_callback || sector_count < 2 || sector_count > INT16_MAX) return NULL;
+
+    uint8_t* cursor = memory;
+    SectorCache* cache = memory;
+    cursor += SECTOR_CACHE_ALIGN(sizeof(SectorCache));
+
+    memset(cache, 0, sizeof(SectorCache));
+    cache->read_callback = read_callback;
+    cache->context = context;
+    cache->sector_count = sector_count;
+    cache->pinned_max = sector_count - sector_count / 4;
+    cache->bucket_mask = sector_cache_get_bucket_count(sector_count) - 1;
+
+    cache->entries = (SectorCacheEntry*)cursor;
+    cursor += SECTOR_CACHE_ALIGN(sizeof(SectorCacheEntry) * sector_count);
+    cache->buckets = (int16_t*)cursor;
+    cursor += SECTOR_CACHE_ALIGN(sizeof(int16_t) * (cache->bucket_mask + 1U));
+    cache->data = cursor;
+    cache->staging = cursor + SECTOR_CACHE_SECTOR_SIZE * sector_count;
+
+    sector_cache_invalidate_all(cache);
+    return cache;
+}
+
+bool sector_cache_read(
+    SectorCache* cache,
+    uint8_t* data,
+    uint32_t sector,
+    uint32_t count,
+    bool metadata) {
+    bool sequential = false;
+    if(!metadata) {
+        sequential = (sector == cache->next_sector);
+        cache->next_sector = sector + count;
+    }
+
+    if(count == 1) {
+        const int16_t index = sector_cache_find(cache, sector);
+        if(index != SECTOR_CACHE_NONE) {
+            cache->stats.hits++;
+            memcpy(data, sector_cache_entry_data(cache, index), SECTOR_CACHE_SECTOR_SIZE);
+            sector_cache_use(cache, index, metadata);
+            return true;
+        }
+
+        cache->stats.misses++;
+        // Read-ahead may run past the end of the device, plain read is the fallback
+        if(sequential &&
+           cache->read_callback(cache->context, cache->staging, sector, SECTOR_CACHE_READ_AHEAD)) {
+            memcpy(data, cache->staging, SECTOR_CACHE_SECTOR_SIZE);
+            sector_cache_insert(cache, cache->staging, sector, false);
+            for(uint32_t i = 1; i < SECTOR_CACHE_READ_AHEAD; i++) {
+                if(sector_cache_find(cache, sector + i) != SECTOR_CACHE_NONE) continue;
+                sector_cache_insert(
+                    cache, cache->staging + SECTOR_CACHE_SECTOR_SIZE * i, sector + i, false);
+                cache->stats.read_ahead++;
             }
+            return true;
         }
+
+        if(!cache->read_callback(cache->context, data, sector, 1)) return false;
+        sector_cache_insert(cache, data, sector, metadata);
+        return true;
     }
-    return NULL;
+
+    uint32_t done = 0;
+    while(done < count) {
+        uint8_t* buffer = data + SECTOR_CACHE_SECTOR_SIZE * done;
+        const int16_t index = sector_cache_find(cache, sector + done);
+        if(index != SECTOR_CACHE_NONE) {
+            cache->stats.hits++;
+            memcpy(buffer, sector_cache_entry_data(cache, index), SECTOR_CACHE_SECTOR_SIZE);
+            sector_cache_use(cache, index, metadata);
+            done++;
+            continue;
+        }
+
+        // Read the whole run of missing sectors at once
+        uint32_t run = 1;
+        while(done + run < count &&
+              sector_cache_find(cache, sector + done + run) == SECTOR_CACHE_NONE) {
+            run++;
+        }
+        if(!cache->read_callback(cache->context, buffer, sector + done, run)) return false;
+        cache->stats.misses += run;
+        done += run;
+    }
+
+    return true;
 }
 
-void sector_cache_put(uint32_t n_sector, uint8_t* data) {
-    if(cache == NULL) return;
-    cache->sectors[cache->itr % N_SECTORS] = n_sector;
-    memcpy(cache->sector_data[cache->itr % N_SECTORS], data, SECTOR_SIZE);
-    cache->itr++;
+void sector_cache_update(
+    SectorCache* cache,
+    const uint8_t* data,
+    uint32_t sector,
+    uint32_t count) {
+    for(uint32_t i = 0; i < count; i++) {
+        const int16_t index = sector_cache_find(cache, sector + i);
+        if(index == SECTOR_CACHE_NONE) continue;
+        memcpy(
+            sector_cache_entry_data(cache, index),
+            data + SECTOR_CACHE_SECTOR_SIZE * i,
+            SECTOR_CACHE_SECTOR_SIZE);
+    }
 }
 
-void sector_cache_invalidate_range(uint32_t start_sector, uint32_t end_sector) {
-    if(cache == NULL) return;
-    for(int sector_i = 0; sector_i < N_SECTORS; ++sector_i) {
-        if((cache->sectors[sector_i] >= start_sector) &&
-           (cache->sectors[sector_i] <= end_sector)) {
-            cache->sectors[sector_i] = 0;
+void sector_cache_invalidate_range(
+    SectorCache* cache,
+    uint32_t start_sector,
+    uint32_t end_sector) {
+    for(int16_t index = 0; index < cache->sector_count; index++) {
+        const SectorCacheEntry* entry = &cache->entries[index];
+        if(entry->list == SectorCacheListFree) continue;
+        if(entry->sector >= start_sector && entry->sector <= end_sector) {
+            sector_cache_drop(cache, index);
         }
     }
 }
+
+void sector_cache_invalidate_all(SectorCache* cache) {
+    for(size_t i = 0; i < SectorCacheListCount; i++) {
+        cache->lists[i] = (SectorCacheListHead){SECTOR_CACHE_NONE, SECTOR_CACHE_NONE, 0};
+    }
+    for(size_t i = 0; i <= cache->bucket_mask; i++) {
+        cache->buckets[i] = SECTOR_CACHE_NONE;
+    }
+    for(int16_t index = 0; index < cache->sector_count; index++) {
+        sector_cache_list_push(cache, SectorCacheListFree, index);
+    }
+    cache->next_sector = SECTOR_CACHE_SECTOR_UNSET;
+}
+
+void sector_cache_get_stats(SectorCache* cache, SectorCacheStats* stats) {
+    *stats = cache->stats;
+    stats->pinned = cache->lists[SectorCacheListPinned].count;
+}
@@ -1,35 +1,123 @@
 #pragma once
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** Cached sector size */
+#define SECTOR_CACHE_SECTOR_SIZE 512U
+
+/** Sectors loaded at once when a sequential single sector read misses */
+#define SECTOR_CACHE_READ_AHEAD 4U
+
+typedef struct SectorCache SectorCache;
+
+/**
+ * @brief Sector read callback, reads sectors from the backing device
+ * @param context Callback context
+ * @param data Pointer to a buffer for count sectors
+ * @param sector First sector number
+ * @param count Number of sectors to read
+ * @return true on success
+ */
+typedef bool (
+    *SectorCacheReadCallback)(void* context, uint8_t* data, uint32_t sector, uint32_t count);
+
+typedef struct {
+    uint32_t hits; /**< sectors served from the cache */
+    uint32_t misses; /**< sectors read from the device */
+    uint32_t read_ahead; /**< sectors loaded ahead of a sequential reader */
+    uint32_t evictions; /**< sectors dropped to make room for new ones */
+    uint32_t pinned; /**< metadata sectors currently in the cache */
+} SectorCacheStats;
+
+/**
+ * @brief Get memory size required by a cache instance
+ * @param sector_count Number of cached sectors
+ * @return Size in bytes
+ */
+size_t sector_cache_get_memory_size(size_t sector_count);
+
 /**
- * @brief Init sector cache system
+ * @brief Init sector cache in caller provided memory
+ *
+ * Depends on nothing but libc, so it can be run on the host against a disk image.
+ * Metadata sectors (FAT, directories) are pinned: data sectors never evict them
+ * while there is room, and they are given most of the cache.
+ *
+ * @param memory Pointer to sector_cache_get_memory_size(sector_count) bytes, 4 byte aligned
+ * @param sector_count Number of cached sectors, 2..INT16_MAX
+ * @param read_callback Device read callback
+ * @param context Read callback context
+ * @return Pointer to the SectorCache instance, located at memory
  */
-void sector_cache_init(void);
+SectorCache* sector_cache_init(
+    void* memory,
+    size_t sector_count,
+    SectorCacheReadCallback read_callback,
+    void* context);
 
 /**
- * @brief Get sector data from cache
- * @param n_sector Sector number
- * @return Pointer to sector data or NULL if not found
+ * @brief Read sectors through the cache
+ *
+ * Missing sectors are read from the device in as few calls as possible.
+ * Single sector reads are cached, sequential ones load SECTOR_CACHE_READ_AHEAD
+ * sectors at once. Multi-sector reads are served from the cache but not
+ * inserted into it, bulk data would only push out useful sectors.
+ *
+ * @param cache Pointer to a SectorCache instance
+ * @param data Pointer to a buffer for count sectors
+ * @param sector First sector number
+ * @param count Number of sectors to read
+ * @param metadata Sectors hold file system metadata and should be pinned
+ * @return true on success
  */
-uint8_t* sector_cache_get(uint32_t n_sector);
+bool sector_cache_read(
+    SectorCache* cache,
+    uint8_t* data,
+    uint32_t sector,
+    uint32_t count,
+    bool metadata);
 
 /**
- * @brief Put sector data to cache
- * @param n_sector Sector number
- * @param data Pointer to sector data
+ * @brief Update cached copies of sectors written to the device
+ * @param cache Pointer to a SectorCache instance
+ * @param data Pointer to written data, count sectors
+ * @param sector First sector number
+ * @param count Number of sectors
  */
-void sector_cache_put(uint32_t n_sector, uint8_t* data);
+void sector_cache_update(
+    SectorCache* cache,
+    const uint8_t* data,
+    uint32_t sector,
+    uint32_t count);
 
 /**
  * @brief Invalidate sector cache for given range
+ * @param cache Pointer to a SectorCache instance
  * @param start_sector Start sector number
- * @param end_sector End sector number
+ * @param end_sector End sector number, inclusive
+ */
+void sector_cache_invalidate_range(
+    SectorCache* cache,
+    uint32_t start_sector,
+    uint32_t end_sector);
+
+/**
+ * @brief Invalidate the whole cache, statistics are kept
+ * @param cache Pointer to a SectorCache instance
+ */
+void sector_cache_invalidate_all(SectorCache* cache);
+
+/**
+ * @brief Get cache statistics
+ * @param cache Pointer to a SectorCache instance
+ * @param stats Pointer to a SectorCacheStats to fill
  */
-void sector_cache_invalidate_range(uint32_t start_sector, uint32_t end_sector);
+void sector_cache_get_stats(SectorCache* cache, SectorCacheStats* stats);
 
 #ifdef __cplusplus
 }
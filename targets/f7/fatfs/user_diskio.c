@@ -1,8 +1,13 @@
 #include <furi.h>
 #include <furi_hal.h>
 #include "user_diskio.h"
+#include "fatfs.h"
 #include "sector_cache.h"
 
+#define SD_CACHE_SECTORS 16
+
+static SectorCache* sd_cache = NULL;
+
 static DSTATUS driver_initialize(BYTE pdrv);
 static DSTATUS driver_status(BYTE pdrv);
 static DRESULT driver_read(BYTE pdrv, BYTE* buff, DWORD sector, UINT count);
@@ -24,6 +29,8 @@ Diskio_drvTypeDef sd_fatfs_driver = {
   */
 static DSTATUS driver_initialize(BYTE pdrv) {
     UNUSED(pdrv);
+    // Card may have been replaced or written elsewhere since the last mount
+    if(sd_cache) sector_cache_invalidate_all(sd_cache);
     return RES_OK;
 }
 
@@ -42,6 +49,21 @@ static DSTATUS driver_status(BYTE pdrv) {
     return status;
 }
 
+static bool
+    driver_cache_read_callback(void* context, uint8_t* data, uint32_t sector, uint32_t count) {
+    UNUSED(context);
+    return furi_hal_sd_read_blocks((uint32_t*)data, sector, count) == FuriStatusOk;
+}
+
+static SectorCache* driver_cache_get(void) {
+    if(!sd_cache) {
+        void* memory = memmgr_alloc_from_pool(sector_cache_get_memory_size(SD_CACHE_SECTORS));
+        sd_cache =
+            sector_cache_init(memory, SD_CACHE_SECTORS, driver_cache_read_callback, NULL);
+    }
+    return sd_cache;
+}
+
 /**
   * @brief  Reads Sector(s) 
   * @param  pdrv: Physical drive number (0..)
@@ -52,8 +74,10 @@ static DSTATUS driver_status(BYTE pdrv) {
   */
 static DRESULT driver_read(BYTE pdrv, BYTE* buff, DWORD sector, UINT count) {
     UNUSED(pdrv);
-    FuriStatus status = furi_hal_sd_read_blocks((uint32_t*)buff, (uint32_t)(sector), count);
-    return status == FuriStatusOk ? RES_OK : RES_ERROR;
+    // FatFs loads FAT and directory sectors into its window buffer, file data goes elsewhere
+    bool metadata = (buff == fatfs_object.win);
+    bool success = sector_cache_read(driver_cache_get(), buff, sector, count, metadata);
+    return success ? RES_OK : RES_ERROR;
 }
 
 /**
@@ -67,6 +91,12 @@ static DRESULT driver_read(BYTE pdrv, BYTE* buff, DWORD sector, UINT count) {
 static DRESULT driver_write(BYTE pdrv, const BYTE* buff, DWORD sector, UINT count) {
     UNUSED(pdrv);
     FuriStatus status = furi_hal_sd_write_blocks((uint32_t*)buff, (uint32_t)(sector), count);
+    if(status == FuriStatusOk) {
+        sector_cache_update(driver_cache_get(), buff, sector, count);
+    } else {
+        // Failed write leaves the card contents unknown
+        sector_cache_invalidate_range(driver_cache_get(), sector, sector + count - 1);
+    }
     return status == FuriStatusOk ? RES_OK : RES_ERROR;
 }
 
@@ -117,3 +147,7 @@ static DRESULT driver_ioctl(BYTE pdrv, BYTE cmd, void* buff) {
 
     return res;
 }
+
+void user_diskio_get_cache_stats(SectorCacheStats* stats) {
+    sector_cache_get_stats(driver_cache_get(), stats);
+}
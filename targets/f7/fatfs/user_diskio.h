@@ -5,9 +5,16 @@ extern "C" {
 #endif
 
 #include "fatfs/ff_gen_drv.h"
+#include "sector_cache.h"
 
 extern Diskio_drvTypeDef sd_fatfs_driver;
 
+/**
+ * @brief Get SD card sector cache statistics
+ * @param stats Pointer to a SectorCacheStats to fill
+ */
+void user_diskio_get_cache_stats(SectorCacheStats* stats);
+
 #ifdef __cplusplus
 }
 #endif